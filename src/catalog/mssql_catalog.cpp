@@ -4,6 +4,7 @@
 
 #include "azure/azure_token.hpp"
 #include "catalog/mssql_bind_anchors.hpp"
+#include "catalog/mssql_catalog_snapshot.hpp"
 #include "catalog/mssql_ddl_translator.hpp"
 #include "catalog/mssql_schema_entry.hpp"
 #include "catalog/mssql_statistics.hpp"
@@ -17,6 +18,7 @@
 #include "dml/insert/mssql_insert_target.hpp"
 #include "dml/insert/mssql_physical_insert.hpp"
 #include "dml/mssql_dml_config.hpp"
+#include "dml/mssql_dml_pushdown.hpp"
 #include "dml/update/mssql_physical_update.hpp"
 #include "dml/update/mssql_update_target.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
@@ -77,9 +79,39 @@ MSSQLCatalog::MSSQLCatalog(AttachedDatabase &db, const string &context_name,
 
 	// Create statistics provider with default TTL (will be configured from settings later)
 	statistics_provider_ = make_uniq<MSSQLStatisticsProvider>();
+
+	// Catalog snapshot file, keyed by server, database and login. Token-based
+	// logins are keyed by how they authenticate, never by the token itself: the
+	// key is stored in the file.
+	if (!connection_info_->catalog_snapshot.empty()) {
+		string login = connection_info_->user;
+		if (login.empty()) {
+			switch (connection_info_->auth_method) {
+			case AuthMethod::AZURE_AD:
+				login = "azure:" + connection_info_->azure_secret_name;
+				break;
+			case AuthMethod::MANUAL_TOKEN:
+				login = "access_token";
+				break;
+			case AuthMethod::KRB5:
+			case AuthMethod::WINSSPI:
+				login = "integrated";
+				break;
+			default:
+				break;
+			}
+		}
+		snapshot_key_ = MSSQLCatalogSnapshotKey(connection_info_->host, connection_info_->port,
+												connection_info_->database, login);
+		snapshot_path_ = MSSQLCatalogSnapshotPath(connection_info_->catalog_snapshot, snapshot_key_);
+	}
 }
 
 MSSQLCatalog::~MSSQLCatalog() noexcept {
+	// Before anything it uses (the cache, the pool) goes away
+	StopBackgroundRefresh();
+	SaveCatalogSnapshot();
+
 	// Wipe the cached FEDAUTH token (UTF-16LE bytes) on catalog teardown so
 	// the bearer credential does not linger in heap-recycled memory. Same
 	// rationale as MSSQLConnectionInfo::~MSSQLConnectionInfo — use
@@ -117,6 +149,36 @@ std::unique_ptr<MSSQLResultStream> MSSQLCatalog::RetrieveStream(const std::strin
 	return stream;
 }
 
+//===----------------------------------------------------------------------===//
+// Described Result Shapes (mssql_scan_describe_bind)
+//===----------------------------------------------------------------------===//
+
+// Distinct query texts kept per catalog before the cache starts over.
+static constexpr size_t MSSQL_DESCRIBED_RESULTS_MAX = 256;
+
+bool MSSQLCatalog::TryGetDescribedResult(const std::string &query, DescribedResult &out) const {
+	std::lock_guard<std::mutex> lock(described_mutex_);
+	auto it = described_results_.find(query);
+	if (it == described_results_.end()) {
+		return false;
+	}
+	out = it->second;
+	return true;
+}
+
+void MSSQLCatalog::CacheDescribedResult(const std::string &query, DescribedResult result) {
+	std::lock_guard<std::mutex> lock(described_mutex_);
+	if (described_results_.size() >= MSSQL_DESCRIBED_RESULTS_MAX) {
+		described_results_.clear();
+	}
+	described_results_[query] = std::move(result);
+}
+
+void MSSQLCatalog::ForgetDescribedResult(const std::string &query) {
+	std::lock_guard<std::mutex> lock(described_mutex_);
+	described_results_.erase(query);
+}
+
 //===----------------------------------------------------------------------===//
 // Initialization
 //===----------------------------------------------------------------------===//
@@ -145,11 +207,13 @@ void MSSQLCatalog::Initialize(bool load_builtin) {
 		auto token = fedauth_token_utf16le_;
 		auto tds_packet_size = connection_info_->tds_packet_size;
 		auto utf8_support = connection_info_->utf8_support;
-		factory = [host, port, database, encrypt, token, app_name, tds_packet_size,
-				   utf8_support]() -> std::shared_ptr<tds::TdsConnection> {
+		auto kernel_tls = connection_info_->tls_kernel_offload;
+		factory = [host, port, database, encrypt, token, app_name, tds_packet_size, utf8_support,
+				   kernel_tls]() -> std::shared_ptr<tds::TdsConnection> {
 			auto conn = std::make_shared<tds::TdsConnection>();
 			conn->SetRequestedPacketSize(tds_packet_size);
 			conn->SetRequestUtf8Support(utf8_support);
+			conn->SetKernelTls(kernel_tls);
 			if (!conn->Connect(host, port)) {
 				return nullptr;
 			}
@@ -170,6 +234,7 @@ void MSSQLCatalog::Initialize(bool load_builtin) {
 			auto conn = std::make_shared<tds::TdsConnection>();
 			conn->SetRequestedPacketSize(info_copy.tds_packet_size);
 			conn->SetRequestUtf8Support(info_copy.utf8_support);
+			conn->SetKernelTls(info_copy.tls_kernel_offload);
 			if (!conn->Connect(info_copy.host, info_copy.port)) {
 				fprintf(stderr, "[MSSQL POOL] integrated-auth: TCP connect to %s:%u failed: %s\n",
 						info_copy.host.c_str(), static_cast<unsigned>(info_copy.port), conn->GetLastError().c_str());
@@ -225,11 +290,13 @@ void MSSQLCatalog::Initialize(bool load_builtin) {
 		auto encrypt = connection_info_->use_encrypt;
 		auto tds_packet_size = connection_info_->tds_packet_size;
 		auto utf8_support = connection_info_->utf8_support;
-		factory = [host, port, username, password, database, encrypt, app_name, tds_packet_size,
-				   utf8_support]() -> std::shared_ptr<tds::TdsConnection> {
+		auto kernel_tls = connection_info_->tls_kernel_offload;
+		factory = [host, port, username, password, database, encrypt, app_name, tds_packet_size, utf8_support,
+				   kernel_tls]() -> std::shared_ptr<tds::TdsConnection> {
 			auto conn = std::make_shared<tds::TdsConnection>();
 			conn->SetRequestedPacketSize(tds_packet_size);
 			conn->SetRequestUtf8Support(utf8_support);
+			conn->SetKernelTls(kernel_tls);
 			if (!conn->Connect(host, port)) {
 				return nullptr;
 			}
@@ -252,6 +319,9 @@ void MSSQLCatalog::Initialize(bool load_builtin) {
 
 	// Query database collation (needed for column metadata)
 	QueryDatabaseCollation();
+
+	// Columns from the last session's snapshot, checked against sys.objects
+	LoadCatalogSnapshot();
 }
 
 void MSSQLCatalog::QueryDatabaseCollation() {
@@ -284,6 +354,152 @@ void MSSQLCatalog::QueryDatabaseCollation() {
 	connection_pool_->Release(std::move(connection));
 }
 
+//===----------------------------------------------------------------------===//
+// Catalog Snapshot
+//===----------------------------------------------------------------------===//
+
+void MSSQLCatalog::LoadCatalogSnapshot() {
+	if (snapshot_path_.empty() || !connection_pool_) {
+		return;
+	}
+
+	auto connection = connection_pool_->Acquire();
+	if (!connection) {
+		return;
+	}
+
+	// A snapshot only saves time: if it cannot be used, discovery runs as usual
+	bool loaded = false;
+	try {
+		loaded = metadata_cache_->LoadSnapshot(*connection, snapshot_path_, snapshot_key_);
+	} catch (...) {
+		loaded = false;
+	}
+	connection_pool_->Release(std::move(connection));
+
+	if (loaded) {
+		// Same as mssql_preload_catalog: the listing's row counts spare the
+		// statistics provider one DMV query per table
+		metadata_cache_->ForEachTable([&](const string &schema, const string &table, idx_t row_count) {
+			statistics_provider_->PreloadRowCount(schema, table, row_count);
+		});
+	}
+}
+
+void MSSQLCatalog::SaveCatalogSnapshot() {
+	if (snapshot_path_.empty() || !catalog_enabled_ || !metadata_cache_) {
+		return;
+	}
+	try {
+		metadata_cache_->SaveSnapshot(snapshot_path_, snapshot_key_);
+	} catch (...) {
+		// Runs from the destructor; a snapshot that was not written is simply not used next time
+	}
+}
+
+//===----------------------------------------------------------------------===//
+// Delta Refresh
+//===----------------------------------------------------------------------===//
+
+bool MSSQLCatalog::RefreshCatalogDelta(ClientContext *context, int64_t margin_seconds) {
+	// Same connection rule as LookupSchema: inside a transaction use its pinned
+	// connection, so the listing is not blocked by the transaction's own DDL
+	auto release = [&](std::shared_ptr<tds::TdsConnection> connection) {
+		if (context) {
+			ConnectionProvider::ReleaseConnection(*context, *this, std::move(connection));
+		} else {
+			connection_pool_->Release(std::move(connection));
+		}
+	};
+
+	MSSQLCatalogDelta delta;
+	try {
+		auto connection = context ? ConnectionProvider::GetConnection(*context, *this) : connection_pool_->Acquire();
+		if (!connection) {
+			return false;
+		}
+		bool refreshed = false;
+		try {
+			refreshed = metadata_cache_->DeltaRefresh(*connection, delta, margin_seconds);
+		} catch (...) {
+			release(std::move(connection));
+			throw;
+		}
+		release(std::move(connection));
+		if (!refreshed) {
+			return false;
+		}
+	} catch (...) {
+		// The cache stays expired: the next lookup reloads it in full and reports the error
+		return false;
+	}
+	if (delta.tables.empty() && delta.schemas.empty()) {
+		return true;
+	}
+
+	// Described mssql_scan result shapes may name the objects that changed
+	{
+		std::lock_guard<std::mutex> described_lock(described_mutex_);
+		described_results_.clear();
+	}
+
+	// Bound entries outlive the cache's TTL; evict the ones that changed so the
+	// next bind rebuilds them from the refreshed cache. The rest stay bound.
+	std::lock_guard<std::mutex> lock(schema_mutex_);
+	for (const auto &schema_name : delta.schemas) {
+		auto it = schema_entries_.find(schema_name);
+		if (it != schema_entries_.end()) {
+			it->second->GetTableSet().Invalidate();
+		}
+	}
+	for (const auto &table : delta.tables) {
+		auto it = schema_entries_.find(table.first);
+		if (it != schema_entries_.end()) {
+			it->second->GetTableSet().InvalidateEntry(table.second);
+		}
+	}
+	return true;
+}
+
+void MSSQLCatalog::StartBackgroundRefresh() {
+	std::lock_guard<std::mutex> lock(refresh_mutex_);
+	if (refresh_thread_.joinable() || refresh_stop_) {
+		return;
+	}
+	refresh_thread_ = std::thread([this]() { BackgroundRefreshLoop(); });
+}
+
+void MSSQLCatalog::StopBackgroundRefresh() {
+	{
+		std::lock_guard<std::mutex> lock(refresh_mutex_);
+		refresh_stop_ = true;
+	}
+	refresh_cv_.notify_all();
+	if (refresh_thread_.joinable()) {
+		refresh_thread_.join();
+	}
+}
+
+void MSSQLCatalog::BackgroundRefreshLoop() {
+	std::unique_lock<std::mutex> lock(refresh_mutex_);
+	while (!refresh_stop_) {
+		// Refresh once half the TTL is left; with TTL 0 there is nothing to do but
+		// wait for the setting to change
+		int64_t margin = metadata_cache_->GetTTL() / 2;
+		refresh_cv_.wait_for(lock, std::chrono::seconds(MaxValue<int64_t>(margin, 1)),
+							 [this]() { return refresh_stop_; });
+		if (refresh_stop_) {
+			break;
+		}
+		if (!background_refresh_.load() || !metadata_cache_->DeltaRefreshDue(margin)) {
+			continue;
+		}
+		lock.unlock();
+		RefreshCatalogDelta(nullptr, margin);
+		lock.lock();
+	}
+}
+
 //===----------------------------------------------------------------------===//
 // Catalog Type
 //===----------------------------------------------------------------------===//
@@ -623,6 +839,15 @@ PhysicalOperator &MSSQLCatalog::PlanInsert(ClientContext &context, PhysicalPlanG
 		result_types.push_back(LogicalType::BIGINT);
 	}
 
+	// A SELECT the server can run itself fills the table there, rows never leave it
+	if (plan && config.pushdown) {
+		auto sql = MSSQLDMLPushdown::TryBuildInsert(context, *this, op, target);
+		if (!sql.empty()) {
+			return planner.Make<MSSQLPhysicalDMLPushdown>(std::move(result_types), op.estimated_cardinality,
+														 context_name_, "INSERT", std::move(sql));
+		}
+	}
+
 	// Create the physical operator using planner.Make<T>()
 	auto &physical_insert = planner.Make<MSSQLPhysicalInsert>(std::move(result_types), op.estimated_cardinality,
 															  std::move(target), std::move(config), op.return_chunk);
@@ -673,6 +898,15 @@ PhysicalOperator &MSSQLCatalog::PlanDelete(ClientContext &context, PhysicalPlanG
 	vector<LogicalType> result_types;
 	result_types.push_back(LogicalType::BIGINT);
 
+	// A statement the server can run as written needs no rowid round trip
+	if (config.pushdown) {
+		auto sql = MSSQLDMLPushdown::TryBuildDelete(op, target);
+		if (!sql.empty()) {
+			return planner.Make<MSSQLPhysicalDMLPushdown>(std::move(result_types), op.estimated_cardinality,
+														 context_name_, "DELETE", std::move(sql));
+		}
+	}
+
 	// Create the physical operator using planner.Make<T>()
 	auto &physical_delete =
 		planner.Make<MSSQLPhysicalDelete>(std::move(result_types), op.estimated_cardinality, std::move(target), config);
@@ -754,6 +988,15 @@ PhysicalOperator &MSSQLCatalog::PlanUpdate(ClientContext &context, PhysicalPlanG
 	vector<LogicalType> result_types;
 	result_types.push_back(LogicalType::BIGINT);
 
+	// A statement the server can run as written needs no rowid round trip
+	if (config.pushdown) {
+		auto sql = MSSQLDMLPushdown::TryBuildUpdate(op, target);
+		if (!sql.empty()) {
+			return planner.Make<MSSQLPhysicalDMLPushdown>(std::move(result_types), op.estimated_cardinality,
+														 context_name_, "UPDATE", std::move(sql));
+		}
+	}
+
 	// Create the physical operator using planner.Make<T>()
 	auto &physical_update =
 		planner.Make<MSSQLPhysicalUpdate>(std::move(result_types), op.estimated_cardinality, std::move(target), config);
@@ -1090,6 +1333,12 @@ void MSSQLCatalog::InvalidateMetadataCache() {
 		metadata_cache_->Invalidate();
 	}
 
+	// Described mssql_scan result shapes may name the objects that changed
+	{
+		std::lock_guard<std::mutex> described_lock(described_mutex_);
+		described_results_.clear();
+	}
+
 	// Also clear the local schema entry cache.
 	// Spec 052 (Option D): in-flight binders are anchored in their
 	// ClientContext's MSSQLBindAnchors; dropping entries_ here just
@@ -1155,6 +1404,22 @@ void MSSQLCatalog::EnsureCacheLoaded(ClientContext &context) {
 
 	// Note: No eager Refresh() call - lazy loading handles this
 	// Each cache level (schemas, tables, columns) loads independently on first access
+
+	// Delta refresh: once the TTL has run out, patch the cache in place before the
+	// lazy loaders see it expired and discard it. With the background refresh on,
+	// the thread normally gets there first and this finds nothing due.
+	if (LoadCatalogDeltaRefresh(context)) {
+		bool background = LoadCatalogBackgroundRefresh(context);
+		background_refresh_.store(background);
+		if (background && cache_ttl > 0) {
+			StartBackgroundRefresh();
+		}
+		if (metadata_cache_->DeltaRefreshDue()) {
+			RefreshCatalogDelta(&context, 0);
+		}
+	} else {
+		background_refresh_.store(false);
+	}
 }
 
 void MSSQLCatalog::RefreshCache(ClientContext &context) {
@@ -1198,6 +1463,11 @@ void MSSQLCatalog::RefreshCache(ClientContext &context) {
 	// Release connection
 	connection_pool_->Release(std::move(connection));
 
+	{
+		std::lock_guard<std::mutex> described_lock(described_mutex_);
+		described_results_.clear();
+	}
+
 	// Invalidate all schema table sets to pick up any changes.
 	// Spec 052 (Option D): in-flight binders are anchored in
 	// MSSQLBindAnchors per ClientContext (released at QueryEnd).
@@ -3,6 +3,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <thread>
+#include "catalog/mssql_catalog_snapshot.hpp"
 #include "duckdb/common/exception.hpp"
 #include "query/mssql_simple_query.hpp"
 
@@ -56,7 +57,9 @@ SELECT
     o.type AS object_type,
     ISNULL(p.rows, 0) AS approx_rows,
     ISNULL(p.index_type, 0) AS index_type,
-    ISNULL(p.partition_count, 0) AS partition_count
+    ISNULL(p.partition_count, 0) AS partition_count,
+    o.object_id,
+    CONVERT(varchar(23), o.modify_date, 121) AS modify_date
 FROM sys.objects o
 LEFT JOIN (SELECT p.object_id, SUM(p.[rows]) AS [rows],
                   MAX(ISNULL(i.type, 0)) AS index_type, COUNT(*) AS partition_count
@@ -83,7 +86,9 @@ SELECT
     c.is_nullable,
     ISNULL(c.collation_name, '') AS collation_name,
     ISNULL(p.index_type, 0) AS index_type,
-    ISNULL(p.partition_count, 0) AS partition_count
+    ISNULL(p.partition_count, 0) AS partition_count,
+    o.object_id,
+    CONVERT(varchar(23), o.modify_date, 121) AS modify_date
 FROM sys.objects o
 INNER JOIN sys.columns c ON c.object_id = o.object_id
 LEFT JOIN sys.types t ON c.system_type_id = t.user_type_id AND t.system_type_id = t.user_type_id
@@ -114,7 +119,9 @@ SELECT
     c.is_nullable,
     ISNULL(c.collation_name, '') AS collation_name,
     ISNULL(p.index_type, 0) AS index_type,
-    ISNULL(p.partition_count, 0) AS partition_count
+    ISNULL(p.partition_count, 0) AS partition_count,
+    o.object_id,
+    CONVERT(varchar(23), o.modify_date, 121) AS modify_date
 FROM sys.schemas s
 INNER JOIN sys.objects o ON o.schema_id = s.schema_id
 INNER JOIN sys.columns c ON c.object_id = o.object_id
@@ -152,6 +159,72 @@ WHERE c.object_id = OBJECT_ID('%s')
 ORDER BY c.column_id
 )";
 
+// Whole-catalog listing for the catalog snapshot and the delta refresh: every
+// schema and every table/view in it, with the same row count and shape as
+// TABLE_DISCOVERY_SQL_TEMPLATE plus the object's version. LEFT JOIN so empty
+// schemas still appear (object_name '').
+// Note: ORDER BY is appended dynamically after optional filter clauses
+static const char *CATALOG_LISTING_SQL = R"(
+SELECT
+    s.name AS schema_name,
+    ISNULL(o.name, '') AS object_name,
+    ISNULL(o.type, '') AS object_type,
+    ISNULL(p.rows, 0) AS approx_rows,
+    ISNULL(p.index_type, 0) AS index_type,
+    ISNULL(p.partition_count, 0) AS partition_count,
+    ISNULL(o.object_id, 0) AS object_id,
+    ISNULL(CONVERT(varchar(23), o.modify_date, 121), '') AS modify_date
+FROM sys.schemas s
+LEFT JOIN sys.objects o ON o.schema_id = s.schema_id AND o.type IN ('U', 'V') AND o.is_ms_shipped = 0
+LEFT JOIN (SELECT p.object_id, SUM(p.[rows]) AS [rows],
+                  MAX(ISNULL(i.type, 0)) AS index_type, COUNT(*) AS partition_count
+           FROM sys.partitions p
+           LEFT JOIN sys.indexes i ON i.object_id = p.object_id AND i.index_id = p.index_id
+           WHERE p.index_id IN (0, 1)
+           GROUP BY p.object_id) p ON p.object_id = o.object_id
+WHERE s.schema_id NOT IN (3, 4)
+  AND s.principal_id != 0
+  AND s.name NOT IN ('guest', 'INFORMATION_SCHEMA', 'sys', 'db_owner', 'db_accessadmin',
+                     'db_securityadmin', 'db_ddladmin', 'db_backupoperator', 'db_datareader',
+                     'db_datawriter', 'db_denydatareader', 'db_denydatawriter'))";
+
+// Columns of the objects whose version changed, by object_id list
+static const char *COLUMNS_BY_OBJECT_ID_SQL_TEMPLATE = R"(
+SELECT
+    c.object_id,
+    c.name AS column_name,
+    c.column_id,
+    ISNULL(t.name, TYPE_NAME(c.user_type_id)) AS type_name,
+    c.max_length,
+    c.precision,
+    c.scale,
+    c.is_nullable,
+    ISNULL(c.collation_name, '') AS collation_name
+FROM sys.columns c
+LEFT JOIN sys.types t ON c.system_type_id = t.user_type_id AND t.system_type_id = t.user_type_id
+WHERE c.object_id IN (%s)
+ORDER BY c.object_id, c.column_id
+)";
+
+// Objects per COLUMNS_BY_OBJECT_ID_SQL_TEMPLATE query
+static constexpr idx_t COLUMNS_BY_OBJECT_ID_BATCH = 500;
+
+// Delta refresh watermark: one row that moves whenever a table or view is
+// created, dropped, renamed, moved between schemas or altered (modify_date),
+// or a schema comes or goes. Two aggregates over the catalog views, no object
+// is opened — cheap enough to run on every TTL expiry.
+static const char *CATALOG_FINGERPRINT_SQL = R"(
+SELECT o.object_count, o.object_checksum, o.last_modified, s.schema_count, s.schema_checksum
+FROM (SELECT COUNT_BIG(*) AS object_count,
+             ISNULL(CHECKSUM_AGG(CHECKSUM(object_id, schema_id, name, modify_date)), 0) AS object_checksum,
+             ISNULL(CONVERT(varchar(23), MAX(modify_date), 121), '') AS last_modified
+      FROM sys.objects
+      WHERE type IN ('U', 'V') AND is_ms_shipped = 0) o
+CROSS JOIN (SELECT COUNT_BIG(*) AS schema_count,
+                   ISNULL(CHECKSUM_AGG(CHECKSUM(schema_id, name)), 0) AS schema_checksum
+            FROM sys.schemas) s
+)";
+
 //===----------------------------------------------------------------------===//
 // Physical shape of the object, parsed out of the aggregated sys.partitions
 // subquery. index_type and partition_count always sit last in the SELECT list,
@@ -174,6 +247,22 @@ static void ParseTableShape(const vector<string> &values, idx_t index_type_idx,
 	table_meta.partition_count = partitions;
 }
 
+//===----------------------------------------------------------------------===//
+// Version of the object's definition (object_id, modify_date), which the
+// discovery queries return right after the physical shape. A catalog snapshot
+// trusts its cached columns only while both are unchanged.
+//===----------------------------------------------------------------------===//
+
+static void ParseTableVersion(const vector<string> &values, idx_t object_id_idx, idx_t modify_date_idx,
+							  MSSQLTableMetadata &table_meta) {
+	try {
+		table_meta.object_id = static_cast<int64_t>(std::stoll(values[object_id_idx]));
+	} catch (...) {
+		table_meta.object_id = 0;
+	}
+	table_meta.modify_date = values[modify_date_idx];
+}
+
 //===----------------------------------------------------------------------===//
 // TTL Helper
 //===----------------------------------------------------------------------===//
@@ -356,9 +445,10 @@ bool MSSQLMetadataCache::GetTableMetadata(tds::TdsConnection &connection, const
 
 	bool first_row = true;
 	ExecuteMetadataQuery(connection, query, [this, &table_meta, &first_row](const vector<string> &values) {
-		// 12 columns: object_type, approx_rows, the eight per-column fields, then
-		// index_id and partition_count. The guard has to cover the LAST index read.
-		if (values.size() < 12) {
+		// 14 columns: object_type, approx_rows, the eight per-column fields, then
+		// index_id, partition_count, object_id and modify_date. The guard has to
+		// cover the LAST index read.
+		if (values.size() < 14) {
 			return;
 		}
 
@@ -381,6 +471,7 @@ bool MSSQLMetadataCache::GetTableMetadata(tds::TdsConnection &connection, const
 			// object. Both drive the write path's TABLOCK and sort decisions.
 			// Per object, so it belongs in the first-row branch.
 			ParseTableShape(values, 10, 11, table_meta);
+			ParseTableVersion(values, 12, 13, table_meta);
 			CACHE_DEBUG(2, "table shape: %s kind=%d partitions=%llu rows=%llu", table_meta.name.c_str(),
 						(int)table_meta.index_kind, (unsigned long long)table_meta.partition_count,
 						(unsigned long long)table_meta.approx_row_count);
@@ -544,9 +635,10 @@ void MSSQLMetadataCache::LoadAllTableMetadata(tds::TdsConnection &connection, co
 	schema.tables.clear();
 
 	ExecuteMetadataQuery(connection, sql, [&](const vector<string> &values) {
-		// 14 columns: schema, object, type, approx_rows, the eight per-column
-		// fields, then index_id and partition_count. Guard the LAST index read.
-		if (values.size() < 14) {
+		// 16 columns: schema, object, type, approx_rows, the eight per-column
+		// fields, then index_id, partition_count, object_id and modify_date.
+		// Guard the LAST index read.
+		if (values.size() < 16) {
 			return;
 		}
 
@@ -588,6 +680,7 @@ void MSSQLMetadataCache::LoadAllTableMetadata(tds::TdsConnection &connection, co
 			// COLUMNSTORE, 0 heap — and partition_count > 1 marks a partitioned
 			// object. Both drive the write path's TABLOCK and sort decisions.
 			ParseTableShape(values, 12, 13, table_meta);
+			ParseTableVersion(values, 14, 15, table_meta);
 			schema.tables.emplace(current_table, std::move(table_meta));
 			auto table_it = schema.tables.find(current_table);
 			current_table_meta = &table_it->second;
@@ -638,14 +731,115 @@ void MSSQLMetadataCache::LoadAllTableMetadata(tds::TdsConnection &connection, co
 
 //===----------------------------------------------------------------------===//
 // Bulk Catalog Preload (Spec 033: US5)
+//
+// A preload is bound by server round trips, not by parsing, so the per-schema
+// queries are spread over several pooled connections. The unit of work is a
+// schema, or — when there are fewer schemas than connections, typically one
+// big dbo — an object_id shard of one (ABS(object_id % n) = k). Workers build
+// their tables without the cache lock and merge each unit under it, so a
+// reader sees every table either as before or fully reloaded.
 //===----------------------------------------------------------------------===//
 
-void MSSQLMetadataCache::BulkLoadAll(tds::TdsConnection &connection, const string &schema_name, idx_t &schema_count,
-									 idx_t &table_count, idx_t &column_count) {
+struct MSSQLBulkLoadUnit {
+	string schema_name;
+	idx_t shard = 0;
+	idx_t shard_count = 1;
+};
+
+void MSSQLMetadataCache::LoadBulkUnit(tds::TdsConnection &connection, const MSSQLBulkLoadUnit &unit,
+									  const string &database_collation, vector<MSSQLTableMetadata> &out_tables) {
+	string sql = StringUtil::Format(BULK_METADATA_SCHEMA_SQL_TEMPLATE, unit.schema_name);
+
+	// Push table filter to SQL Server if convertible to LIKE
+	if (filter_ && filter_->HasTableFilter()) {
+		string like_clause = MSSQLCatalogFilter::TryRegexToSQLLike(filter_->GetTablePattern(), "o.name");
+		if (!like_clause.empty()) {
+			sql += " AND " + like_clause;
+		}
+	}
+	if (unit.shard_count > 1) {
+		sql += StringUtil::Format(" AND ABS(o.object_id %% %llu) = %llu", (unsigned long long)unit.shard_count,
+								  (unsigned long long)unit.shard);
+	}
+	sql += "\nORDER BY s.name, o.name, c.column_id";
+
+	// Streaming group-by parse: rows arrive grouped by table
+	ExecuteMetadataQuery(connection, sql, [&](const vector<string> &values) {
+		// 16 columns: schema, object, type, approx_rows, the eight per-column
+		// fields, then index_id, partition_count, object_id and modify_date.
+		// Guard the LAST index read.
+		if (values.size() < 16) {
+			return;
+		}
+
+		const string &row_table = values[1];
+		const string &row_type = values[2];
+
+		// Apply table filter
+		if (filter_ && !filter_->MatchesTable(row_table)) {
+			return;
+		}
+
+		// New table group?
+		if (out_tables.empty() || out_tables.back().name != row_table) {
+			MSSQLTableMetadata table_meta;
+			table_meta.name = row_table;
+			table_meta.object_type =
+				(!row_type.empty() && row_type[0] == 'V') ? MSSQLObjectType::VIEW : MSSQLObjectType::TABLE;
+			try {
+				table_meta.approx_row_count = static_cast<idx_t>(std::stoll(values[3]));
+			} catch (...) {
+				table_meta.approx_row_count = 0;
+			}
+			// Physical shape from the same aggregated subquery (see the header):
+			// values[12] is sys.indexes.type — 1 clustered rowstore, 5
+			// clustered COLUMNSTORE, 0 heap — and partition_count > 1 marks
+			// a partitioned object. Both drive the write path's TABLOCK and
+			// sort decisions.
+			ParseTableShape(values, 12, 13, table_meta);
+			ParseTableVersion(values, 14, 15, table_meta);
+			out_tables.push_back(std::move(table_meta));
+		}
+
+		// Parse column info
+		int32_t col_id = 0;
+		try {
+			col_id = static_cast<int32_t>(std::stoi(values[5]));
+		} catch (...) {
+		}
+		int16_t max_len = 0;
+		try {
+			max_len = static_cast<int16_t>(std::stoi(values[7]));
+		} catch (...) {
+		}
+		uint8_t prec = 0;
+		try {
+			prec = static_cast<uint8_t>(std::stoi(values[8]));
+		} catch (...) {
+		}
+		uint8_t scl = 0;
+		try {
+			scl = static_cast<uint8_t>(std::stoi(values[9]));
+		} catch (...) {
+		}
+		bool nullable = (values[10] == "1" || values[10] == "true" || values[10] == "True");
+
+		out_tables.back().columns.emplace_back(values[4], col_id, values[6], max_len, prec, scl, nullable, values[11],
+											   database_collation);
+	});
+}
+
+void MSSQLMetadataCache::BulkLoadAll(tds::ConnectionPool &pool, const string &schema_name, idx_t max_connections,
+									 idx_t &schema_count, idx_t &table_count, idx_t &column_count) {
 	schema_count = 0;
 	table_count = 0;
 	column_count = 0;
 
+	auto first_connection = pool.Acquire();
+	if (!first_connection) {
+		throw IOException("Failed to acquire connection for catalog preload");
+	}
+
 	// Determine which schemas to load.
 	// When schema_name is empty, we iterate per-schema instead of one massive cross-schema
 	// query. This avoids SQL Server tempdb sort spills on large catalogs (200K+ tables)
@@ -665,150 +859,118 @@ void MSSQLMetadataCache::BulkLoadAll(tds::TdsConnection &connection, const strin
 		}
 		schema_sql += "\nORDER BY s.name";
 
-		RunMetadataQuery(
-			connection, schema_sql,
-			[&](const vector<string> &values) {
+		try {
+			ExecuteMetadataQuery(*first_connection, schema_sql, [&](const vector<string> &values) {
 				if (!values.empty()) {
 					schemas_to_load.push_back(values[0]);
 				}
-			},
-			metadata_timeout_ms_);
+			});
+		} catch (...) {
+			pool.Release(std::move(first_connection));
+			throw;
+		}
 
 		CACHE_DEBUG(1, "BulkLoadAll: discovered %zu schemas to load", schemas_to_load.size());
 	}
 
-	std::lock_guard<std::mutex> lock(mutex_);
-
-	// Load metadata per schema — each query sorts only within one schema,
-	// keeping the result set small enough to avoid tempdb spills
+	// Fewer schemas than connections: shard each schema so every connection has work
+	max_connections = MaxValue<idx_t>(max_connections, 1);
+	idx_t shard_count = schemas_to_load.empty() ? 1 : MaxValue<idx_t>(max_connections / schemas_to_load.size(), 1);
+	vector<MSSQLBulkLoadUnit> units;
 	for (const auto &target_schema : schemas_to_load) {
-		// Ensure schema entry exists
-		auto schema_it = schemas_.find(target_schema);
-		if (schema_it == schemas_.end()) {
-			schemas_.emplace(target_schema, MSSQLSchemaMetadata(target_schema));
-			schema_it = schemas_.find(target_schema);
-			schema_count++;
+		for (idx_t shard = 0; shard < shard_count; shard++) {
+			MSSQLBulkLoadUnit unit;
+			unit.schema_name = target_schema;
+			unit.shard = shard;
+			unit.shard_count = shard_count;
+			units.push_back(std::move(unit));
 		}
-		auto &schema = schema_it->second;
-
-		// Build per-schema query
-		string sql = StringUtil::Format(BULK_METADATA_SCHEMA_SQL_TEMPLATE, target_schema);
-
-		// Push table filter to SQL Server if convertible to LIKE
-		if (filter_ && filter_->HasTableFilter()) {
-			string like_clause = MSSQLCatalogFilter::TryRegexToSQLLike(filter_->GetTablePattern(), "o.name");
-			if (!like_clause.empty()) {
-				sql += " AND " + like_clause;
-			}
-		}
-		sql += "\nORDER BY s.name, o.name, c.column_id";
+	}
 
-		// Streaming group-by parse for this schema
-		string current_table;
-		MSSQLTableMetadata *current_table_meta = nullptr;
-		idx_t schema_tables = 0;
-		idx_t schema_columns = 0;
+	string database_collation = GetDatabaseCollation();
+	std::atomic<idx_t> next_unit{0};
+	std::atomic<bool> failed{false};
+	std::mutex error_mutex;
+	std::exception_ptr first_error;
 
-		ExecuteMetadataQuery(connection, sql, [&](const vector<string> &values) {
-			// 14 columns: schema, object, type, approx_rows, the eight per-column
-			// fields, then index_id and partition_count. Guard the LAST index read.
-			if (values.size() < 14) {
+	auto run_worker = [&](tds::TdsConnection &connection) {
+		while (!failed.load()) {
+			idx_t unit_idx = next_unit.fetch_add(1);
+			if (unit_idx >= units.size()) {
 				return;
 			}
-
-			string row_table = values[1];
-			string row_type = values[2];
-			string row_approx_rows = values[3];
-			string col_name = values[4];
-			string col_id_str = values[5];
-			string type_name = values[6];
-			string max_len_str = values[7];
-			string prec_str = values[8];
-			string scale_str = values[9];
-			string nullable_str = values[10];
-			string collation = values[11];
-
-			// Apply table filter
-			if (filter_ && !filter_->MatchesTable(row_table)) {
+			const auto &unit = units[unit_idx];
+			vector<MSSQLTableMetadata> tables;
+			try {
+				LoadBulkUnit(connection, unit, database_collation, tables);
+			} catch (...) {
+				std::lock_guard<std::mutex> error_lock(error_mutex);
+				if (!first_error) {
+					first_error = std::current_exception();
+				}
+				failed.store(true);
 				return;
 			}
 
-			// New table group?
-			if (row_table != current_table) {
-				current_table = row_table;
-
-				auto &tables = schema.tables;
-				auto table_it = tables.find(current_table);
-				if (table_it == tables.end()) {
-					MSSQLTableMetadata table_meta;
-					table_meta.name = current_table;
-
-					// Object type
-					if (!row_type.empty() && row_type[0] == 'V') {
-						table_meta.object_type = MSSQLObjectType::VIEW;
-					} else {
-						table_meta.object_type = MSSQLObjectType::TABLE;
-					}
-
-					// Approximate row count
-					try {
-						table_meta.approx_row_count = static_cast<idx_t>(std::stoll(row_approx_rows));
-					} catch (...) {
-						table_meta.approx_row_count = 0;
-					}
-					// Physical shape from the same aggregated subquery (see the header):
-					// values[12] is sys.indexes.type — 1 clustered rowstore, 5
-					// clustered COLUMNSTORE, 0 heap — and partition_count > 1 marks
-					// a partitioned object. Both drive the write path's TABLOCK and
-					// sort decisions.
-					ParseTableShape(values, 12, 13, table_meta);
-
-					tables.emplace(current_table, std::move(table_meta));
-					table_it = tables.find(current_table);
-					schema_tables++;
+			// Merge this unit into the cache
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto schema_it = schemas_.find(unit.schema_name);
+			if (schema_it == schemas_.end()) {
+				schema_it = schemas_.emplace(unit.schema_name, MSSQLSchemaMetadata(unit.schema_name)).first;
+				schema_count++;
+			}
+			auto &schema_tables = schema_it->second.tables;
+			for (auto &table_meta : tables) {
+				column_count += table_meta.columns.size();
+				auto table_it = schema_tables.find(table_meta.name);
+				if (table_it == schema_tables.end()) {
+					string name = table_meta.name;
+					schema_tables.emplace(std::move(name), std::move(table_meta));
 					table_count++;
 				} else {
 					// Table already exists (e.g. columns loaded by a prior single-table query).
-					// Clear columns to avoid duplicates, since we're reloading from bulk query.
-					table_it->second.columns.clear();
+					// Replace its columns; the version moves with them.
+					table_it->second.columns = std::move(table_meta.columns);
+					table_it->second.object_id = table_meta.object_id;
+					table_it->second.modify_date = std::move(table_meta.modify_date);
 				}
-				current_table_meta = &table_it->second;
-			}
-
-			// Parse column info
-			int32_t col_id = 0;
-			try {
-				col_id = static_cast<int32_t>(std::stoi(col_id_str));
-			} catch (...) {
 			}
-			int16_t max_len = 0;
-			try {
-				max_len = static_cast<int16_t>(std::stoi(max_len_str));
-			} catch (...) {
-			}
-			uint8_t prec = 0;
+			CACHE_DEBUG(1, "BulkLoadAll: schema '%s' shard %llu/%llu — %zu tables", unit.schema_name.c_str(),
+						(unsigned long long)unit.shard + 1, (unsigned long long)unit.shard_count, tables.size());
+		}
+	};
+
+	// The extra connections are taken only if the pool has them to spare right
+	// now (idle, or under mssql_connection_limit); the preload never waits for one
+	idx_t worker_count = MinValue<idx_t>(max_connections, units.size());
+	vector<std::thread> workers;
+	for (idx_t i = 1; i < worker_count; i++) {
+		workers.emplace_back([&]() {
+			std::shared_ptr<tds::TdsConnection> connection;
 			try {
-				prec = static_cast<uint8_t>(std::stoi(prec_str));
+				connection = pool.Acquire(0);
 			} catch (...) {
+				connection = nullptr;
 			}
-			uint8_t scl = 0;
-			try {
-				scl = static_cast<uint8_t>(std::stoi(scale_str));
-			} catch (...) {
+			if (!connection) {
+				return;	 // the other workers pick up its units
 			}
-			bool nullable = (nullable_str == "1" || nullable_str == "true" || nullable_str == "True");
-
-			MSSQLColumnInfo col_info(col_name, col_id, type_name, max_len, prec, scl, nullable, collation,
-									 database_collation_);
-			current_table_meta->columns.push_back(std::move(col_info));
-			schema_columns++;
-			column_count++;
+			run_worker(*connection);
+			pool.Release(std::move(connection));
 		});
+	}
+	run_worker(*first_connection);
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	pool.Release(std::move(first_connection));
 
-		CACHE_DEBUG(1, "BulkLoadAll: schema '%s' — %llu tables, %llu columns", target_schema.c_str(),
-					(unsigned long long)schema_tables, (unsigned long long)schema_columns);
+	if (first_error) {
+		std::rethrow_exception(first_error);
 	}
 
+	std::lock_guard<std::mutex> lock(mutex_);
+
 	// Mark all load states as LOADED
 	auto now = std::chrono::steady_clock::now();
 	schemas_load_state_ = CacheLoadState::LOADED;
@@ -1073,9 +1235,10 @@ void MSSQLMetadataCache::EnsureTablesLoaded(tds::TdsConnection &connection, cons
 		query += "\nORDER BY o.name";
 
 		ExecuteMetadataQuery(connection, query, [&schema](const vector<string> &values) {
-			// 5 columns: object_name, object_type, approx_rows, index_id,
-			// partition_count. Guard the LAST index read, not the first.
-			if (values.size() >= 5) {
+			// 7 columns: object_name, object_type, approx_rows, index_id,
+			// partition_count, object_id, modify_date. Guard the LAST index read,
+			// not the first.
+			if (values.size() >= 7) {
 				MSSQLTableMetadata table_meta;
 				table_meta.name = values[0];
 
@@ -1099,6 +1262,7 @@ void MSSQLMetadataCache::EnsureTablesLoaded(tds::TdsConnection &connection, cons
 				// COLUMNSTORE, 0 heap — and partition_count > 1 marks a partitioned
 				// object. Both drive the write path's TABLOCK and sort decisions.
 				ParseTableShape(values, 3, 4, table_meta);
+				ParseTableVersion(values, 5, 6, table_meta);
 
 				// Note: columns NOT loaded (columns_load_state = NOT_LOADED by default)
 				schema.tables.emplace(table_meta.name, std::move(table_meta));
@@ -1200,6 +1364,341 @@ CacheLoadState MSSQLMetadataCache::GetColumnsState(const string &schema_name, co
 	return table_it->second.columns_load_state;
 }
 
+//===----------------------------------------------------------------------===//
+// Catalog Snapshot
+//===----------------------------------------------------------------------===//
+
+bool MSSQLMetadataCache::LoadSnapshot(tds::TdsConnection &connection, const string &path, const string &key) {
+	MSSQLCatalogSnapshot snapshot;
+	if (!MSSQLReadCatalogSnapshot(path, snapshot)) {
+		CACHE_DEBUG(1, "LoadSnapshot('%s') — no usable snapshot", path.c_str());
+		return false;
+	}
+	if (snapshot.key != key) {
+		CACHE_DEBUG(1, "LoadSnapshot('%s') — written for another attachment", path.c_str());
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	// The snapshot, shaped as the cache it was written from
+	unordered_map<string, MSSQLSchemaMetadata> previous;
+	for (const auto &table : snapshot.tables) {
+		auto schema_it = previous.find(table.schema_name);
+		if (schema_it == previous.end()) {
+			schema_it = previous.emplace(table.schema_name, MSSQLSchemaMetadata(table.schema_name)).first;
+		}
+		MSSQLTableMetadata table_meta;
+		table_meta.name = table.name;
+		table_meta.object_id = table.object_id;
+		table_meta.modify_date = table.modify_date;
+		for (const auto &column : table.columns) {
+			table_meta.columns.emplace_back(column.name, column.column_id, column.type_name, column.max_length,
+											column.precision, column.scale, column.is_nullable,
+											column.collation_name, database_collation_);
+		}
+		table_meta.columns_load_state = CacheLoadState::LOADED;
+		schema_it->second.tables.emplace(table.name, std::move(table_meta));
+	}
+
+	string fingerprint = QueryCatalogFingerprint(connection);
+	idx_t reused = 0;
+	idx_t reloaded = 0;
+	ReconcileLocked(connection, previous, nullptr, reused, reloaded);
+	catalog_fingerprint_ = fingerprint;
+
+	CACHE_DEBUG(1, "LoadSnapshot('%s') — %zu schemas, %llu tables from snapshot, %llu reloaded", path.c_str(),
+				schemas_.size(), (unsigned long long)reused, (unsigned long long)reloaded);
+	return true;
+}
+
+bool MSSQLMetadataCache::SaveSnapshot(const string &path, const string &key) const {
+	MSSQLCatalogSnapshot snapshot;
+	snapshot.key = key;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (const auto &schema_pair : schemas_) {
+			for (const auto &table_pair : schema_pair.second.tables) {
+				const auto &table_meta = table_pair.second;
+				// Without a version the entry could never be validated on load
+				if (table_meta.columns_load_state != CacheLoadState::LOADED || table_meta.columns.empty() ||
+					table_meta.object_id == 0 || table_meta.modify_date.empty()) {
+					continue;
+				}
+				MSSQLSnapshotTable table;
+				table.schema_name = schema_pair.first;
+				table.name = table_pair.first;
+				table.object_id = table_meta.object_id;
+				table.modify_date = table_meta.modify_date;
+				for (const auto &col : table_meta.columns) {
+					MSSQLSnapshotColumn column;
+					column.name = col.name;
+					column.column_id = col.column_id;
+					column.type_name = col.sql_type_name;
+					column.max_length = col.max_length;
+					column.precision = col.precision;
+					column.scale = col.scale;
+					column.is_nullable = col.is_nullable;
+					column.collation_name = col.collation_name;
+					table.columns.push_back(std::move(column));
+				}
+				snapshot.tables.push_back(std::move(table));
+			}
+		}
+	}
+	if (snapshot.tables.empty()) {
+		// Keep whatever an earlier session wrote rather than replacing it with nothing
+		return false;
+	}
+	bool written = MSSQLWriteCatalogSnapshot(path, snapshot);
+	CACHE_DEBUG(1, "SaveSnapshot('%s') — %zu tables%s", path.c_str(), snapshot.tables.size(),
+				written ? "" : " — write FAILED");
+	return written;
+}
+
+//===----------------------------------------------------------------------===//
+// Delta Refresh
+//===----------------------------------------------------------------------===//
+
+bool MSSQLMetadataCache::DeltaRefreshDue(int64_t margin_seconds) const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return DeltaRefreshDueLocked(margin_seconds);
+}
+
+bool MSSQLMetadataCache::DeltaRefreshDueLocked(int64_t margin_seconds) const {
+	int64_t ttl = ttl_seconds_.load();
+	if (ttl <= 0 || schemas_load_state_ != CacheLoadState::LOADED) {
+		return false;
+	}
+	auto elapsed =
+		std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - schemas_last_refresh_)
+			.count();
+	return elapsed >= ttl - margin_seconds;
+}
+
+bool MSSQLMetadataCache::DeltaRefresh(tds::TdsConnection &connection, MSSQLCatalogDelta &delta,
+									  int64_t margin_seconds) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (!DeltaRefreshDueLocked(margin_seconds)) {
+		return false;  // another lookup, or the background refresh, got here first
+	}
+
+	string fingerprint = QueryCatalogFingerprint(connection);
+	if (!catalog_fingerprint_.empty() && fingerprint == catalog_fingerprint_) {
+		// Nothing created, altered or dropped since the last listing: restart the TTL clock
+		auto now = std::chrono::steady_clock::now();
+		for (auto &schema_pair : schemas_) {
+			if (schema_pair.second.tables_load_state == CacheLoadState::LOADED) {
+				schema_pair.second.tables_last_refresh = now;
+			}
+			for (auto &table_pair : schema_pair.second.tables) {
+				if (table_pair.second.columns_load_state == CacheLoadState::LOADED) {
+					table_pair.second.columns_last_refresh = now;
+				}
+			}
+		}
+		schemas_last_refresh_ = now;
+		last_refresh_ = now;
+		CACHE_DEBUG(1, "DeltaRefresh — catalog unchanged (%s)", fingerprint.c_str());
+		return true;
+	}
+
+	idx_t reused = 0;
+	idx_t reloaded = 0;
+	ReconcileLocked(connection, schemas_, &delta, reused, reloaded);
+	catalog_fingerprint_ = fingerprint;
+
+	CACHE_DEBUG(1, "DeltaRefresh — %zu schemas, %llu tables kept, %llu reloaded, %zu tables and %zu schemas changed",
+				schemas_.size(), (unsigned long long)reused, (unsigned long long)reloaded, delta.tables.size(),
+				delta.schemas.size());
+	return true;
+}
+
+string MSSQLMetadataCache::QueryCatalogFingerprint(tds::TdsConnection &connection) {
+	string fingerprint;
+	ExecuteMetadataQuery(connection, CATALOG_FINGERPRINT_SQL,
+						 [&fingerprint](const vector<string> &values) { fingerprint = StringUtil::Join(values, ":"); });
+	return fingerprint;
+}
+
+void MSSQLMetadataCache::ReconcileLocked(tds::TdsConnection &connection,
+										 const unordered_map<string, MSSQLSchemaMetadata> &previous,
+										 MSSQLCatalogDelta *delta, idx_t &reused, idx_t &reloaded) {
+	string sql = CATALOG_LISTING_SQL;
+	if (filter_ && filter_->HasSchemaFilter()) {
+		string like_clause = MSSQLCatalogFilter::TryRegexToSQLLike(filter_->GetSchemaPattern(), "s.name");
+		if (!like_clause.empty()) {
+			sql += " AND " + like_clause;
+		}
+	}
+	sql += "\nORDER BY s.name, o.name";
+
+	// Built aside and swapped in at the end: a failed query leaves the cache as it was.
+	// `previous` may BE schemas_ (delta refresh), so it is only read until the swap.
+	unordered_map<string, MSSQLSchemaMetadata> schemas;
+	unordered_map<int64_t, MSSQLTableMetadata *> changed;
+	auto report_table = [delta](const string &schema_name, const string &table_name) {
+		if (delta) {
+			delta->tables.emplace_back(schema_name, table_name);
+		}
+	};
+
+	ExecuteMetadataQuery(connection, sql, [&](const vector<string> &values) {
+		// 8 columns: schema, object, type, approx_rows, index_type,
+		// partition_count, object_id, modify_date. Guard the LAST index read.
+		if (values.size() < 8) {
+			return;
+		}
+		const string &schema_name = values[0];
+		auto schema_it = schemas.find(schema_name);
+		if (schema_it == schemas.end()) {
+			schema_it = schemas.emplace(schema_name, MSSQLSchemaMetadata(schema_name)).first;
+		}
+		const string &table_name = values[1];
+		if (table_name.empty()) {
+			return;	 // schema without tables or views
+		}
+		if (filter_ && !filter_->MatchesTable(table_name)) {
+			return;
+		}
+
+		MSSQLTableMetadata table_meta;
+		table_meta.name = table_name;
+		table_meta.object_type =
+			(!values[2].empty() && values[2][0] == 'V') ? MSSQLObjectType::VIEW : MSSQLObjectType::TABLE;
+		try {
+			table_meta.approx_row_count = static_cast<idx_t>(std::stoll(values[3]));
+		} catch (...) {
+			table_meta.approx_row_count = 0;
+		}
+		ParseTableShape(values, 4, 5, table_meta);
+		ParseTableVersion(values, 6, 7, table_meta);
+
+		auto &slot = schema_it->second.tables.emplace(table_name, std::move(table_meta)).first->second;
+
+		auto previous_schema = previous.find(schema_name);
+		if (previous_schema == previous.end()) {
+			return;	 // new schema, reported as a whole below
+		}
+		auto previous_table = previous_schema->second.tables.find(table_name);
+		if (previous_table == previous_schema->second.tables.end()) {
+			// Created since, or never listed: a negative lookup may be cached for it
+			report_table(schema_name, table_name);
+			return;
+		}
+		const MSSQLTableMetadata &cached = previous_table->second;
+		if (cached.object_id == slot.object_id && cached.modify_date == slot.modify_date && !slot.modify_date.empty()) {
+			if (cached.columns_load_state == CacheLoadState::LOADED) {
+				slot.columns = cached.columns;
+				slot.columns_load_state = CacheLoadState::LOADED;
+				reused++;
+			}
+			return;
+		}
+		report_table(schema_name, table_name);
+		if (cached.columns_load_state == CacheLoadState::LOADED) {
+			// Somebody used it: reload now rather than on the next bind. Never loaded: stays lazy.
+			changed[slot.object_id] = &slot;
+		}
+	});
+
+	// Dropped (or renamed away) since `previous`
+	if (delta) {
+		for (const auto &schema_pair : previous) {
+			auto schema_it = schemas.find(schema_pair.first);
+			if (schema_it == schemas.end()) {
+				delta->schemas.push_back(schema_pair.first);
+				continue;
+			}
+			for (const auto &table_pair : schema_pair.second.tables) {
+				if (schema_it->second.tables.find(table_pair.first) == schema_it->second.tables.end()) {
+					report_table(schema_pair.first, table_pair.first);
+				}
+			}
+		}
+		for (const auto &schema_pair : schemas) {
+			if (previous.find(schema_pair.first) == previous.end()) {
+				delta->schemas.push_back(schema_pair.first);
+			}
+		}
+	}
+
+	// Reload the columns of what changed, a batch of object_ids per query
+	vector<int64_t> changed_ids;
+	for (const auto &entry : changed) {
+		changed_ids.push_back(entry.first);
+	}
+	for (idx_t start = 0; start < changed_ids.size(); start += COLUMNS_BY_OBJECT_ID_BATCH) {
+		string id_list;
+		for (idx_t i = start; i < changed_ids.size() && i < start + COLUMNS_BY_OBJECT_ID_BATCH; i++) {
+			if (!id_list.empty()) {
+				id_list += ", ";
+			}
+			id_list += std::to_string(changed_ids[i]);
+		}
+		string query = StringUtil::Format(COLUMNS_BY_OBJECT_ID_SQL_TEMPLATE, id_list);
+		ExecuteMetadataQuery(connection, query, [&](const vector<string> &values) {
+			if (values.size() < 9) {
+				return;
+			}
+			int64_t object_id = 0;
+			try {
+				object_id = static_cast<int64_t>(std::stoll(values[0]));
+			} catch (...) {
+				return;
+			}
+			auto table_it = changed.find(object_id);
+			if (table_it == changed.end()) {
+				return;
+			}
+			int32_t col_id = 0;
+			try {
+				col_id = static_cast<int32_t>(std::stoi(values[2]));
+			} catch (...) {
+			}
+			int16_t max_len = 0;
+			try {
+				max_len = static_cast<int16_t>(std::stoi(values[4]));
+			} catch (...) {
+			}
+			uint8_t prec = 0;
+			try {
+				prec = static_cast<uint8_t>(std::stoi(values[5]));
+			} catch (...) {
+			}
+			uint8_t scl = 0;
+			try {
+				scl = static_cast<uint8_t>(std::stoi(values[6]));
+			} catch (...) {
+			}
+			bool nullable = (values[7] == "1" || values[7] == "true" || values[7] == "True");
+			table_it->second->columns.emplace_back(values[1], col_id, values[3], max_len, prec, scl, nullable,
+												   values[8], database_collation_);
+		});
+	}
+	for (auto &entry : changed) {
+		// An object dropped since the listing has no columns; let the lazy path find out
+		if (!entry.second->columns.empty()) {
+			entry.second->columns_load_state = CacheLoadState::LOADED;
+		}
+	}
+	reloaded = changed.size();
+
+	auto now = std::chrono::steady_clock::now();
+	for (auto &schema_pair : schemas) {
+		schema_pair.second.tables_load_state = CacheLoadState::LOADED;
+		schema_pair.second.tables_last_refresh = now;
+		for (auto &table_pair : schema_pair.second.tables) {
+			table_pair.second.columns_last_refresh = now;
+		}
+	}
+	schemas_ = std::move(schemas);
+	schemas_load_state_ = CacheLoadState::LOADED;
+	schemas_last_refresh_ = now;
+	state_ = MSSQLCacheState::LOADED;
+	last_refresh_ = now;
+}
+
 //===----------------------------------------------------------------------===//
 // Internal Loading Methods
 //===----------------------------------------------------------------------===//
@@ -1240,9 +1739,10 @@ void MSSQLMetadataCache::LoadTables(tds::TdsConnection &connection, const string
 	auto &schema_meta = schemas_[schema_name];
 
 	ExecuteMetadataQuery(connection, query, [&schema_meta](const vector<string> &values) {
-		// 5 columns: object_name, object_type, approx_rows, index_id,
-		// partition_count. Guard the LAST index read, not the first.
-		if (values.size() >= 5) {
+		// 7 columns: object_name, object_type, approx_rows, index_id,
+		// partition_count, object_id, modify_date. Guard the LAST index read,
+		// not the first.
+		if (values.size() >= 7) {
 			MSSQLTableMetadata table_meta;
 			table_meta.name = values[0];
 
@@ -1267,6 +1767,7 @@ void MSSQLMetadataCache::LoadTables(tds::TdsConnection &connection, const string
 			// COLUMNSTORE, 0 heap — and partition_count > 1 marks a partitioned
 			// object. Both drive the write path's TABLOCK and sort decisions.
 			ParseTableShape(values, 3, 4, table_meta);
+			ParseTableVersion(values, 5, 6, table_meta);
 
 			schema_meta.tables[table_meta.name] = std::move(table_meta);
 		}
@@ -0,0 +1,211 @@
+// MSSQL Partition Scheme Discovery Implementation
+// Partition-aligned parallel scan: which partition function splits a table,
+// on which column, and (when the ordering is portable) at which boundaries.
+
+#include "catalog/mssql_partition_info.hpp"
+#include <cstdlib>
+#include "catalog/mssql_column_info.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "query/mssql_simple_query.hpp"
+
+// Debug logging controlled by MSSQL_DEBUG environment variable
+static int GetPartitionDebugLevel() {
+	static const int level = []() {
+		const char *env = std::getenv("MSSQL_DEBUG");
+		return env ? std::atoi(env) : 0;
+	}();
+	return level;
+}
+
+#define MSSQL_PARTITION_DEBUG(fmt, ...)                                    \
+	do {                                                                   \
+		if (GetPartitionDebugLevel() >= 1) {                               \
+			fprintf(stderr, "[MSSQL PARTITION] " fmt "\n", ##__VA_ARGS__); \
+		}                                                                  \
+	} while (0)
+
+namespace duckdb {
+namespace mssql {
+
+//===----------------------------------------------------------------------===//
+// SQL Queries for Partition Scheme Discovery
+//===----------------------------------------------------------------------===//
+
+// Partition function and partitioning column of the heap (index_id 0) or
+// clustered index (index_id 1) — exactly one of them exists per table.
+// Parameters: %s = [schema].[table] fully qualified name
+static const char *PARTITION_SCHEME_SQL_TEMPLATE = R"(
+SELECT TOP 1
+    pf.function_id,
+    pf.name AS function_name,
+    CAST(pf.boundary_value_on_right AS INT) AS range_right,
+    pf.fanout,
+    c.name AS column_name,
+    t.name AS type_name,
+    c.max_length,
+    c.precision,
+    c.scale
+FROM sys.indexes i
+JOIN sys.partition_schemes ps
+    ON ps.data_space_id = i.data_space_id
+JOIN sys.partition_functions pf
+    ON pf.function_id = ps.function_id
+JOIN sys.index_columns ic
+    ON ic.object_id = i.object_id
+    AND ic.index_id = i.index_id
+    AND ic.partition_ordinal = 1
+JOIN sys.columns c
+    ON c.object_id = ic.object_id
+    AND c.column_id = ic.column_id
+JOIN sys.types t
+    ON c.system_type_id = t.user_type_id AND t.system_type_id = t.user_type_id
+WHERE i.object_id = OBJECT_ID('%s')
+    AND i.index_id IN (0, 1)
+)";
+
+// Boundary values in ascending order. %s renders the sql_variant `prv.value`
+// as text DuckDB can cast back; %llu is the function_id.
+static const char *PARTITION_BOUNDARIES_SQL_TEMPLATE = R"(
+SELECT %s
+FROM sys.partition_range_values prv
+WHERE prv.function_id = %llu
+ORDER BY prv.boundary_id
+)";
+
+//===----------------------------------------------------------------------===//
+// Boundary rendering
+//===----------------------------------------------------------------------===//
+
+enum class BoundaryKind { NONE, EXACT_NUMERIC, DATE, DATETIME };
+
+// Only types whose DuckDB ordering is SQL Server's ordering qualify. Strings
+// compare under a collation, uniqueidentifier by byte group, float boundaries
+// do not survive a text round trip exactly, and money's default text style
+// rounds to two places — pruning on any of those would be a guess.
+static BoundaryKind ClassifyBoundaryType(const string &type_name) {
+	const auto lower = StringUtil::Lower(type_name);
+	if (lower == "tinyint" || lower == "smallint" || lower == "int" || lower == "bigint" || lower == "decimal" ||
+		lower == "numeric") {
+		return BoundaryKind::EXACT_NUMERIC;
+	}
+	if (lower == "date") {
+		return BoundaryKind::DATE;
+	}
+	if (lower == "datetime" || lower == "datetime2" || lower == "smalldatetime") {
+		return BoundaryKind::DATETIME;
+	}
+	return BoundaryKind::NONE;
+}
+
+static const char *BoundaryExpression(BoundaryKind kind) {
+	switch (kind) {
+	case BoundaryKind::EXACT_NUMERIC:
+		return "CAST(prv.value AS NVARCHAR(64))";
+	case BoundaryKind::DATE:
+		return "CONVERT(NVARCHAR(10), CAST(prv.value AS DATE), 23)";
+	case BoundaryKind::DATETIME:
+		// Style 121 on datetime2(7): yyyy-mm-dd hh:mi:ss.fffffff, always 7 digits
+		return "CONVERT(NVARCHAR(27), CAST(prv.value AS DATETIME2(7)), 121)";
+	default:
+		return nullptr;
+	}
+}
+
+// Cast one rendered boundary to the column type. datetime2(7) maps to
+// TIMESTAMP_NS and keeps all seven digits; every other datetime maps to a
+// microsecond TIMESTAMP, so a boundary with a non-zero 100ns digit has no exact
+// DuckDB counterpart there and disables pruning for the whole function.
+static bool ParseBoundary(BoundaryKind kind, string text, const LogicalType &column_type, Value &out) {
+	if (text.empty()) {
+		return false;
+	}
+	if (kind == BoundaryKind::DATETIME && column_type.id() != LogicalTypeId::TIMESTAMP_NS) {
+		if (text.back() != '0') {
+			return false;
+		}
+		text.pop_back();
+	}
+	Value value(text);
+	if (!value.DefaultTryCastAs(column_type, true)) {
+		return false;
+	}
+	out = std::move(value);
+	return true;
+}
+
+//===----------------------------------------------------------------------===//
+// PartitionSchemeInfo Implementation
+//===----------------------------------------------------------------------===//
+
+static int64_t ParseInt(const string &text) {
+	try {
+		return std::stoll(text);
+	} catch (...) {
+		return 0;
+	}
+}
+
+PartitionSchemeInfo PartitionSchemeInfo::Discover(tds::TdsConnection &connection, const string &schema_name,
+												  const string &table_name) {
+	PartitionSchemeInfo info;
+
+	string full_name = "[" + schema_name + "].[" + table_name + "]";
+	MSSQL_PARTITION_DEBUG("Discovering partition scheme for %s", full_name.c_str());
+
+	const string object_literal = StringUtil::Replace(full_name, "'", "''");
+	auto scheme =
+		MSSQLSimpleQuery::Execute(connection, StringUtil::Format(PARTITION_SCHEME_SQL_TEMPLATE, object_literal));
+	if (scheme.HasError()) {
+		throw IOException("Partition scheme metadata query failed: %s", scheme.error_message);
+	}
+	if (!scheme.HasRows() || scheme.rows[0].size() < 9) {
+		MSSQL_PARTITION_DEBUG("%s is not on a partition scheme", full_name.c_str());
+		return info;
+	}
+
+	const auto &row = scheme.rows[0];
+	const auto function_id = static_cast<unsigned long long>(ParseInt(row[0]));
+	info.function_name = row[1];
+	info.range_right = ParseInt(row[2]) != 0;
+	info.partition_count = static_cast<idx_t>(ParseInt(row[3]));
+	info.column_name = row[4];
+	const string &type_name = row[5];
+	info.column_type =
+		MSSQLColumnInfo::MapSQLServerTypeToDuckDB(type_name, static_cast<int16_t>(ParseInt(row[6])),
+												  static_cast<uint8_t>(ParseInt(row[7])),
+												  static_cast<uint8_t>(ParseInt(row[8])));
+	info.exists = !info.function_name.empty() && !info.column_name.empty() && info.partition_count > 1;
+	if (!info.exists) {
+		return info;
+	}
+
+	const auto kind = ClassifyBoundaryType(type_name);
+	if (kind != BoundaryKind::NONE) {
+		char sql_buffer[512];
+		snprintf(sql_buffer, sizeof(sql_buffer), PARTITION_BOUNDARIES_SQL_TEMPLATE, BoundaryExpression(kind),
+				 function_id);
+		auto bounds = MSSQLSimpleQuery::Execute(connection, sql_buffer);
+		if (bounds.HasError()) {
+			throw IOException("Partition boundary metadata query failed: %s", bounds.error_message);
+		}
+		for (const auto &bound_row : bounds.rows) {
+			Value boundary;
+			if (bound_row.empty() || !ParseBoundary(kind, bound_row[0], info.column_type, boundary)) {
+				MSSQL_PARTITION_DEBUG("  boundary '%s' has no exact DuckDB value - pruning disabled",
+									  bound_row.empty() ? "" : bound_row[0].c_str());
+				info.boundaries.clear();
+				break;
+			}
+			info.boundaries.push_back(std::move(boundary));
+		}
+	}
+
+	MSSQL_PARTITION_DEBUG("%s: %llu partitions on [%s] by %s (RANGE %s), %zu cached boundaries", full_name.c_str(),
+						  (unsigned long long)info.partition_count, info.column_name.c_str(),
+						  info.function_name.c_str(), info.range_right ? "RIGHT" : "LEFT", info.boundaries.size());
+	return info;
+}
+
+}  // namespace mssql
+}  // namespace duckdb
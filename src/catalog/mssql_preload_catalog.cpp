@@ -4,6 +4,7 @@
 #include "catalog/mssql_preload_catalog.hpp"
 #include "catalog/mssql_catalog.hpp"
 #include "catalog/mssql_statistics.hpp"
+#include "connection/mssql_settings.hpp"
 #include "duckdb/common/vector/flat_vector.hpp"
 #include "duckdb/common/vector/string_vector.hpp"
 #include "mssql_storage.hpp"
@@ -116,24 +117,13 @@ static void MSSQLPreloadCatalogExecute(DataChunk &args, ExpressionState &state,
 			// Ensure cache settings are loaded
 			catalog.EnsureCacheLoaded(client_context);
 
-			// Acquire connection
-			auto connection = pool.Acquire();
-			if (!connection) {
-				throw IOException("mssql_preload_catalog: failed to acquire connection");
-			}
-
-			// Execute bulk preload (ensure connection is returned to pool even on exception)
+			// Execute bulk preload over up to mssql_catalog_preload_connections pooled
+			// connections (BulkLoadAll acquires and releases them)
 			idx_t schema_count = 0;
 			idx_t table_count = 0;
 			idx_t column_count = 0;
-			try {
-				cache.BulkLoadAll(*connection, bind_data.schema_name, schema_count, table_count, column_count);
-			} catch (...) {
-				pool.Release(std::move(connection));
-				throw;
-			}
-
-			pool.Release(std::move(connection));
+			auto max_connections = static_cast<idx_t>(LoadCatalogPreloadConnections(client_context));
+			cache.BulkLoadAll(pool, bind_data.schema_name, max_connections, schema_count, table_count, column_count);
 
 			// Pre-populate statistics cache with approx_row_count from bulk load
 			// This avoids per-table DMV queries when DuckDB calls GetStorageInfo()
@@ -111,6 +111,10 @@ PKColumnInfo PKColumnInfo::FromMetadata(const string &name, int32_t column_id, i
 	info.name = name;
 	info.column_id = column_id;
 	info.key_ordinal = key_ordinal;
+	info.type_name = type_name;
+	info.max_length = max_length;
+	info.precision = precision;
+	info.scale = scale;
 
 	// Use database collation as fallback for text types
 	if (collation_name.empty() && MSSQLColumnInfo::IsTextType(type_name)) {
@@ -1,5 +1,7 @@
 #include "catalog/mssql_statistics.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "query/mssql_simple_query.hpp"
+#include "table_scan/filter_encoder.hpp"
 
 #include <sstream>
 
@@ -21,6 +23,61 @@ WHERE s.name = '%s'
   AND p.index_id IN (0, 1)
 )";
 
+//===----------------------------------------------------------------------===//
+// SQL Batch for Column Statistics from the Histogram
+//===----------------------------------------------------------------------===//
+
+// Picks the newest unfiltered statistics object led by the column, copies its
+// histogram into @h and folds it to one row: the distinct count.
+// sys.dm_db_stats_histogram needs SQL Server 2016 SP1 CU2; the DBCC form fills
+// @h the same way on older servers. Parameters: object name, column name, the
+// statement filling @h.
+//
+// The histogram's bounds are deliberately not read. DuckDB prunes filters
+// against min/max as hard bounds, and any write after the fetch — through this
+// extension, mssql_exec or another client — would make them drop rows.
+static const char *COLUMN_STATS_SQL_TEMPLATE = R"(
+SET NOCOUNT ON;
+DECLARE @object_id int = OBJECT_ID(N'%s');
+DECLARE @stats_id int, @stats_name sysname;
+SELECT TOP (1) @stats_id = s.stats_id, @stats_name = s.name
+FROM sys.stats s
+INNER JOIN sys.stats_columns sc ON sc.object_id = s.object_id AND sc.stats_id = s.stats_id AND sc.stats_column_id = 1
+INNER JOIN sys.columns c ON c.object_id = sc.object_id AND c.column_id = sc.column_id
+CROSS APPLY sys.dm_db_stats_properties(s.object_id, s.stats_id) sp
+WHERE s.object_id = @object_id AND s.has_filter = 0 AND c.name = N'%s'
+ORDER BY sp.last_updated DESC;
+DECLARE @h TABLE (range_high_key sql_variant, range_rows float, equal_rows float,
+                  distinct_range_rows float, average_range_rows float);
+IF @stats_id IS NOT NULL
+BEGIN
+  %s
+  SELECT CAST(ISNULL(SUM(CASE WHEN h.range_high_key IS NULL THEN 0 ELSE h.distinct_range_rows + 1 END), 0) AS bigint)
+  FROM @h h;
+END
+)";
+
+static const char *HISTOGRAM_DMV_SQL =
+	"INSERT INTO @h SELECT range_high_key, range_rows, equal_rows, distinct_range_rows, average_range_rows "
+	"FROM sys.dm_db_stats_histogram(@object_id, @stats_id);";
+
+static const char *HISTOGRAM_DBCC_SQL =
+	"INSERT INTO @h EXEC (N'DBCC SHOW_STATISTICS (''' + REPLACE(QUOTENAME(OBJECT_SCHEMA_NAME(@object_id)) + N'.' + "
+	"QUOTENAME(OBJECT_NAME(@object_id)), N'''', N'''''') + N''', ' + QUOTENAME(@stats_name) + "
+	"N') WITH HISTOGRAM, NO_INFOMSGS');";
+
+// Replace ' with '' for a T-SQL string literal
+static string EscapeStringLiteral(const string &value) {
+	string result;
+	for (char c : value) {
+		result += c;
+		if (c == '\'') {
+			result += c;
+		}
+	}
+	return result;
+}
+
 MSSQLStatisticsProvider::MSSQLStatisticsProvider(int64_t cache_ttl_seconds) : cache_ttl_seconds_(cache_ttl_seconds) {}
 
 //===----------------------------------------------------------------------===//
@@ -42,12 +99,11 @@ idx_t MSSQLStatisticsProvider::GetRowCount(tds::TdsConnection &connection, const
 	// Fetch fresh statistics
 	idx_t row_count = FetchRowCount(connection, schema_name, table_name);
 
-	// Update cache
-	MSSQLTableStatistics stats;
+	// Update cache (column statistics already fetched keep their own age)
+	auto &stats = cache_[key];
 	stats.row_count = row_count;
 	stats.fetched_at = std::chrono::steady_clock::now();
 	stats.is_valid = true;
-	cache_[key] = stats;
 
 	return row_count;
 }
@@ -68,6 +124,79 @@ unique_ptr<BaseStatistics> MSSQLStatisticsProvider::GetTableStatistics(tds::TdsC
 	return stats;
 }
 
+unique_ptr<BaseStatistics> MSSQLStatisticsProvider::GetColumnStatistics(tds::TdsConnection &connection,
+																		const string &schema_name,
+																		const string &table_name,
+																		const string &column_name,
+																		const LogicalType &type, bool is_nullable,
+																		int64_t level, bool use_dbcc) {
+	// Only the distinct count needs the histogram; NOT NULL is known from the catalog
+	MSSQLColumnStatistics column;
+	if (level >= 2) {
+		const auto key = BuildCacheKey(schema_name, table_name);
+		bool cached = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto &columns = cache_[key].columns;
+			auto it = columns.find(column_name);
+			if (it != columns.end() && IsCacheValid(it->second)) {
+				column = it->second;
+				cached = true;
+			}
+		}
+		if (!cached) {
+			// The round trip runs outside the lock: it happens for every column of
+			// every scan being optimized, and other queries must not queue behind
+			// it. Two callers may fetch the same column at once; the later insert
+			// simply wins.
+			column = FetchColumnStatistics(connection, schema_name, table_name, column_name, use_dbcc);
+			column.fetched_at = std::chrono::steady_clock::now();
+			std::lock_guard<std::mutex> lock(mutex_);
+			cache_[key].columns[column_name] = column;
+		}
+	}
+	return BuildColumnStatistics(column, type, is_nullable);
+}
+
+bool MSSQLStatisticsProvider::TryGetCachedColumnStatistics(const string &schema_name, const string &table_name,
+														   const string &column_name, const LogicalType &type,
+														   bool is_nullable, int64_t level,
+														   unique_ptr<BaseStatistics> &out) {
+	MSSQLColumnStatistics column;
+	if (level >= 2) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto table = cache_.find(BuildCacheKey(schema_name, table_name));
+		if (table == cache_.end()) {
+			return false;
+		}
+		auto it = table->second.columns.find(column_name);
+		if (it == table->second.columns.end() || !IsCacheValid(it->second)) {
+			return false;
+		}
+		column = it->second;
+	}
+	out = BuildColumnStatistics(column, type, is_nullable);
+	return true;
+}
+
+unique_ptr<BaseStatistics> MSSQLStatisticsProvider::BuildColumnStatistics(const MSSQLColumnStatistics &column,
+																		  const LogicalType &type, bool is_nullable) {
+	if (!column.found && is_nullable) {
+		return nullptr;
+	}
+
+	// No min/max: they would be hard bounds for filter pruning, and any write
+	// after the fetch makes them unsound
+	auto stats = make_uniq<BaseStatistics>(BaseStatistics::CreateUnknown(type));
+	if (!is_nullable) {
+		stats->Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+	}
+	if (column.distinct_count > 0) {
+		stats->SetDistinctCount(column.distinct_count);
+	}
+	return stats;
+}
+
 void MSSQLStatisticsProvider::InvalidateTable(const string &schema_name, const string &table_name) {
 	std::lock_guard<std::mutex> lock(mutex_);
 
@@ -97,11 +226,10 @@ void MSSQLStatisticsProvider::InvalidateAll() {
 void MSSQLStatisticsProvider::PreloadRowCount(const string &schema_name, const string &table_name, idx_t row_count) {
 	std::lock_guard<std::mutex> lock(mutex_);
 	auto key = BuildCacheKey(schema_name, table_name);
-	MSSQLTableStatistics stats;
+	auto &stats = cache_[key];
 	stats.row_count = row_count;
 	stats.fetched_at = std::chrono::steady_clock::now();
 	stats.is_valid = true;
-	cache_[key] = stats;
 }
 
 bool MSSQLStatisticsProvider::TryGetCachedRowCount(const string &schema_name, const string &table_name,
@@ -150,6 +278,18 @@ bool MSSQLStatisticsProvider::IsCacheValid(const MSSQLTableStatistics &stats) co
 	return age < cache_ttl_seconds_;
 }
 
+bool MSSQLStatisticsProvider::IsCacheValid(const MSSQLColumnStatistics &stats) const {
+	// TTL of 0 means no caching (always fetch fresh)
+	if (cache_ttl_seconds_ <= 0) {
+		return false;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+	auto age = std::chrono::duration_cast<std::chrono::seconds>(now - stats.fetched_at).count();
+
+	return age < cache_ttl_seconds_;
+}
+
 idx_t MSSQLStatisticsProvider::FetchRowCount(tds::TdsConnection &connection, const string &schema_name,
 											 const string &table_name) {
 	// Escape single quotes in schema/table names to prevent SQL injection
@@ -187,4 +327,34 @@ idx_t MSSQLStatisticsProvider::FetchRowCount(tds::TdsConnection &connection, con
 	}
 }
 
+MSSQLColumnStatistics MSSQLStatisticsProvider::FetchColumnStatistics(tds::TdsConnection &connection,
+																	  const string &schema_name,
+																	  const string &table_name,
+																	  const string &column_name, bool use_dbcc) {
+	const string object_name = "[" + mssql::FilterEncoder::EscapeBracketIdentifier(schema_name) + "].[" +
+							   mssql::FilterEncoder::EscapeBracketIdentifier(table_name) + "]";
+	auto build_sql = [&](const char *fill_histogram) {
+		return StringUtil::Format(COLUMN_STATS_SQL_TEMPLATE, EscapeStringLiteral(object_name),
+								  EscapeStringLiteral(column_name), fill_histogram);
+	};
+
+	MSSQLColumnStatistics stats;
+	auto result = MSSQLSimpleQuery::Execute(connection, build_sql(HISTOGRAM_DMV_SQL));
+	if (result.HasError() && use_dbcc) {
+		// Before 2016 SP1 CU2 the histogram is only reachable through DBCC
+		result = MSSQLSimpleQuery::Execute(connection, build_sql(HISTOGRAM_DBCC_SQL));
+	}
+	if (result.HasError() || result.rows.empty() || result.rows[0].empty()) {
+		return stats;
+	}
+
+	try {
+		stats.distinct_count = static_cast<idx_t>(std::stoull(result.rows[0][0]));
+	} catch (...) {
+		return stats;
+	}
+	stats.found = true;
+	return stats;
+}
+
 }  // namespace duckdb
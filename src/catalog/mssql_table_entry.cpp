@@ -5,6 +5,7 @@
 #include "catalog/mssql_schema_entry.hpp"
 #include "catalog/mssql_statistics.hpp"
 #include "connection/mssql_connection_provider.hpp"
+#include "connection/mssql_settings.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/common.hpp"	 // For COLUMN_IDENTIFIER_ROW_ID
 #include "duckdb/common/exception.hpp"
@@ -70,7 +71,8 @@ MSSQLTableEntry::MSSQLTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, c
 						}()),
 	  mssql_columns_(metadata.columns),
 	  object_type_(metadata.object_type),
-	  approx_row_count_(metadata.approx_row_count) {}
+	  approx_row_count_(metadata.approx_row_count),
+	  partition_count_(metadata.partition_count) {}
 
 MSSQLTableEntry::~MSSQLTableEntry() = default;
 
@@ -149,6 +151,20 @@ TableFunction MSSQLTableEntry::GetScanFunction(ClientContext &context, unique_pt
 		}
 	}
 
+	// Partition-aligned scan: hand the partition scheme to the scan so
+	// ComplexFilterPushdown can narrow the partitioning column and InitGlobal
+	// can prune and split by partition. Cached on the entry after first use.
+	const auto &partition_info = GetPartitionInfo(context);
+	if (partition_info.exists) {
+		for (idx_t i = 0; i < mssql_columns_.size(); i++) {
+			if (mssql_columns_[i].name == partition_info.column_name) {
+				catalog_bind_data->partition_info = partition_info;
+				catalog_bind_data->partition_column_index = i;
+				break;
+			}
+		}
+	}
+
 	MSSQL_TE_DEBUG("GetScanFunction: table=%s.%s with %zu columns (projection deferred to InitGlobal)",
 				   mssql_schema.name.c_str(), name.c_str(), mssql_columns_.size());
 
@@ -158,9 +174,49 @@ TableFunction MSSQLTableEntry::GetScanFunction(ClientContext &context, unique_pt
 }
 
 unique_ptr<BaseStatistics> MSSQLTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
-	// We don't have detailed column-level statistics from SQL Server
-	// Table-level cardinality is provided via GetStorageInfo
-	return nullptr;
+	// Table-level cardinality is provided via GetStorageInfo; column statistics
+	// (NOT NULL, and distinct counts from SQL Server's histograms) are exported
+	// when mssql_statistics_level asks for them
+	auto config = LoadStatisticsConfig(context);
+	if (!config.enabled || config.level < 1 || column_id >= mssql_columns_.size()) {
+		return nullptr;
+	}
+	const auto &column = mssql_columns_[column_id];
+	// The type the scan reports for the column (see GetScanFunction)
+	const auto type = MSSQLReportsNativeTypes(catalog) ? column.NativeDuckDBType() : column.duckdb_type;
+
+	auto &mssql_catalog = GetMSSQLCatalog();
+	auto &stats_provider = mssql_catalog.GetStatisticsProvider();
+	stats_provider.SetCacheTTL(config.cache_ttl_seconds);
+	const auto schema_name = GetMSSQLSchema().name.GetIdentifierName();
+	const auto table_name = name.GetIdentifierName();
+	// Level 1 and cache hits need no connection. The optimizer asks for every
+	// column of every scan, so a pool round trip here is not free even when idle.
+	unique_ptr<BaseStatistics> stats;
+	if (stats_provider.TryGetCachedColumnStatistics(schema_name, table_name, column.name, type, column.is_nullable,
+													config.level, stats)) {
+		return stats;
+	}
+	try {
+		auto &pool = mssql_catalog.GetConnectionPool();
+		auto connection = pool.Acquire();
+		if (!connection) {
+			return nullptr;
+		}
+		// Released before the outer catch, as in GetStorageInfo
+		try {
+			stats = stats_provider.GetColumnStatistics(*connection, schema_name, table_name, column.name, type,
+													   column.is_nullable, config.level, config.use_dbcc);
+		} catch (...) {
+			pool.Release(std::move(connection));
+			throw;
+		}
+		pool.Release(std::move(connection));
+		return stats;
+	} catch (...) {
+		MSSQL_TE_DEBUG("GetStatistics: table=%s column=%s failed, no statistics", name.c_str(), column.name.c_str());
+		return nullptr;
+	}
 }
 
 TableStorageInfo MSSQLTableEntry::GetStorageInfo(ClientContext &context) {
@@ -364,6 +420,62 @@ const mssql::PrimaryKeyInfo &MSSQLTableEntry::GetPrimaryKeyInfo(ClientContext &c
 	return pk_info_;
 }
 
+//===----------------------------------------------------------------------===//
+// Partition Scheme Support
+//===----------------------------------------------------------------------===//
+
+void MSSQLTableEntry::EnsurePartitionInfoLoaded(ClientContext &context) const {
+	// Same publication protocol as EnsurePKLoaded: acquire fast path, mutex +
+	// relaxed double-check, release-store as the last write.
+	if (partition_loaded_.load(std::memory_order_acquire)) {
+		return;
+	}
+	std::lock_guard<std::mutex> lock(partition_load_mutex_);
+	if (partition_loaded_.load(std::memory_order_relaxed)) {
+		return;
+	}
+
+	// Unpartitioned tables (the common case) and views never touch the server.
+	if (object_type_ == MSSQLObjectType::TABLE && partition_count_ > 1) {
+		MSSQL_TE_DEBUG("EnsurePartitionInfoLoaded: loading partition scheme for %s.%s (%llu partitions)",
+					   schema.name.c_str(), name.c_str(), (unsigned long long)partition_count_);
+
+		auto &mssql_catalog = const_cast<MSSQLTableEntry *>(this)->GetMSSQLCatalog();
+		auto &mssql_schema = const_cast<MSSQLTableEntry *>(this)->GetMSSQLSchema();
+		try {
+			auto &pool = mssql_catalog.GetConnectionPool();
+			auto connection = pool.Acquire();
+			if (connection) {
+				// Nested try: return the connection before the outer catch
+				// swallows the exception (see EnsurePKLoaded).
+				try {
+					partition_info_ = mssql::PartitionSchemeInfo::Discover(
+						*connection, mssql_schema.name.GetIdentifierName(), name.GetIdentifierName());
+				} catch (...) {
+					pool.Release(std::move(connection));
+					throw;
+				}
+				pool.Release(std::move(connection));
+			} else {
+				MSSQL_TE_DEBUG("EnsurePartitionInfoLoaded: no connection available, scanning unpartitioned");
+			}
+		} catch (const std::exception &e) {
+			// A scan that does not know the partition scheme is still correct,
+			// just not partition-aligned.
+			MSSQL_TE_DEBUG("EnsurePartitionInfoLoaded: error discovering partition scheme: %s", e.what());
+			partition_info_ = mssql::PartitionSchemeInfo();
+		}
+	}
+
+	// Release-store publishes partition_info_ to any reader doing acquire-load.
+	partition_loaded_.store(true, std::memory_order_release);
+}
+
+const mssql::PartitionSchemeInfo &MSSQLTableEntry::GetPartitionInfo(ClientContext &context) {
+	EnsurePartitionInfoLoaded(context);
+	return partition_info_;
+}
+
 virtual_column_map_t MSSQLTableEntry::GetVirtualColumns() const {
 	virtual_column_map_t result;
 
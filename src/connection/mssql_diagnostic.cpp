@@ -265,6 +265,18 @@ unique_ptr<FunctionData> MSSQLPoolStatsFunction::Bind(ClientContext &context, Ta
 	names.emplace_back("pinned_count");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("tls_session_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("tls_session_misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("kernel_tls_rx");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("kernel_tls_tx");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return std::move(bind_data);
 }
 
@@ -332,6 +344,10 @@ void MSSQLPoolStatsFunction::Execute(ClientContext &context, TableFunctionInput
 			output.data[6].SetValue(count, Value::BIGINT(static_cast<int64_t>(stats.acquire_count)));
 			output.data[7].SetValue(count, Value::BIGINT(static_cast<int64_t>(stats.acquire_timeout_count)));
 			output.data[8].SetValue(count, Value::BIGINT(stats.pinned_count));
+			output.data[9].SetValue(count, Value::BIGINT(static_cast<int64_t>(stats.tls_session_hits)));
+			output.data[10].SetValue(count, Value::BIGINT(static_cast<int64_t>(stats.tls_session_misses)));
+			output.data[11].SetValue(count, Value::BIGINT(static_cast<int64_t>(stats.kernel_tls_rx)));
+			output.data[12].SetValue(count, Value::BIGINT(static_cast<int64_t>(stats.kernel_tls_tx)));
 
 			count++;
 		} catch (...) {
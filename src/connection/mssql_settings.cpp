@@ -6,6 +6,8 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/config.hpp"
+#include "query/mssql_read_ahead.hpp"
+#include "table_scan/scan_range_policy.hpp"
 
 namespace duckdb {
 
@@ -27,6 +29,14 @@ static void ValidateNonNegative(ClientContext &context, SetScope scope, Value &p
 	}
 }
 
+static void ValidateScanReadAhead(ClientContext &context, SetScope scope, Value &parameter) {
+	auto val = parameter.GetValue<int64_t>();
+	if (val < 0 || val > static_cast<int64_t>(MSSQL_MAX_SCAN_READ_AHEAD)) {
+		throw InvalidInputException("mssql_scan_read_ahead must be between 0 and %llu, got: %lld",
+									static_cast<unsigned long long>(MSSQL_MAX_SCAN_READ_AHEAD), val);
+	}
+}
+
 // A collation name goes into generated DDL as a bare identifier — COLLATE takes
 // no quoting in T-SQL — so it is checked here rather than concatenated blind.
 // SQL Server's own collation names are letters, digits and underscores only.
@@ -116,6 +126,16 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 							  "UTF-8 instead of UTF-16 (default: true)",
 							  LogicalType::BOOLEAN, Value::BOOLEAN(true), nullptr, SetScope::GLOBAL);
 
+	// mssql_tls_kernel_offload - Linux kernel TLS after the login handshake.
+	// OpenSSL's own kTLS switch cannot engage: the handshake runs through the
+	// PRELOGIN-wrapping BIO, not a socket BIO. The keys are derived and handed
+	// to the socket by us instead. TLS 1.2 + AES-GCM only; anything else, or a
+	// kernel without the tls module, quietly stays in OpenSSL.
+	config.AddExtensionOption("mssql_tls_kernel_offload",
+							  "On Linux, decrypt (and encrypt) TLS records in the kernel after the login handshake "
+							  "(TLS 1.2 AES-GCM; falls back to OpenSSL otherwise) (default: false)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(false), nullptr, SetScope::GLOBAL);
+
 	// mssql_browser_timeout_seconds - SQL Server Browser UDP query timeout (spec 045)
 	// Used when resolving named instances (host\instance) via MC-SQLR.
 	// Short by design — Browser is on the critical path of every named-instance attach.
@@ -169,12 +189,31 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 		"Metadata query timeout in seconds (default: 300, 0 = no timeout). Increase for very large catalogs",
 		LogicalType::BIGINT, Value::BIGINT(tds::DEFAULT_METADATA_TIMEOUT), ValidateNonNegative, SetScope::GLOBAL);
 
+	// mssql_catalog_preload_connections - Pooled connections mssql_preload_catalog spreads its queries over
+	config.AddExtensionOption("mssql_catalog_preload_connections",
+							  "Connections mssql_preload_catalog loads schemas over in parallel (default: 4). Extra "
+							  "connections are used only if the pool can hand them out without waiting",
+							  LogicalType::BIGINT, Value::BIGINT(4), ValidatePositive, SetScope::GLOBAL);
+
 	// mssql_catalog_cache_ttl - Metadata cache TTL in seconds (0 = manual refresh only)
 	config.AddExtensionOption("mssql_catalog_cache_ttl", "Metadata cache TTL in seconds (0 = manual refresh only)",
 							  LogicalType::BIGINT,
 							  Value::BIGINT(0),	 // Default: disabled, manual refresh only
 							  ValidateNonNegative, SetScope::GLOBAL);
 
+	// mssql_catalog_delta_refresh - On TTL expiry, patch the cache from sys.objects.modify_date
+	// instead of discarding it
+	config.AddExtensionOption("mssql_catalog_delta_refresh",
+							  "When mssql_catalog_cache_ttl expires, reload only the tables created, altered or "
+							  "dropped since the last refresh instead of the whole catalog",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(true), nullptr, SetScope::GLOBAL);
+
+	// mssql_catalog_background_refresh - Run the delta refresh from a background thread
+	config.AddExtensionOption("mssql_catalog_background_refresh",
+							  "Run the delta refresh from a background thread halfway through "
+							  "mssql_catalog_cache_ttl, so lookups do not wait for it",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(false), nullptr, SetScope::GLOBAL);
+
 	// mssql_exec_invalidate_cache - Auto-invalidate the catalog cache after DDL run via mssql_exec()
 	// (issue #151). DEFAULT FALSE: like the Postgres extension's postgres_execute, mssql_exec() does
 	// not touch the cache by default — invalidate manually with mssql_invalidate_cache() /
@@ -193,9 +232,9 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 							  "Enable statistics collection from SQL Server for query optimizer", LogicalType::BOOLEAN,
 							  Value::BOOLEAN(DEFAULT_STATISTICS_ENABLED), nullptr, SetScope::GLOBAL);
 
-	// mssql_statistics_level - Statistics detail level (0=rowcount, 1=+histogram, 2=+NDV)
+	// mssql_statistics_level - Statistics detail level (0=rowcount, 1=+NOT NULL, 2=+NDV)
 	config.AddExtensionOption("mssql_statistics_level",
-							  "Statistics detail level: 0=row count, 1=+histogram min/max, 2=+NDV", LogicalType::BIGINT,
+							  "Statistics detail level: 0=row count, 1=+NOT NULL columns, 2=+NDV", LogicalType::BIGINT,
 							  Value::BIGINT(DEFAULT_STATISTICS_LEVEL), ValidateNonNegative, SetScope::GLOBAL);
 
 	// mssql_statistics_use_dbcc - Allow DBCC SHOW_STATISTICS for column stats
@@ -233,6 +272,13 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 							  LogicalType::BOOLEAN, Value::BOOLEAN(MSSQL_DEFAULT_INSERT_USE_RETURNING_OUTPUT), nullptr,
 							  SetScope::GLOBAL);
 
+	// mssql_insert_pushdown - Run INSERT ... SELECT as one server-side statement
+	// when the SELECT reads attached tables on the same server and encodes as T-SQL
+	config.AddExtensionOption("mssql_insert_pushdown",
+							  "Run INSERT ... SELECT as a single server-side statement when fully expressible in T-SQL",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(MSSQL_DEFAULT_INSERT_PUSHDOWN), nullptr,
+							  SetScope::GLOBAL);
+
 	//===----------------------------------------------------------------------===//
 	// DML (UPDATE/DELETE) Settings
 	//===----------------------------------------------------------------------===//
@@ -250,10 +296,38 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 		LogicalType::BIGINT, Value::BIGINT(MSSQL_DEFAULT_DML_MAX_PARAMETERS), ValidatePositive, SetScope::GLOBAL);
 
 	// mssql_dml_use_prepared - Use prepared statements for DML operations
-	config.AddExtensionOption("mssql_dml_use_prepared", "Use prepared statements for UPDATE/DELETE operations",
+	config.AddExtensionOption("mssql_dml_use_prepared",
+							  "Send UPDATE/DELETE batch values as typed parameters through prepared statement handles",
 							  LogicalType::BOOLEAN, Value::BOOLEAN(MSSQL_DEFAULT_DML_USE_PREPARED), nullptr,
 							  SetScope::GLOBAL);
 
+	// mssql_prepared_cache_size - Prepared statement handles kept per connection (LRU)
+	// 0 = never keep a handle: parameterized batches go through sp_executesql
+	config.AddExtensionOption("mssql_prepared_cache_size",
+							  "Prepared statement handles kept per connection for reuse (0 = sp_executesql only)",
+							  LogicalType::BIGINT, Value::BIGINT(tds::DEFAULT_PREPARED_CACHE_SIZE),
+							  ValidateNonNegative, SetScope::GLOBAL);
+
+	// mssql_dml_use_tvp - Send UPDATE/DELETE batches as one table-valued parameter
+	// Creates a table type (duckdb_tvp_<hash>) in the target schema on first use
+	config.AddExtensionOption("mssql_dml_use_tvp",
+							  "Send UPDATE/DELETE batches as a table-valued parameter (creates a table type)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(MSSQL_DEFAULT_DML_USE_TVP), nullptr,
+							  SetScope::GLOBAL);
+
+	// mssql_dml_tvp_batch_size - Rows per UPDATE/DELETE batch on the TVP path
+	config.AddExtensionOption("mssql_dml_tvp_batch_size",
+							  "Maximum rows per UPDATE/DELETE batch sent as a table-valued parameter",
+							  LogicalType::BIGINT, Value::BIGINT(MSSQL_DEFAULT_DML_TVP_BATCH_SIZE), ValidatePositive,
+							  SetScope::GLOBAL);
+
+	// mssql_dml_pushdown - Run UPDATE/DELETE as one server-side statement when
+	// the WHERE clause and SET expressions are all expressible in T-SQL
+	config.AddExtensionOption("mssql_dml_pushdown",
+							  "Run UPDATE/DELETE as a single server-side statement when fully expressible in T-SQL",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(MSSQL_DEFAULT_DML_PUSHDOWN), nullptr,
+							  SetScope::GLOBAL);
+
 	//===----------------------------------------------------------------------===//
 	// CTAS (CREATE TABLE AS SELECT) Settings
 	//===----------------------------------------------------------------------===//
@@ -341,6 +415,13 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 							  "Use BCP protocol for CTAS data transfer (default: true, 2-10x faster than INSERT)",
 							  LogicalType::BOOLEAN, Value::BOOLEAN(DEFAULT_CTAS_USE_BCP), nullptr, SetScope::GLOBAL);
 
+	// mssql_ctas_server_side - Copy a source on the same attached database server-side
+	// The rows never leave SQL Server: INSERT ... SELECT into the table CTAS created
+	config.AddExtensionOption("mssql_ctas_server_side",
+							  "Run CTAS whose source reads only the target's attached database as INSERT ... SELECT "
+							  "on SQL Server, without moving the rows through DuckDB (default: true)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(true), nullptr, SetScope::GLOBAL);
+
 	//===----------------------------------------------------------------------===//
 	// COPY/BCP Settings
 	//===----------------------------------------------------------------------===//
@@ -397,6 +478,68 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 							  "clustered off), 'true', or 'false'",
 							  LogicalType::VARCHAR, Value("auto"), nullptr, SetScope::GLOBAL);
 
+	//===----------------------------------------------------------------------===//
+	// Parallel Table Scan Settings
+	//===----------------------------------------------------------------------===//
+
+	// mssql_scan_parallel_ranges — key ranges a catalog table scan may split
+	// into, each drained on its own pooled connection by its own DuckDB thread.
+	// 0 derives it from DuckDB's thread count; the pool's headroom, the table's
+	// size (mssql_scan_parallel_min_rows) and an explicit transaction all cap it
+	// further. See table_scan/scan_range_policy.hpp.
+	config.AddExtensionOption(
+		"mssql_scan_parallel_ranges",
+		"Key ranges a catalog table scan may split into, each on its own connection (default: 0 = derive from "
+		"DuckDB's thread count, capped at 16). 1 disables parallel scans. Ignored inside an explicit transaction",
+		LogicalType::BIGINT, Value::BIGINT(MSSQL_DEFAULT_SCAN_PARALLEL_RANGES), ValidateNonNegative,
+		SetScope::GLOBAL);
+
+	// mssql_scan_parallel_min_rows — fewest estimated rows per key range. A table
+	// smaller than twice this is scanned on one stream.
+	config.AddExtensionOption("mssql_scan_parallel_min_rows",
+							  "Minimum estimated rows per key range of a parallel table scan (default: 500000)",
+							  LogicalType::BIGINT, Value::BIGINT(MSSQL_DEFAULT_SCAN_PARALLEL_MIN_ROWS),
+							  ValidatePositive, SetScope::GLOBAL);
+
+	// mssql_scan_partition_aligned — for a table on a partition scheme, split
+	// the scan by partition ($PARTITION.pf(col)) instead of by key range, and
+	// prune partitions the pushed-down filters exclude. See
+	// table_scan/partition_scan_policy.hpp.
+	config.AddExtensionOption("mssql_scan_partition_aligned",
+							  "Scan partitioned tables one partition group per connection and prune partitions "
+							  "excluded by pushed-down filters (default: true)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(true), nullptr, SetScope::GLOBAL);
+
+	// mssql_scan_read_ahead — TDS packets a background thread buffers ahead of
+	// the decoder, per result stream. Overlaps the network wait with decoding;
+	// 2 is double buffering, 3 triple. See query/mssql_read_ahead.hpp.
+	config.AddExtensionOption("mssql_scan_read_ahead",
+							  "TDS packets buffered ahead of decoding by a background reader thread per result "
+							  "stream (default: 0 = off; 2-3 = double/triple buffering, max 64)",
+							  LogicalType::BIGINT, Value::BIGINT(MSSQL_DEFAULT_SCAN_READ_AHEAD), ValidateScanReadAhead,
+							  SetScope::GLOBAL);
+
+	// mssql_scan_describe_bind — bind mssql_scan() from the server's description
+	// of the batch instead of starting it, so the query runs once, at execution.
+	config.AddExtensionOption("mssql_scan_describe_bind",
+							  "Bind mssql_scan() from sp_describe_first_result_set without executing the query; "
+							  "batches the server cannot describe fall back to executing at bind (default: false)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(false), nullptr, SetScope::GLOBAL);
+
+	// mssql_scan_parameterize_filters — send pushed-down filter constants as
+	// typed sp_executesql parameters so one plan serves every value.
+	config.AddExtensionOption("mssql_scan_parameterize_filters",
+							  "Send constants of pushed-down table scan filters as typed sp_executesql parameters "
+							  "instead of inline literals, so SQL Server reuses one cached plan (default: true)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(true), nullptr, SetScope::GLOBAL);
+
+	// mssql_join_filter_max_in - largest runtime join IN set (DuckDB's
+	// dynamic_or_filter_threshold decides whether one is built) sent to the server
+	config.AddExtensionOption("mssql_join_filter_max_in",
+							  "Largest IN set from a hash join's build side added to the probe scan's WHERE clause; "
+							  "0 sends none (default: 1000)",
+							  LogicalType::BIGINT, Value::BIGINT(1000), ValidateNonNegative, SetScope::GLOBAL);
+
 	//===----------------------------------------------------------------------===//
 	// VARCHAR Encoding Settings (Spec 026)
 	//===----------------------------------------------------------------------===//
@@ -411,6 +554,24 @@ void RegisterMSSQLSettings(ExtensionLoader &loader) {
 	config.AddExtensionOption("mssql_order_pushdown", "Enable ORDER BY pushdown to SQL Server (default: false)",
 							  LogicalType::BOOLEAN, Value::BOOLEAN(false), nullptr, SetScope::GLOBAL);
 
+	//===----------------------------------------------------------------------===//
+	// Aggregate / Join Pushdown Settings
+	//===----------------------------------------------------------------------===//
+
+	// mssql_aggregate_pushdown - Compute GROUP BY / SUM / MIN / MAX / COUNT / AVG
+	// over an attached table on SQL Server and fetch only the aggregated rows
+	config.AddExtensionOption("mssql_aggregate_pushdown",
+							  "Run GROUP BY aggregates over attached tables on SQL Server when the groups, "
+							  "aggregates and filters are expressible in T-SQL (default: true)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(true), nullptr, SetScope::GLOBAL);
+
+	// mssql_join_pushdown - Collapse a join of two tables in the same attached
+	// database into one remote SELECT
+	config.AddExtensionOption("mssql_join_pushdown",
+							  "Run joins between tables of the same attached database on SQL Server when the join "
+							  "conditions, filters and output columns are expressible in T-SQL (default: true)",
+							  LogicalType::BOOLEAN, Value::BOOLEAN(true), nullptr, SetScope::GLOBAL);
+
 	// mssql_convert_varchar_max - Convert VARCHAR(MAX) to NVARCHAR(MAX) in table scans
 	// When true: VARCHAR(MAX) with non-UTF8 collation is wrapped in CAST(... AS NVARCHAR(MAX))
 	// When false: VARCHAR(MAX) is NOT converted (preserves 4096-byte TDS buffer capacity)
@@ -473,6 +634,10 @@ MSSQLPoolConfig LoadPoolConfig(ClientContext &context) {
 		config.utf8_support = val.GetValue<bool>();
 	}
 
+	if (context.TryGetCurrentSetting("mssql_tls_kernel_offload", val)) {
+		config.tls_kernel_offload = val.GetValue<bool>();
+	}
+
 	return config;
 }
 
@@ -484,6 +649,30 @@ int64_t LoadCatalogCacheTTL(ClientContext &context) {
 	return 0;  // Default: manual refresh only
 }
 
+int64_t LoadCatalogPreloadConnections(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_catalog_preload_connections", val)) {
+		return val.GetValue<int64_t>();
+	}
+	return 4;
+}
+
+bool LoadCatalogDeltaRefresh(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_catalog_delta_refresh", val)) {
+		return val.GetValue<bool>();
+	}
+	return true;
+}
+
+bool LoadCatalogBackgroundRefresh(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_catalog_background_refresh", val)) {
+		return val.GetValue<bool>();
+	}
+	return false;
+}
+
 int LoadQueryTimeout(ClientContext &context) {
 	Value val;
 	if (context.TryGetCurrentSetting("mssql_query_timeout", val)) {
@@ -585,6 +774,10 @@ MSSQLInsertConfig LoadInsertConfig(ClientContext &context) {
 		config.use_returning_output = val.GetValue<bool>();
 	}
 
+	if (context.TryGetCurrentSetting("mssql_insert_pushdown", val)) {
+		config.pushdown = val.GetValue<bool>();
+	}
+
 	// Validate loaded config
 	config.Validate();
 
@@ -661,6 +854,11 @@ CTASConfig LoadCTASConfig(ClientContext &context) {
 		config.use_bcp = val.GetValue<bool>();
 	}
 
+	// Load server_side setting (default: true)
+	if (context.TryGetCurrentSetting("mssql_ctas_server_side", val)) {
+		config.server_side = val.GetValue<bool>();
+	}
+
 	// Inherit BCP settings from COPY configuration
 	if (context.TryGetCurrentSetting("mssql_copy_flush_rows", val)) {
 		config.bcp_flush_rows = static_cast<idx_t>(val.GetValue<int64_t>());
@@ -701,6 +899,83 @@ bool LoadCTASUseBCP(ClientContext &context) {
 	return DEFAULT_CTAS_USE_BCP;
 }
 
+//===----------------------------------------------------------------------===//
+// Parallel Table Scan Configuration Loading
+//===----------------------------------------------------------------------===//
+
+int64_t LoadScanParallelRanges(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_scan_parallel_ranges", val)) {
+		return val.GetValue<int64_t>();
+	}
+	return MSSQL_DEFAULT_SCAN_PARALLEL_RANGES;
+}
+
+int64_t LoadScanParallelMinRows(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_scan_parallel_min_rows", val)) {
+		return val.GetValue<int64_t>();
+	}
+	return MSSQL_DEFAULT_SCAN_PARALLEL_MIN_ROWS;
+}
+
+bool LoadScanPartitionAligned(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_scan_partition_aligned", val)) {
+		return val.GetValue<bool>();
+	}
+	return true;
+}
+
+idx_t LoadScanReadAhead(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_scan_read_ahead", val)) {
+		const auto packets = val.GetValue<int64_t>();
+		return packets > 0 ? static_cast<idx_t>(packets) : 0;
+	}
+	return static_cast<idx_t>(MSSQL_DEFAULT_SCAN_READ_AHEAD);
+}
+
+bool LoadScanDescribeBind(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_scan_describe_bind", val)) {
+		return val.GetValue<bool>();
+	}
+	return false;
+}
+
+bool LoadAggregatePushdown(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_aggregate_pushdown", val)) {
+		return val.GetValue<bool>();
+	}
+	return true;
+}
+
+bool LoadJoinPushdown(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_join_pushdown", val)) {
+		return val.GetValue<bool>();
+	}
+	return true;
+}
+
+bool LoadScanParameterizeFilters(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_scan_parameterize_filters", val)) {
+		return val.GetValue<bool>();
+	}
+	return true;
+}
+
+idx_t LoadJoinFilterMaxIn(ClientContext &context) {
+	Value val;
+	if (context.TryGetCurrentSetting("mssql_join_filter_max_in", val)) {
+		return static_cast<idx_t>(val.GetValue<int64_t>());
+	}
+	return 1000;
+}
+
 bool LoadExecInvalidateCache(ClientContext &context) {
 	Value val;
 	if (context.TryGetCurrentSetting("mssql_exec_invalidate_cache", val)) {
@@ -2,6 +2,7 @@
 #include "catalog/mssql_catalog.hpp"
 #include "catalog/mssql_ddl_translator.hpp"
 #include "connection/mssql_connection_provider.hpp"
+#include "connection/mssql_settings.hpp"
 #include "copy/bcp_config.hpp"
 #include "copy/bcp_writer.hpp"
 #include "copy/bulk_load_session.hpp"
@@ -14,6 +15,7 @@
 #include "tds/tds_connection.hpp"
 #include "tds/tds_connection_pool.hpp"
 
+#include <climits>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
@@ -147,7 +149,10 @@ void CTASExecutionState::ExecuteDDL(ClientContext &context) {
 		phase = CTASPhase::DDL_DONE;
 
 		// Branch based on use_bcp setting (Spec 027)
-		if (config.use_bcp) {
+		if (!config.server_select.empty()) {
+			// Server-side mode: ExecuteServerInsert copies the rows, nothing to open
+			DebugLog(1, "Source runs on the server, no data transfer");
+		} else if (config.use_bcp) {
 			// BCP mode: Initialize BCP writer and execute INSERT BULK
 			DebugLog(1, "Using BCP mode for data transfer (use_bcp=true)");
 			InitializeBCP(context);
@@ -312,6 +317,62 @@ void CTASExecutionState::FlushInserts(ClientContext &context) {
 	}
 }
 
+//===----------------------------------------------------------------------===//
+// CTASExecutionState::ExecuteServerInsert
+//===----------------------------------------------------------------------===//
+
+void CTASExecutionState::ExecuteServerInsert(ClientContext &context) {
+	phase = CTASPhase::INSERT_EXECUTING;
+	auto insert_start = std::chrono::steady_clock::now();
+
+	// Into the table the DDL phase created, so the column types and table
+	// options are exactly those of the streamed path. TABLOCK follows the same
+	// rule as INSERT BULK; on a new heap or columnstore it makes the insert
+	// minimally logged and lets the server run it in parallel.
+	config.bcp_tablock = MSSQLResolveTablock(config.bcp_tablock_choice, TargetShape());
+	vector<string> column_list;
+	for (const auto &column : columns) {
+		column_list.push_back(MSSQLDDLTranslator::QuoteIdentifier(column.name));
+	}
+	const string sql = "INSERT INTO " + target.GetQualifiedName() + (config.bcp_tablock ? " WITH (TABLOCK)" : "") +
+					   " (" + StringUtil::Join(column_list, ", ") + ") " + config.server_select;
+	DebugLog(2, "Executing server-side INSERT: %s", sql.c_str());
+
+	// Straight from the pool, like the bulk load: the planner only takes this
+	// path outside an explicit transaction. One statement over the whole
+	// source, so mssql_query_timeout applies as for mssql_exec.
+	auto &pool = catalog->GetConnectionPool();
+	auto conn = pool.Acquire();
+	if (!conn) {
+		throw IOException("CTAS: Failed to acquire connection from pool");
+	}
+	const int query_timeout_s = LoadQueryTimeout(context);
+	int timeout_ms = 0;
+	if (query_timeout_s > 0 && query_timeout_s <= INT_MAX / 1000) {
+		timeout_ms = query_timeout_s * 1000;
+	}
+
+	SimpleQueryResult result;
+	try {
+		result = MSSQLSimpleQuery::Execute(*conn, sql, timeout_ms);
+	} catch (std::exception &e) {
+		pool.Release(std::move(conn));
+		error_message = e.what();
+		throw;
+	}
+	pool.Release(std::move(conn));
+	if (result.HasError()) {
+		error_message = result.error_message;
+		throw IOException("CTAS failed: SQL Server error %d: %s", (int)result.error_number, result.error_message);
+	}
+
+	rows_produced = static_cast<idx_t>(result.rows_affected);
+	rows_inserted = rows_produced;
+	insert_time_ms =
+		std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - insert_start).count();
+	DebugLog(1, "Server-side INSERT: %llu rows in %lld ms", (unsigned long long)rows_inserted, insert_time_ms);
+}
+
 //===----------------------------------------------------------------------===//
 // CTASExecutionState::AttemptCleanup
 //===----------------------------------------------------------------------===//
@@ -508,17 +569,21 @@ string CTASExecutionState::BuildInsertBulkSql() const {
 	return mssql::BuildInsertBulkSql(bcp_target, bcp_columns, config.bcp_tablock, config.bcp_flush_rows);
 }
 
+MSSQLIndexKind CTASExecutionState::TargetShape() const {
+	// CTAS always creates its target, so the shape is known without asking the
+	// server: heap unless table_options says otherwise.
+	if (config.table_options.kind == MSSQLTableKind::COLUMNSTORE) {
+		return MSSQLIndexKind::CLUSTERED_COLUMNSTORE;
+	}
+	return config.table_options.kind == MSSQLTableKind::CLUSTERED ? MSSQLIndexKind::CLUSTERED : MSSQLIndexKind::HEAP;
+}
+
 void CTASExecutionState::ExecuteBCPInsert(ClientContext &context) {
 	DebugLog(1, "Executing INSERT BULK for BCP mode");
 
 	// TABLOCK by the shape CTAS is creating (spec 057 step 1, replacing issue
-	// #45's "new tables" rule). CTAS always creates its target, so the shape is
-	// known without asking the server: heap unless table_options says otherwise.
-	const MSSQLIndexKind shape =
-		config.table_options.kind == MSSQLTableKind::COLUMNSTORE
-			? MSSQLIndexKind::CLUSTERED_COLUMNSTORE
-			: (config.table_options.kind == MSSQLTableKind::CLUSTERED ? MSSQLIndexKind::CLUSTERED
-																	  : MSSQLIndexKind::HEAP);
+	// #45's "new tables" rule).
+	const MSSQLIndexKind shape = TargetShape();
 	config.bcp_tablock = MSSQLResolveTablock(config.bcp_tablock_choice, shape);
 	DebugLog(1, "TABLOCK=%d (choice=%d, shape=%d)", config.bcp_tablock ? 1 : 0, (int)config.bcp_tablock_choice,
 			 (int)shape);
@@ -2,10 +2,12 @@
 #include "catalog/mssql_catalog.hpp"
 #include "catalog/mssql_ddl_translator.hpp"
 #include "codec/target_string_type.hpp"
+#include "connection/mssql_connection_provider.hpp"
 #include "dml/ctas/mssql_physical_ctas.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "table_scan/mssql_remote_relation.hpp"
 
 #include <cstdio>
 #include <cstdlib>
@@ -95,6 +97,12 @@ PhysicalOperator &CTASPlanner::Plan(ClientContext &context, PhysicalPlanGenerato
 		throw InvalidInputException("CTAS requires at least one column from the source query.");
 	}
 
+	// A source that only reads this catalog is copied on the server
+	if (config.server_side && !op.children.empty()) {
+		config.server_select = EncodeServerSelect(context, catalog, *op.children[0]);
+	}
+	const bool server_side = !config.server_select.empty();
+
 	// Result types: CTAS returns BIGINT row count
 	vector<LogicalType> result_types;
 	result_types.push_back(LogicalType::BIGINT);
@@ -104,12 +112,35 @@ PhysicalOperator &CTASPlanner::Plan(ClientContext &context, PhysicalPlanGenerato
 		planner.Make<MSSQLPhysicalCreateTableAs>(std::move(result_types), op.estimated_cardinality, catalog,
 												 std::move(target), std::move(columns), std::move(config));
 
-	// Add child operator (the SELECT query)
-	physical_ctas.children.push_back(child_plan);
+	// Add child operator (the SELECT query), unless the server runs it
+	if (!server_side) {
+		physical_ctas.children.push_back(child_plan);
+	}
 
 	return physical_ctas;
 }
 
+//===----------------------------------------------------------------------===//
+// CTASPlanner::EncodeServerSelect
+//===----------------------------------------------------------------------===//
+
+string CTASPlanner::EncodeServerSelect(ClientContext &context, MSSQLCatalog &catalog, LogicalOperator &source) {
+	// In an explicit transaction the source reads on the pinned connection and
+	// sees its uncommitted writes; a pool connection would not, and could wait
+	// on that transaction's locks
+	if (ConnectionProvider::IsInTransaction(context, catalog)) {
+		return string();
+	}
+	string context_name;
+	string select_sql;
+	if (!EncodeRemoteSelect(source, nullptr, nullptr, context_name, select_sql) ||
+		context_name != catalog.GetContextName()) {
+		return string();
+	}
+	CTAS_PLANNER_DEBUG_LOG(1, "Source runs on the server: %s", select_sql.c_str());
+	return select_sql;
+}
+
 //===----------------------------------------------------------------------===//
 // CTASPlanner::ExtractTarget
 //===----------------------------------------------------------------------===//
@@ -40,57 +40,66 @@ MSSQLPhysicalCreateTableAs::MSSQLPhysicalCreateTableAs(PhysicalPlan &plan, vecto
 // State Management
 //===----------------------------------------------------------------------===//
 
+//! Existence checks and the CREATE TABLE, for the streamed and the server-side
+//! path alike. False when IF NOT EXISTS found the table: nothing to load.
+static bool CreateTarget(ClientContext &context, mssql::CTASExecutionState &state) {
+	// Check if table exists and determine if this is a new table (Issue #45 - auto-TABLOCK)
+	bool table_existed = state.TableExists(context);
+
+	// Handle OR REPLACE: check if table exists and drop if needed
+	if (state.target.or_replace) {
+		if (table_existed) {
+			state.ExecuteDrop(context);
+			// After drop, this is effectively a new table
+			state.config.is_new_table = true;
+		} else {
+			// Table didn't exist - definitely new
+			state.config.is_new_table = true;
+		}
+	} else if (state.target.if_not_exists) {
+		// Handle IF NOT EXISTS: skip if table exists (Issue #44)
+		if (table_existed) {
+			return false;
+		}
+		// Table didn't exist - new table
+		state.config.is_new_table = true;
+	} else {
+		// Non-OR REPLACE, non-IF NOT EXISTS: fail if table exists (FR-014)
+		if (table_existed) {
+			throw InvalidInputException(
+				"CTAS failed: table '%s' already exists. "
+				"Use CREATE OR REPLACE TABLE to overwrite.",
+				state.target.GetQualifiedName());
+		}
+		// Table didn't exist - new table
+		state.config.is_new_table = true;
+	}
+
+	// Validate schema exists (FR-009)
+	if (!state.SchemaExists(context)) {
+		throw InvalidInputException("CTAS failed: schema '%s' does not exist in SQL Server.",
+									state.target.schema_name);
+	}
+
+	// Execute CREATE TABLE DDL
+	state.ExecuteDDL(context);
+	return true;
+}
+
 unique_ptr<GlobalSinkState> MSSQLPhysicalCreateTableAs::GetGlobalSinkState(ClientContext &context) const {
 	auto gstate = make_uniq<MSSQLCTASGlobalSinkState>(context, catalog_, target_, columns_, config_);
 
 	// Execute DDL phase immediately (CREATE TABLE or DROP + CREATE for OR REPLACE)
 	// This is done in GetGlobalSinkState to fail fast before any data is processed
 	try {
-		// Check if table exists and determine if this is a new table (Issue #45 - auto-TABLOCK)
-		bool table_existed = gstate->state.TableExists(context);
-
-		// Handle OR REPLACE: check if table exists and drop if needed
-		if (gstate->state.target.or_replace) {
-			if (table_existed) {
-				gstate->state.ExecuteDrop(context);
-				// After drop, this is effectively a new table
-				gstate->state.config.is_new_table = true;
-			} else {
-				// Table didn't exist - definitely new
-				gstate->state.config.is_new_table = true;
-			}
-		} else if (gstate->state.target.if_not_exists) {
-			// Handle IF NOT EXISTS: skip if table exists (Issue #44)
-			if (table_existed) {
-				// Table exists - mark as skipped and return early
-				gstate->state.phase = mssql::CTASPhase::SKIPPED;
-				gstate->skipped = true;
-				gstate->state.LogMetrics();
-				return std::move(gstate);
-			}
-			// Table didn't exist - new table
-			gstate->state.config.is_new_table = true;
-		} else {
-			// Non-OR REPLACE, non-IF NOT EXISTS: fail if table exists (FR-014)
-			if (table_existed) {
-				throw InvalidInputException(
-					"CTAS failed: table '%s' already exists. "
-					"Use CREATE OR REPLACE TABLE to overwrite.",
-					gstate->state.target.GetQualifiedName());
-			}
-			// Table didn't exist - new table
-			gstate->state.config.is_new_table = true;
+		if (!CreateTarget(context, gstate->state)) {
+			// Table exists - mark as skipped and return early
+			gstate->state.phase = mssql::CTASPhase::SKIPPED;
+			gstate->skipped = true;
+			gstate->state.LogMetrics();
+			return std::move(gstate);
 		}
 
-		// Validate schema exists (FR-009)
-		if (!gstate->state.SchemaExists(context)) {
-			throw InvalidInputException("CTAS failed: schema '%s' does not exist in SQL Server.",
-										gstate->state.target.schema_name);
-		}
-
-		// Execute CREATE TABLE DDL
-		gstate->state.ExecuteDDL(context);
-
 		// How many bulk-load sessions this CTAS may open (spec 057 step 7).
 		//
 		// Only the BCP path: the INSERT path has no session to multiply, and it
@@ -458,8 +467,21 @@ SinkFinalizeType MSSQLPhysicalCreateTableAs::Finalize(Pipeline &pipeline, Event
 // Source Implementation (for returning row count)
 //===----------------------------------------------------------------------===//
 
+class MSSQLCTASSourceState : public GlobalSourceState {
+public:
+	//! Whether the server-side statement has run
+	bool finished = false;
+};
+
+unique_ptr<GlobalSourceState> MSSQLPhysicalCreateTableAs::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<MSSQLCTASSourceState>();
+}
+
 SourceResultType MSSQLPhysicalCreateTableAs::GetDataInternal(ExecutionContext &context, DataChunk &chunk,
 															 OperatorSourceInput &input) const {
+	if (IsServerSide()) {
+		return GetDataServerSide(context, chunk, input);
+	}
 	auto &gstate = sink_state->Cast<MSSQLCTASGlobalSinkState>();
 
 	// Thread-safe access
@@ -478,4 +500,40 @@ SourceResultType MSSQLPhysicalCreateTableAs::GetDataInternal(ExecutionContext &c
 	return SourceResultType::FINISHED;
 }
 
+SourceResultType MSSQLPhysicalCreateTableAs::GetDataServerSide(ExecutionContext &context, DataChunk &chunk,
+															   OperatorSourceInput &input) const {
+	auto &source_state = input.global_state.Cast<MSSQLCTASSourceState>();
+	if (source_state.finished) {
+		return SourceResultType::FINISHED;
+	}
+	source_state.finished = true;
+
+	// The same state the sink path keeps, so DDL, cleanup and metrics match it;
+	// its destructor drops the table if the statement is aborted midway
+	auto &client = context.client;
+	mssql::CTASExecutionState state;
+	state.Initialize(catalog_, target_, columns_, config_, ConnectionProvider::ShouldResetOnRelease(client));
+	try {
+		if (CreateTarget(client, state)) {
+			state.ExecuteServerInsert(client);
+			state.phase = mssql::CTASPhase::COMPLETE;
+			state.InvalidateCache();
+		} else {
+			state.phase = mssql::CTASPhase::SKIPPED;
+		}
+		state.LogMetrics();
+	} catch (...) {
+		state.phase = mssql::CTASPhase::FAILED;
+		if (state.config.drop_on_failure) {
+			state.AttemptCleanup(client);
+		}
+		state.LogMetrics();
+		throw;
+	}
+
+	chunk.SetChildCardinality(1);
+	chunk.SetValue(0, 0, Value::BIGINT(static_cast<int64_t>(state.rows_inserted)));
+	return SourceResultType::FINISHED;
+}
+
 }  // namespace duckdb
@@ -8,8 +8,10 @@
 #include "dml/delete/mssql_delete_statement.hpp"
 #include "dml/mssql_rowid_extractor.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "query/mssql_simple_query.hpp"
 #include "tds/tds_connection_pool.hpp"
 #include "tds/tds_packet.hpp"
 #include "tds/tds_token_parser.hpp"
@@ -39,14 +41,34 @@ namespace duckdb {
 MSSQLDeleteExecutor::MSSQLDeleteExecutor(ClientContext &context, const MSSQLDeleteTarget &target,
 										 const MSSQLDMLConfig &config)
 	: context_(context), target_(target), config_(config) {
-	// Create statement generator
-	statement_ = make_uniq<MSSQLDeleteStatement>(target_);
+	// Create statement generator (values become parameters when batches run prepared)
+	statement_ = make_uniq<MSSQLDeleteStatement>(target_, config_.use_prepared);
 
 	// Compute effective batch size based on parameters per row (PK columns only for DELETE)
 	effective_batch_size_ = config_.EffectiveBatchSize(statement_->GetParametersPerRow());
 	DELETE_DEBUG(1, "DeleteExecutor: effective_batch_size=%llu (params_per_row=%llu)",
 				 (unsigned long long)effective_batch_size_, (unsigned long long)statement_->GetParametersPerRow());
 
+	// TVP path: a batch is one table-valued parameter, not bounded by the parameter limit
+	if (config_.use_tvp) {
+		vector<LogicalType> column_types;
+		vector<string> declarations;
+		for (auto &pk_col : target_.pk_info.columns) {
+			column_types.push_back(pk_col.duckdb_type);
+			declarations.push_back(MSSQLDMLTvpType::KeyColumnDeclaration(pk_col));
+		}
+		auto tvp_type = make_uniq<MSSQLDMLTvpType>();
+		if (MSSQLDMLTvpType::TryCreate(target_.schema_name, std::move(column_types), std::move(declarations),
+									   *tvp_type)) {
+			tvp_type_ = std::move(tvp_type);
+			effective_batch_size_ = config_.tvp_batch_size;
+			DELETE_DEBUG(1, "DeleteExecutor: TVP path, type=%s, batch_size=%llu",
+						 tvp_type_->GetQualifiedName().c_str(), (unsigned long long)effective_batch_size_);
+		} else {
+			DELETE_DEBUG(1, "DeleteExecutor: a PK type has no TVP encoding, using VALUES batches");
+		}
+	}
+
 	// Check if we need to defer execution until Finalize
 	// This is required when in an explicit transaction because:
 	// 1. The scan uses the pinned connection to stream rowids
@@ -63,7 +85,53 @@ MSSQLDeleteExecutor::MSSQLDeleteExecutor(ClientContext &context, const MSSQLDele
 	}
 }
 
-MSSQLDeleteExecutor::~MSSQLDeleteExecutor() = default;
+MSSQLDeleteExecutor::~MSSQLDeleteExecutor() {
+	// Finalize was never reached (error or cancel): give the connection back
+	try {
+		ReleaseConnection();
+	} catch (...) {
+	}
+}
+
+std::shared_ptr<tds::TdsConnection> MSSQLDeleteExecutor::AcquireConnection() {
+	if (connection_) {
+		return connection_;
+	}
+	auto &catalog = Catalog::GetCatalog(context_, Identifier(target_.catalog_name));
+	connection_catalog_ = &catalog.Cast<MSSQLCatalog>();
+
+	// Acquire connection via ConnectionProvider (handles transaction pinning)
+	connection_ = ConnectionProvider::GetConnection(context_, *connection_catalog_);
+	if (connection_) {
+		connection_->SetPreparedCacheCapacity(config_.prepared_cache_size);
+	}
+	return connection_;
+}
+
+void MSSQLDeleteExecutor::PrepareTvpType() {
+	string error = "failed to acquire connection";
+	auto connection = AcquireConnection();
+	if (connection) {
+		auto result = MSSQLSimpleQuery::Execute(*connection, tvp_type_->GenerateCreateSql());
+		if (!result.HasError()) {
+			tvp_type_ready_ = true;
+			return;
+		}
+		error = result.error_message;
+	}
+	// Typically no CREATE TYPE permission: VALUES batches need none
+	DELETE_DEBUG(1, "PrepareTvpType: %s, falling back to VALUES batches", error.c_str());
+	tvp_type_.reset();
+	effective_batch_size_ = config_.EffectiveBatchSize(statement_->GetParametersPerRow());
+}
+
+void MSSQLDeleteExecutor::ReleaseConnection() {
+	if (!connection_) {
+		return;
+	}
+	ConnectionProvider::ReleaseConnection(context_, *connection_catalog_, std::move(connection_));
+	connection_ = nullptr;
+}
 
 idx_t MSSQLDeleteExecutor::Execute(DataChunk &chunk) {
 	DELETE_DEBUG(1, "Execute: chunk_size=%llu, column_count=%llu", (unsigned long long)chunk.size(),
@@ -73,6 +141,12 @@ idx_t MSSQLDeleteExecutor::Execute(DataChunk &chunk) {
 		throw InternalException("MSSQLDeleteExecutor::Execute called after Finalize");
 	}
 
+	// The batch size must be settled before rows are cut into batches
+	// (in defer_execution_ mode that happens in Finalize)
+	if (tvp_type_ && !tvp_type_ready_ && !defer_execution_) {
+		PrepareTvpType();
+	}
+
 	// DuckDB DELETE chunk layout:
 	// - Columns 0 to N-1: filter columns (from WHERE clause)
 	// - Column N: rowid (added by BindRowIdColumns at the END of projection)
@@ -80,34 +154,25 @@ idx_t MSSQLDeleteExecutor::Execute(DataChunk &chunk) {
 	idx_t rowid_col_idx = chunk.ColumnCount() - 1;
 	DELETE_DEBUG(1, "Execute: rowid at column %llu", (unsigned long long)rowid_col_idx);
 
-	// Extract PK values from the rowid column (last column) using target's pk_info
-	auto pk_values = ExtractPKFromRowid(chunk.data[rowid_col_idx], chunk.size(), target_.pk_info);
-
-	// Accumulate into pending batch
-	for (auto &pk : pk_values) {
-		pending_pk_values_.push_back(std::move(pk));
+	// Reference the PK columns of the rowid column (last column) using target's pk_info
+	DataChunk rows;
+	ReferencePKColumns(chunk.data[rowid_col_idx], chunk.size(), target_.pk_info, rows);
+	rows.SetCardinalityUnsafe(chunk.size());
 
-		// Check if we need to flush the batch
-		// In defer_execution_ mode, we accumulate everything and flush in Finalize
-		if (!defer_execution_ && pending_pk_values_.size() >= effective_batch_size_) {
-			DELETE_DEBUG(1, "Execute: batch full, flushing %llu rows...",
-						 (unsigned long long)pending_pk_values_.size());
-			auto result = FlushBatch();
-			if (!result.success) {
-				throw IOException("%s", result.FormatError("DELETE"));
-			}
-		}
+	auto result = BufferRows(rows);
+	if (!result.success) {
+		throw IOException("%s", result.FormatError("DELETE"));
 	}
 
 	DELETE_DEBUG(1, "Execute: chunk processed, total_deleted=%llu, pending=%llu",
-				 (unsigned long long)total_rows_deleted_, (unsigned long long)pending_pk_values_.size());
+				 (unsigned long long)total_rows_deleted_, (unsigned long long)PendingRowCount());
 
 	return total_rows_deleted_;
 }
 
 MSSQLDMLResult MSSQLDeleteExecutor::Finalize() {
 	DELETE_DEBUG(1, "Finalize: starting, finalized=%d, pending=%llu, defer_execution=%d", finalized_,
-				 (unsigned long long)pending_pk_values_.size(), defer_execution_);
+				 (unsigned long long)PendingRowCount(), defer_execution_);
 
 	if (finalized_) {
 		return MSSQLDMLResult::Success(total_rows_deleted_, batch_count_);
@@ -115,45 +180,95 @@ MSSQLDMLResult MSSQLDeleteExecutor::Finalize() {
 
 	finalized_ = true;
 
-	// Flush all remaining rows in batches
-	// In defer_execution_ mode, we may have accumulated many batches worth of rows
-	while (!pending_pk_values_.empty()) {
-		DELETE_DEBUG(1, "Finalize: flushing batch, pending=%llu", (unsigned long long)pending_pk_values_.size());
+	// In defer_execution_ mode every row was held until now: the scan is done,
+	// so cut them into batches (flushing each one as it fills)
+	if (defer_execution_) {
+		defer_execution_ = false;
+		auto buffered = std::move(pending_);
+		if (buffered) {
+			if (tvp_type_ && !tvp_type_ready_) {
+				PrepareTvpType();
+			}
+			for (auto &chunk : buffered->Chunks()) {
+				auto result = BufferRows(chunk);
+				if (!result.success) {
+					ReleaseConnection();
+					return result;
+				}
+			}
+		}
+	}
+
+	// Flush the last, partial batch
+	if (PendingRowCount() > 0) {
+		DELETE_DEBUG(1, "Finalize: flushing batch, pending=%llu", (unsigned long long)PendingRowCount());
 		auto result = FlushBatch();
 		if (!result.success) {
+			ReleaseConnection();
 			return result;
 		}
 	}
+	ReleaseConnection();
 
 	DELETE_DEBUG(1, "Finalize: done, total_deleted=%llu, batch_count=%llu", (unsigned long long)total_rows_deleted_,
 				 (unsigned long long)batch_count_);
 	return MSSQLDMLResult::Success(total_rows_deleted_, batch_count_);
 }
 
+MSSQLDMLResult MSSQLDeleteExecutor::BufferRows(DataChunk &rows) {
+	idx_t offset = 0;
+	while (offset < rows.size()) {
+		if (!pending_) {
+			pending_ = make_uniq<ColumnDataCollection>(Allocator::Get(context_), rows.GetTypes());
+		}
+
+		// Fill the pending batch up to the batch size
+		// In defer_execution_ mode, we accumulate everything and cut batches in Finalize
+		idx_t count = rows.size() - offset;
+		if (!defer_execution_) {
+			count = MinValue<idx_t>(count, effective_batch_size_ - pending_->Count());
+		}
+		AppendRowRange(*pending_, rows, offset, count);
+		offset += count;
+
+		if (!defer_execution_ && pending_->Count() >= effective_batch_size_) {
+			DELETE_DEBUG(1, "BufferRows: batch full, flushing %llu rows...", (unsigned long long)pending_->Count());
+			auto result = FlushBatch();
+			if (!result.success) {
+				return result;
+			}
+		}
+	}
+	return MSSQLDMLResult::Success(total_rows_deleted_, batch_count_);
+}
+
+idx_t MSSQLDeleteExecutor::PendingRowCount() const {
+	return pending_ ? pending_->Count() : 0;
+}
+
 MSSQLDMLResult MSSQLDeleteExecutor::FlushBatch() {
-	if (pending_pk_values_.empty()) {
+	if (PendingRowCount() == 0) {
 		return MSSQLDMLResult::Success(0, batch_count_);
 	}
 
 	batch_count_++;
 
-	// Extract up to effective_batch_size_ rows for this batch
-	vector<vector<Value>> batch_pk_values;
-	idx_t rows_to_process = std::min<idx_t>(pending_pk_values_.size(), effective_batch_size_);
+	// The pending rows become this batch; the next row starts a new one
+	auto batch_rows = std::move(pending_);
 
-	batch_pk_values.reserve(rows_to_process);
-	for (idx_t i = 0; i < rows_to_process; i++) {
-		batch_pk_values.push_back(std::move(pending_pk_values_[i]));
-	}
-
-	// Remove processed rows from pending
-	pending_pk_values_.erase(pending_pk_values_.begin(), pending_pk_values_.begin() + rows_to_process);
-
-	DELETE_DEBUG(1, "FlushBatch: batch %llu with %llu rows (remaining=%llu)", (unsigned long long)batch_count_,
-				 (unsigned long long)rows_to_process, (unsigned long long)pending_pk_values_.size());
+	DELETE_DEBUG(1, "FlushBatch: batch %llu with %llu rows", (unsigned long long)batch_count_,
+				 (unsigned long long)batch_rows->Count());
 
 	// Build the DELETE statement
-	auto batch = statement_->Build(batch_pk_values);
+	MSSQLDMLBatch batch;
+	if (tvp_type_) {
+		batch = statement_->BuildTvp(*tvp_type_, *batch_rows);
+	}
+	if (!batch.IsValid()) {
+		// VALUES path. A TVP-sized batch with a value the TVP cannot carry is
+		// inlined: as parameters it could exceed the request's parameter limit.
+		batch = tvp_type_ ? MSSQLDeleteStatement(target_).Build(*batch_rows) : statement_->Build(*batch_rows);
+	}
 
 	if (!batch.IsValid()) {
 		return MSSQLDMLResult::Failure("Failed to build DELETE batch", 0, batch_count_);
@@ -168,12 +283,8 @@ MSSQLDMLResult MSSQLDeleteExecutor::FlushBatch() {
 MSSQLDMLResult MSSQLDeleteExecutor::ExecuteBatch(const MSSQLDMLBatch &batch) {
 	DELETE_DEBUG(1, "ExecuteBatch: starting, sql_length=%zu", batch.sql.size());
 
-	// Get the MSSQLCatalog for ConnectionProvider
-	auto &catalog = Catalog::GetCatalog(context_, Identifier(target_.catalog_name));
-	auto &mssql_catalog = catalog.Cast<MSSQLCatalog>();
-
-	// Acquire connection via ConnectionProvider (handles transaction pinning)
-	auto connection = ConnectionProvider::GetConnection(context_, mssql_catalog);
+	// One connection for every batch of the statement, so its prepared handles are reused
+	auto connection = AcquireConnection();
 	if (!connection) {
 		DELETE_DEBUG(1, "ExecuteBatch: failed to acquire connection");
 		return MSSQLDMLResult::Failure("Failed to acquire connection for DELETE execution", 0, batch_count_);
@@ -188,19 +299,19 @@ MSSQLDMLResult MSSQLDeleteExecutor::ExecuteBatch(const MSSQLDMLBatch &batch) {
 		auto *socket = connection->GetSocket();
 		if (!socket) {
 			DELETE_DEBUG(1, "ExecuteBatch: socket is null");
-			ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+			ReleaseConnection();
 			return MSSQLDMLResult::Failure("Connection socket is null", 0, batch_count_);
 		}
 
 		// Clear any leftover data before starting
 		socket->ClearReceiveBuffer();
 
-		// Send the SQL batch
-		DELETE_DEBUG(1, "ExecuteBatch: sending SQL batch...");
-		if (!connection->ExecuteBatch(batch.sql)) {
+		// Send the batch: sp_execute / sp_prepexec with its parameters, or a plain SQL batch
+		DELETE_DEBUG(1, "ExecuteBatch: sending batch, %zu parameter(s)...", batch.parameters.values.size());
+		if (!connection->ExecutePrepared(batch.sql, batch.parameters)) {
 			string error = connection->GetLastError();
 			DELETE_DEBUG(1, "ExecuteBatch: ExecuteBatch failed, error=%s", error.c_str());
-			ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+			ReleaseConnection();
 			return MSSQLDMLResult::Failure("DELETE execution failed: " + error, 0, batch_count_);
 		}
 
@@ -222,7 +333,7 @@ MSSQLDMLResult MSSQLDeleteExecutor::ExecuteBatch(const MSSQLDMLBatch &batch) {
 				DELETE_DEBUG(1, "ExecuteBatch: TIMEOUT after 30s, packets_received=%d", packet_count);
 				connection->SendAttention();
 				connection->WaitForAttentionAck(5000);
-				ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+				ReleaseConnection();
 				return MSSQLDMLResult::Failure("DELETE execution timeout", 0, batch_count_);
 			}
 
@@ -234,7 +345,7 @@ MSSQLDMLResult MSSQLDeleteExecutor::ExecuteBatch(const MSSQLDMLBatch &batch) {
 			if (!socket->ReceivePacket(packet, recv_timeout)) {
 				string socket_error = socket->GetLastError();
 				DELETE_DEBUG(1, "ExecuteBatch: ReceivePacket FAILED, error='%s'", socket_error.c_str());
-				ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+				ReleaseConnection();
 				return MSSQLDMLResult::Failure("Failed to receive TDS packet: " + socket_error, 0, batch_count_);
 			}
 
@@ -278,6 +389,12 @@ MSSQLDMLResult MSSQLDeleteExecutor::ExecuteBatch(const MSSQLDMLBatch &batch) {
 					// Continue reading to drain the response
 					break;
 				}
+				case tds::ParsedTokenType::ReturnValue:
+					// sp_prepexec's handle, cached for the next batch of the same shape
+					if (!connection->OnReturnValue(parser.GetReturnValue()) && error_message.empty()) {
+						error_message = "sp_prepexec returned its statement handle in an unexpected type";
+					}
+					break;
 				default:
 					// Skip other tokens
 					break;
@@ -297,16 +414,15 @@ MSSQLDMLResult MSSQLDeleteExecutor::ExecuteBatch(const MSSQLDMLBatch &batch) {
 
 		// Check for errors
 		if (!error_message.empty()) {
-			ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+			ReleaseConnection();
 			return MSSQLDMLResult::Failure("DELETE failed: " + error_message, 0, batch_count_);
 		}
 
-		ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
 		total_rows_deleted_ += rows_affected;
 		return MSSQLDMLResult::Success(rows_affected, batch_count_);
 
 	} catch (const std::exception &e) {
-		ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+		ReleaseConnection();
 		return MSSQLDMLResult::Failure(string("DELETE execution failed: ") + e.what(), 0, batch_count_);
 	}
 }
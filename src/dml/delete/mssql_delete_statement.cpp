@@ -2,10 +2,13 @@
 #include "dml/insert/mssql_value_serializer.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "tds/encoding/rpc_parameter_encoder.hpp"
+#include "tds/encoding/tvp_encoder.hpp"
 
 namespace duckdb {
 
-MSSQLDeleteStatement::MSSQLDeleteStatement(const MSSQLDeleteTarget &target) : target_(target) {
+MSSQLDeleteStatement::MSSQLDeleteStatement(const MSSQLDeleteTarget &target, bool parameterize)
+	: target_(target), parameterize_(parameterize) {
 	if (!target_.HasPrimaryKey()) {
 		throw InvalidInputException("MSSQLDeleteStatement requires a table with primary key");
 	}
@@ -46,52 +49,80 @@ string MSSQLDeleteStatement::GenerateOnClause() const {
 	return sql;
 }
 
-MSSQLDMLBatch MSSQLDeleteStatement::Build(const vector<vector<Value>> &pk_values) const {
+void MSSQLDeleteStatement::EncodeValue(Vector &input, const UnifiedVectorFormat &fmt, idx_t row,
+									   const LogicalType &type, MSSQLDMLBatch &batch, string &sql) const {
+	if (parameterize_) {
+		auto placeholder = tds::encoding::RpcParameterEncoder::BindFromFormat(input, fmt, row, type, batch.parameters);
+		if (!placeholder.empty()) {
+			sql += placeholder;
+			return;
+		}
+	}
+	MSSQLValueSerializer::AppendFromFormat(input, fmt, row, type, sql);
+}
+
+void MSSQLDeleteStatement::CheckColumnCount(const ColumnDataCollection &rows) const {
+	idx_t pk_count = target_.pk_info.columns.size();
+	if (rows.ColumnCount() != pk_count) {
+		throw InvalidInputException("PK value count mismatch: expected %d, got %d", pk_count, rows.ColumnCount());
+	}
+}
+
+string MSSQLDeleteStatement::GenerateValuesColumnList() const {
+	string result;
+	auto &pk_columns = target_.pk_info.columns;
+	for (idx_t i = 0; i < pk_columns.size(); i++) {
+		if (i > 0) {
+			result += ", ";
+		}
+		result += EscapeIdentifier(pk_columns[i].name);
+	}
+	return result;
+}
+
+MSSQLDMLBatch MSSQLDeleteStatement::Build(ColumnDataCollection &rows) const {
 	MSSQLDMLBatch batch;
 
-	if (pk_values.empty()) {
+	if (rows.Count() == 0) {
 		return batch;
 	}
 
-	batch.row_count = pk_values.size();
+	CheckColumnCount(rows);
+	batch.row_count = rows.Count();
 
-	// Build the VALUES clause with inline literals (not parameters)
-	// VALUES (1, 'a'), (2, 'b'), ...
+	// Build the VALUES clause with typed parameters (or inline literals)
+	// VALUES (@p0, @p1), (@p2, @p3), ...
 	string values_clause = "VALUES ";
 	auto &pk_columns = target_.pk_info.columns;
 	idx_t pk_count = pk_columns.size();
 
-	for (idx_t row = 0; row < pk_values.size(); row++) {
-		if (row > 0) {
-			values_clause += ", ";
-		}
-		values_clause += "(";
-
-		const auto &row_pk = pk_values[row];
-		if (row_pk.size() != pk_count) {
-			throw InvalidInputException("PK value count mismatch: expected %d, got %d", pk_count, row_pk.size());
+	bool first_row = true;
+	for (auto &chunk : rows.Chunks()) {
+		// One format per PK column per chunk; cells are read through it
+		vector<UnifiedVectorFormat> formats(pk_count);
+		for (idx_t col = 0; col < pk_count; col++) {
+			chunk.data[col].ToUnifiedFormat(formats[col]);
 		}
 
-		for (idx_t col = 0; col < pk_count; col++) {
-			if (col > 0) {
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			if (!first_row) {
 				values_clause += ", ";
 			}
-			// Serialize the value as a SQL literal
-			values_clause += MSSQLValueSerializer::Serialize(row_pk[col], pk_columns[col].duckdb_type);
+			first_row = false;
+			values_clause += "(";
+			for (idx_t col = 0; col < pk_count; col++) {
+				if (col > 0) {
+					values_clause += ", ";
+				}
+				EncodeValue(chunk.data[col], formats[col], row, pk_columns[col].duckdb_type, batch, values_clause);
+			}
+			values_clause += ")";
 		}
-		values_clause += ")";
 	}
 
 	// Build column list for VALUES alias
 	// AS v([pk1], [pk2], ...)
-	string alias_columns = " AS v(";
-	for (idx_t i = 0; i < pk_count; i++) {
-		if (i > 0) {
-			alias_columns += ", ";
-		}
-		alias_columns += EscapeIdentifier(pk_columns[i].name);
-	}
-	alias_columns += ")";
+	string alias_columns = " AS v(" + GenerateValuesColumnList() + ")";
 
 	// Assemble the full DELETE statement
 	// DELETE t FROM [schema].[table] AS t
@@ -108,10 +139,46 @@ MSSQLDMLBatch MSSQLDeleteStatement::Build(const vector<vector<Value>> &pk_values
 	return batch;
 }
 
-MSSQLDMLBatch MSSQLDeleteStatement::BuildSingle(const vector<Value> &pk_value) const {
-	vector<vector<Value>> pk_values;
-	pk_values.push_back(pk_value);
-	return Build(pk_values);
+MSSQLDMLBatch MSSQLDeleteStatement::BuildTvp(const MSSQLDMLTvpType &tvp_type, ColumnDataCollection &rows) const {
+	MSSQLDMLBatch batch;
+
+	if (rows.Count() == 0) {
+		return batch;
+	}
+
+	CheckColumnCount(rows);
+	batch.row_count = rows.Count();
+
+	tds::encoding::TvpEncoder tvp(tvp_type.column_types);
+	idx_t pk_count = target_.pk_info.columns.size();
+	for (auto &chunk : rows.Chunks()) {
+		vector<UnifiedVectorFormat> formats(pk_count);
+		for (idx_t col = 0; col < pk_count; col++) {
+			chunk.data[col].ToUnifiedFormat(formats[col]);
+		}
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			tvp.BeginRow();
+			for (idx_t col = 0; col < pk_count; col++) {
+				if (!tvp.AppendFromFormat(chunk.data[col], formats[col], row)) {
+					return MSSQLDMLBatch();
+				}
+			}
+		}
+	}
+	batch.parameters.declarations = tvp_type.GenerateDeclaration();
+	batch.parameters.values.push_back(
+		tvp.Finish(MSSQLDMLTvpType::PARAMETER_NAME, tvp_type.schema_name, tvp_type.type_name));
+
+	// DELETE t FROM [schema].[table] AS t
+	// JOIN (SELECT * FROM @rows) AS v([pk1])
+	// ON t.[pk1] = v.[pk1]
+	batch.sql = GenerateDeleteClause();
+	batch.sql += " JOIN ";
+	batch.sql += MSSQLDMLTvpType::GenerateSource(GenerateValuesColumnList());
+	batch.sql += " ";
+	batch.sql += GenerateOnClause();
+
+	return batch;
 }
 
 }  // namespace duckdb
@@ -1,6 +1,8 @@
 #include "dml/insert/mssql_value_serializer.hpp"
+#include <limits>
 #include "codec/literal_format.hpp"
 #include "codec/string_codec.hpp"
+#include "codec/vector_format.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/hugeint.hpp"
 
@@ -96,10 +98,76 @@ string MSSQLValueSerializer::Serialize(const Value &value, const LogicalType &ta
 }
 
 string MSSQLValueSerializer::SerializeFromVector(Vector &vector, idx_t index, const LogicalType &target_type) {
-	// For simplicity, extract the value and serialize
-	// This could be optimized for bulk operations
-	auto value = vector.GetValue(index);
-	return Serialize(value, target_type);
+	UnifiedVectorFormat fmt;
+	vector.ToUnifiedFormat(fmt);
+	string result;
+	AppendFromFormat(vector, fmt, index, target_type, result);
+	return result;
+}
+
+void MSSQLValueSerializer::AppendFromFormat(Vector &vector, const UnifiedVectorFormat &fmt, idx_t row,
+											const LogicalType &target_type, string &out) {
+	using mssql::codec::FormatIsNull;
+	using mssql::codec::FormatValue;
+
+	// Same renderings as codec::FormatSqlLiteral for these families, minus the
+	// Value boxing: the DML builders call this once per cell of every batch
+	if (FormatIsNull(fmt, row)) {
+		out += "NULL";
+		return;
+	}
+	switch (vector.GetType().id()) {
+	case LogicalTypeId::BOOLEAN:
+		out += FormatValue<bool>(fmt, row) ? '1' : '0';
+		return;
+	case LogicalTypeId::TINYINT:
+		out += std::to_string(FormatValue<int8_t>(fmt, row));
+		return;
+	case LogicalTypeId::SMALLINT:
+		out += std::to_string(FormatValue<int16_t>(fmt, row));
+		return;
+	case LogicalTypeId::INTEGER:
+		out += std::to_string(FormatValue<int32_t>(fmt, row));
+		return;
+	case LogicalTypeId::BIGINT:
+		out += std::to_string(FormatValue<int64_t>(fmt, row));
+		return;
+	case LogicalTypeId::UTINYINT:
+		out += std::to_string(FormatValue<uint8_t>(fmt, row));
+		return;
+	case LogicalTypeId::USMALLINT:
+		out += std::to_string(FormatValue<uint16_t>(fmt, row));
+		return;
+	case LogicalTypeId::UINTEGER:
+		out += std::to_string(FormatValue<uint32_t>(fmt, row));
+		return;
+	case LogicalTypeId::UBIGINT: {
+		// Above INT64_MAX the codec's DECIMAL(20,0) cast applies
+		const uint64_t uval = FormatValue<uint64_t>(fmt, row);
+		if (uval <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+			out += std::to_string(uval);
+			return;
+		}
+		break;
+	}
+	case LogicalTypeId::VARCHAR: {
+		const auto str = FormatValue<string_t>(fmt, row);
+		const char *data = str.GetData();
+		const idx_t size = str.GetSize();
+		out += "N'";
+		for (idx_t i = 0; i < size; i++) {
+			out += data[i];
+			if (data[i] == '\'') {
+				out += '\'';
+			}
+		}
+		out += '\'';
+		return;
+	}
+	default:
+		break;
+	}
+	out += Serialize(vector.GetValue(row), target_type);
 }
 
 idx_t MSSQLValueSerializer::EstimateSerializedSize(const Value &value, const LogicalType &type) {
@@ -15,6 +15,9 @@ void MSSQLDMLConfig::Validate() const {
 	if (max_parameters == 0) {
 		throw InvalidInputException("mssql_dml_max_parameters must be >= 1");
 	}
+	if (tvp_batch_size == 0) {
+		throw InvalidInputException("mssql_dml_tvp_batch_size must be >= 1");
+	}
 	// Warn if batch_size might exceed parameter limit with reasonable column count
 	// A typical UPDATE with 5 columns + 1 PK = 6 params per row
 	// At batch_size 500 that's 3000 params which exceeds 2000
@@ -41,6 +44,22 @@ MSSQLDMLConfig LoadDMLConfig(ClientContext &context) {
 		config.use_prepared = val.GetValue<bool>();
 	}
 
+	if (context.TryGetCurrentSetting("mssql_prepared_cache_size", val)) {
+		config.prepared_cache_size = static_cast<idx_t>(val.GetValue<int64_t>());
+	}
+
+	if (context.TryGetCurrentSetting("mssql_dml_use_tvp", val)) {
+		config.use_tvp = val.GetValue<bool>();
+	}
+
+	if (context.TryGetCurrentSetting("mssql_dml_tvp_batch_size", val)) {
+		config.tvp_batch_size = static_cast<idx_t>(val.GetValue<int64_t>());
+	}
+
+	if (context.TryGetCurrentSetting("mssql_dml_pushdown", val)) {
+		config.pushdown = val.GetValue<bool>();
+	}
+
 	// Validate loaded config
 	config.Validate();
 
@@ -0,0 +1,321 @@
+#include "dml/mssql_dml_pushdown.hpp"
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include "catalog/mssql_catalog.hpp"
+#include "connection/mssql_connection_provider.hpp"
+#include "connection/mssql_settings.hpp"
+#include "dml/insert/mssql_value_serializer.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/operator/logical_delete.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_insert.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_update.hpp"
+#include "mssql_functions.hpp"
+#include "query/mssql_simple_query.hpp"
+#include "table_scan/filter_encoder.hpp"
+#include "table_scan/mssql_remote_relation.hpp"
+
+// Debug logging controlled by MSSQL_DEBUG environment variable
+static int GetDMLPushdownDebugLevel() {
+	static const int level = []() {
+		const char *env = std::getenv("MSSQL_DEBUG");
+		return env ? std::atoi(env) : 0;
+	}();
+	return level;
+}
+
+#define DML_PUSHDOWN_DEBUG(level, fmt, ...)                                   \
+	do {                                                                      \
+		if (GetDMLPushdownDebugLevel() >= level) {                            \
+			fprintf(stderr, "[MSSQL DML PUSHDOWN] " fmt "\n", ##__VA_ARGS__); \
+		}                                                                     \
+	} while (0)
+
+namespace duckdb {
+
+using mssql::ExpressionEncodeContext;
+using mssql::FilterEncoder;
+
+//===----------------------------------------------------------------------===//
+// Plan Inspection
+//===----------------------------------------------------------------------===//
+
+// The statement's input: projections (top first) over a catalog scan of the target
+struct PushdownInput {
+	vector<const LogicalProjection *> projections;
+	const LogicalGet *get = nullptr;
+	const MSSQLCatalogScanBindData *bind_data = nullptr;
+};
+
+static bool FindPushdownInput(const LogicalOperator &child, const string &catalog_name, const string &schema_name,
+							  const string &table_name, PushdownInput &input) {
+	const LogicalOperator *node = &child;
+	while (node->type == LogicalOperatorType::LOGICAL_PROJECTION && node->children.size() == 1) {
+		input.projections.push_back(&node->Cast<LogicalProjection>());
+		node = node->children[0].get();
+	}
+	if (node->type != LogicalOperatorType::LOGICAL_GET) {
+		// A join, or a filter the scan did not accept
+		DML_PUSHDOWN_DEBUG(1, "input is not a plain scan (operator type %d)", (int)node->type);
+		return false;
+	}
+	auto &get = node->Cast<LogicalGet>();
+	if (get.function.name != "mssql_catalog_scan" || !get.bind_data) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<MSSQLCatalogScanBindData>();
+	if (bind_data.context_name != catalog_name || bind_data.schema_name != schema_name ||
+		bind_data.table_name != table_name) {
+		return false;
+	}
+	if (bind_data.top_n > 0) {
+		return false;
+	}
+	input.get = &get;
+	input.bind_data = &bind_data;
+	return true;
+}
+
+// Table column of each entry of the scan's column_ids (the numbering TableFilterSet uses)
+static vector<column_t> ScanColumnIds(const LogicalGet &get) {
+	vector<column_t> column_ids;
+	for (const auto &col_idx : get.GetColumnIds()) {
+		column_ids.push_back(col_idx.IsVirtualColumn() ? COLUMN_IDENTIFIER_ROW_ID : col_idx.GetPrimaryIndex());
+	}
+	return column_ids;
+}
+
+// Table column of each scan output column (column_ids through projection_ids)
+static vector<column_t> ScanOutputColumns(const LogicalGet &get, const vector<column_t> &column_ids) {
+	if (get.projection_ids.empty()) {
+		return column_ids;
+	}
+	vector<column_t> output;
+	for (auto projection_id : get.projection_ids) {
+		output.push_back(projection_id < column_ids.size() ? column_ids[projection_id] : COLUMN_IDENTIFIER_ROW_ID);
+	}
+	return output;
+}
+
+// WHERE clause of the scan, or false if a filter has no encoding
+static bool EncodeWhere(const PushdownInput &input, string &where_clause) {
+	auto &bind_data = *input.bind_data;
+	auto column_ids = ScanColumnIds(*input.get);
+	auto encoded =
+		FilterEncoder::Encode(&input.get->table_filters, column_ids, bind_data.all_column_names, bind_data.all_types);
+	if (encoded.needs_duckdb_filter || !encoded.unhandled.empty()) {
+		DML_PUSHDOWN_DEBUG(1, "%llu filter(s) without an encoding", (unsigned long long)encoded.unhandled.size());
+		return false;
+	}
+	where_clause = encoded.where_clause;
+	if (!bind_data.complex_filter_where_clause.empty()) {
+		if (!where_clause.empty()) {
+			where_clause += " AND ";
+		}
+		where_clause += bind_data.complex_filter_where_clause;
+	}
+	return true;
+}
+
+static string AppendWhere(string sql, const string &where_clause) {
+	if (!where_clause.empty()) {
+		sql += " WHERE " + where_clause;
+	}
+	return sql;
+}
+
+//===----------------------------------------------------------------------===//
+// MSSQLDMLPushdown
+//===----------------------------------------------------------------------===//
+
+string MSSQLDMLPushdown::TryBuildUpdate(const LogicalUpdate &op, const MSSQLUpdateTarget &target) {
+	if (op.return_chunk || op.children.size() != 1 || op.expressions.size() != target.update_columns.size()) {
+		return "";
+	}
+	PushdownInput input;
+	if (!FindPushdownInput(*op.children[0], target.catalog_name, target.schema_name, target.table_name, input)) {
+		return "";
+	}
+	string where_clause;
+	if (!EncodeWhere(input, where_clause)) {
+		return "";
+	}
+
+	auto &bind_data = *input.bind_data;
+	auto output_columns = ScanOutputColumns(*input.get, ScanColumnIds(*input.get));
+	ExpressionEncodeContext ctx(output_columns, bind_data.all_column_names, bind_data.all_types);
+	if (!bind_data.pk_column_names.empty()) {
+		ctx.SetPKInfo(&bind_data.pk_column_names, &bind_data.pk_column_types, bind_data.pk_is_composite);
+	}
+	ctx.bound_refs_are_columns = true;
+
+	string set_clause;
+	for (idx_t i = 0; i < target.update_columns.size(); i++) {
+		auto value = op.expressions[i]->Copy();
+		if (!InlineResolvedProjections(value, input.projections, 0)) {
+			return "";
+		}
+		// A BOOLEAN expression encodes as a predicate, which is no value in T-SQL
+		auto value_class = value->GetExpressionClass();
+		if (value->GetReturnType().id() == LogicalTypeId::BOOLEAN && value_class != ExpressionClass::BOUND_REF &&
+			value_class != ExpressionClass::BOUND_CONSTANT) {
+			return "";
+		}
+		auto encoded = FilterEncoder::EncodeExpression(*value, ctx);
+		if (!encoded.supported || encoded.sql.empty()) {
+			DML_PUSHDOWN_DEBUG(1, "SET [%s]: no encoding for %s", target.update_columns[i].name.c_str(),
+							   value->ToString().c_str());
+			return "";
+		}
+		if (!set_clause.empty()) {
+			set_clause += ", ";
+		}
+		set_clause += "[" + FilterEncoder::EscapeBracketIdentifier(target.update_columns[i].name) + "] = ";
+		set_clause += encoded.sql;
+	}
+	return AppendWhere("UPDATE " + target.GetFullyQualifiedName() + " SET " + set_clause, where_clause);
+}
+
+string MSSQLDMLPushdown::TryBuildDelete(const LogicalDelete &op, const MSSQLDeleteTarget &target) {
+	if (op.return_chunk || op.children.size() != 1) {
+		return "";
+	}
+	PushdownInput input;
+	if (!FindPushdownInput(*op.children[0], target.catalog_name, target.schema_name, target.table_name, input)) {
+		return "";
+	}
+	string where_clause;
+	if (!EncodeWhere(input, where_clause)) {
+		return "";
+	}
+	return AppendWhere("DELETE FROM " + target.GetFullyQualifiedName(), where_clause);
+}
+
+// Both attachments log in to the same server as the same principal, so a
+// statement on one can read the other's database by its three-part name
+static bool SharesLogin(const MSSQLConnectionInfo &a, const MSSQLConnectionInfo &b) {
+	return StringUtil::CIEquals(a.host, b.host) && a.port == b.port &&
+		   StringUtil::CIEquals(a.instance_name, b.instance_name) && a.auth_method == b.auth_method &&
+		   a.user == b.user && a.azure_secret_name == b.azure_secret_name && a.access_token == b.access_token &&
+		   a.krb5_keytabfile == b.krb5_keytabfile && a.krb5_credcachefile == b.krb5_credcachefile;
+}
+
+string MSSQLDMLPushdown::TryBuildInsert(ClientContext &context, MSSQLCatalog &catalog, const LogicalInsert &op,
+									   const MSSQLInsertTarget &target) {
+	// The 2.0 child is full-width in table order, so output i feeds table column i
+	if (op.return_chunk || op.children.size() != 1 || !op.column_index_map.empty() ||
+		target.insert_column_indices.empty()) {
+		return "";
+	}
+	auto &source = *op.children[0];
+	string source_context;
+	string select_sql;
+	if (!EncodeRemoteSelect(source, &target.insert_column_indices, nullptr, source_context, select_sql)) {
+		return "";
+	}
+	if (source_context != catalog.GetContextName()) {
+		optional_ptr<MSSQLCatalog> source_catalog;
+		try {
+			auto &entry = Catalog::GetCatalog(context, Identifier(source_context));
+			if (entry.GetCatalogType() == "mssql") {
+				source_catalog = &entry.Cast<MSSQLCatalog>();
+			}
+		} catch (const std::exception &) {
+		}
+		// In a transaction of its own the source could hold writes, or locks,
+		// this connection does not see
+		if (!source_catalog || ConnectionProvider::IsInTransaction(context, *source_catalog) ||
+			!SharesLogin(catalog.GetConnectionInfo(), source_catalog->GetConnectionInfo())) {
+			DML_PUSHDOWN_DEBUG(1, "INSERT source '%s' is not reachable from '%s'", source_context.c_str(),
+							   catalog.GetContextName().c_str());
+			return "";
+		}
+		const auto &database = source_catalog->GetConnectionInfo().database;
+		if (database.empty() ||
+			!EncodeRemoteSelect(source, &target.insert_column_indices, &database, source_context, select_sql)) {
+			return "";
+		}
+	}
+
+	string column_list;
+	for (auto column_index : target.insert_column_indices) {
+		if (!column_list.empty()) {
+			column_list += ", ";
+		}
+		column_list += MSSQLValueSerializer::EscapeIdentifier(target.columns[column_index].name);
+	}
+	return "INSERT INTO " + target.GetFullyQualifiedName() + " (" + column_list + ") " + select_sql;
+}
+
+//===----------------------------------------------------------------------===//
+// MSSQLPhysicalDMLPushdown Implementation
+//===----------------------------------------------------------------------===//
+
+class MSSQLDMLPushdownSourceState : public GlobalSourceState {
+public:
+	//! Whether the statement has run
+	bool finished = false;
+};
+
+MSSQLPhysicalDMLPushdown::MSSQLPhysicalDMLPushdown(PhysicalPlan &plan, vector<LogicalType> types,
+												   idx_t estimated_cardinality, string catalog_name, string operation,
+												   string sql)
+	: PhysicalOperator(plan, TYPE, std::move(types), estimated_cardinality),
+	  catalog_name_(std::move(catalog_name)),
+	  operation_(std::move(operation)),
+	  sql_(std::move(sql)) {}
+
+unique_ptr<GlobalSourceState> MSSQLPhysicalDMLPushdown::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<MSSQLDMLPushdownSourceState>();
+}
+
+SourceResultType MSSQLPhysicalDMLPushdown::GetDataInternal(ExecutionContext &context, DataChunk &chunk,
+														   OperatorSourceInput &input) const {
+	auto &state = input.global_state.Cast<MSSQLDMLPushdownSourceState>();
+	if (state.finished) {
+		return SourceResultType::FINISHED;
+	}
+	state.finished = true;
+
+	auto &client = context.client;
+	auto &catalog = Catalog::GetCatalog(client, Identifier(catalog_name_)).Cast<MSSQLCatalog>();
+
+	// Acquire connection via ConnectionProvider (handles transaction pinning)
+	auto connection = ConnectionProvider::GetConnection(client, catalog);
+	if (!connection) {
+		throw IOException("MSSQL %s failed: could not acquire connection for '%s'", operation_, catalog_name_);
+	}
+
+	// One statement over the whole table: mssql_query_timeout, as for mssql_exec,
+	// rather than the per-batch timeout of the batched path
+	int query_timeout_s = LoadQueryTimeout(client);
+	int timeout_ms = 0;
+	if (query_timeout_s > 0 && query_timeout_s <= INT_MAX / 1000) {
+		timeout_ms = query_timeout_s * 1000;
+	}
+
+	DML_PUSHDOWN_DEBUG(1, "%s", sql_.c_str());
+	SimpleQueryResult result;
+	try {
+		result = MSSQLSimpleQuery::Execute(*connection, sql_, timeout_ms);
+	} catch (...) {
+		ConnectionProvider::ReleaseConnection(client, catalog, std::move(connection));
+		throw;
+	}
+	ConnectionProvider::ReleaseConnection(client, catalog, std::move(connection));
+
+	if (result.HasError()) {
+		throw IOException("MSSQL %s failed: SQL Server error %d: %s", operation_, (int)result.error_number,
+						  result.error_message);
+	}
+
+	chunk.SetChildCardinality(1);
+	chunk.SetValue(0, 0, Value::BIGINT(result.rows_affected));
+	return SourceResultType::FINISHED;
+}
+
+}  // namespace duckdb
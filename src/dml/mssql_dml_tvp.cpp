@@ -0,0 +1,107 @@
+#include "dml/mssql_dml_tvp.hpp"
+#include "catalog/mssql_primary_key.hpp"
+#include "dml/insert/mssql_value_serializer.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "tds/encoding/tvp_encoder.hpp"
+
+namespace duckdb {
+
+bool MSSQLDMLTvpType::TryCreate(const string &schema_name, vector<LogicalType> column_types,
+								vector<string> declarations, MSSQLDMLTvpType &result) {
+	if (column_types.empty()) {
+		return false;
+	}
+	declarations.resize(column_types.size());
+	for (idx_t i = 0; i < column_types.size(); i++) {
+		// The encoder must carry the value even where the declaration is the column's
+		auto encoded = tds::encoding::TvpEncoder::ColumnDeclaration(column_types[i]);
+		if (encoded.empty()) {
+			return false;
+		}
+		if (declarations[i].empty()) {
+			declarations[i] = std::move(encoded);
+		}
+	}
+	result.schema_name = schema_name;
+	result.type_name = tds::encoding::TvpEncoder::TypeName(declarations);
+	result.column_types = std::move(column_types);
+	result.column_declarations = std::move(declarations);
+	return true;
+}
+
+string MSSQLDMLTvpType::KeyColumnDeclaration(const mssql::PKColumnInfo &column) {
+	const auto type = StringUtil::Lower(column.type_name);
+	// sys.columns max_length is in bytes, -1 for MAX
+	const auto bytes = column.max_length < 0 ? string("max") : std::to_string(column.max_length);
+	const auto chars = column.max_length < 0 ? string("max") : std::to_string(column.max_length / 2);
+	string declaration;
+	if (type == "char" || type == "varchar" || type == "binary" || type == "varbinary") {
+		declaration = type + "(" + bytes + ")";
+	} else if (type == "nchar" || type == "nvarchar") {
+		declaration = type + "(" + chars + ")";
+	} else if (type == "decimal" || type == "numeric") {
+		declaration = type + "(" + std::to_string(column.precision) + "," + std::to_string(column.scale) + ")";
+	} else if (type == "datetime2" || type == "time" || type == "datetimeoffset") {
+		declaration = type + "(" + std::to_string(column.scale) + ")";
+	} else if (type == "bit" || type == "tinyint" || type == "smallint" || type == "int" || type == "bigint" ||
+			   type == "real" || type == "float" || type == "money" || type == "smallmoney" || type == "date" ||
+			   type == "datetime" || type == "smalldatetime" || type == "uniqueidentifier") {
+		declaration = type;
+	} else {
+		return "";
+	}
+	// Only character columns have one (the catalog fills in the database's)
+	if (!column.collation_name.empty()) {
+		declaration += " COLLATE " + column.collation_name;
+	}
+	return declaration;
+}
+
+string MSSQLDMLTvpType::GetQualifiedName() const {
+	return MSSQLValueSerializer::EscapeIdentifier(schema_name) + "." +
+		   MSSQLValueSerializer::EscapeIdentifier(type_name);
+}
+
+string MSSQLDMLTvpType::GenerateCreateSql() const {
+	// IF TYPE_ID(N'[s].[t]') IS NULL
+	// BEGIN
+	//   BEGIN TRY
+	//     CREATE TYPE [s].[t] AS TABLE ([c0] varchar(20) COLLATE ... NULL, [c1] nvarchar(max) NULL);
+	//   END TRY
+	//   BEGIN CATCH
+	//     -- rethrow unless another session created it after the check
+	//     IF TYPE_ID(N'[s].[t]') IS NULL BEGIN; THROW; END
+	//   END CATCH
+	// END
+	auto qualified = GetQualifiedName();
+	auto type_id = "TYPE_ID(" + MSSQLValueSerializer::Serialize(Value(qualified), LogicalType::VARCHAR) + ")";
+
+	string columns;
+	for (idx_t i = 0; i < column_declarations.size(); i++) {
+		if (i > 0) {
+			columns += ", ";
+		}
+		columns += "[c" + std::to_string(i) + "] " + column_declarations[i] + " NULL";
+	}
+
+	string sql = "IF " + type_id + " IS NULL\n";
+	sql += "BEGIN\n";
+	sql += "  BEGIN TRY\n";
+	sql += "    CREATE TYPE " + qualified + " AS TABLE (" + columns + ");\n";
+	sql += "  END TRY\n";
+	sql += "  BEGIN CATCH\n";
+	sql += "    IF " + type_id + " IS NULL BEGIN; THROW; END\n";
+	sql += "  END CATCH\n";
+	sql += "END";
+	return sql;
+}
+
+string MSSQLDMLTvpType::GenerateDeclaration() const {
+	return string(PARAMETER_NAME) + " " + GetQualifiedName() + " READONLY";
+}
+
+string MSSQLDMLTvpType::GenerateSource(const string &column_list) {
+	return "(SELECT * FROM " + string(PARAMETER_NAME) + ") AS v(" + column_list + ")";
+}
+
+}  // namespace duckdb
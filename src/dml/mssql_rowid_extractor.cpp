@@ -1,63 +1,89 @@
 #include "dml/mssql_rowid_extractor.hpp"
 #include "dml/insert/mssql_value_serializer.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/vector.hpp"
-#include "duckdb/common/vector_operations/vector_operations.hpp"
 
 namespace duckdb {
 
 //===----------------------------------------------------------------------===//
-// ExtractSingleRowPK - Extract PK values for a single row
+// ReferencePKColumns - Reference the PK columns of a rowid column
 //===----------------------------------------------------------------------===//
 
-vector<Value> ExtractSingleRowPK(Vector &rowid_vector, idx_t row_idx, const mssql::PrimaryKeyInfo &pk_info) {
-	vector<Value> pk_values;
-
+void ReferencePKColumns(Vector &rowid_vector, idx_t count, const mssql::PrimaryKeyInfo &pk_info, DataChunk &rows) {
 	if (!pk_info.exists || pk_info.columns.empty()) {
-		throw InternalException("ExtractSingleRowPK called on table without primary key");
+		throw InternalException("ReferencePKColumns called on table without primary key");
 	}
 
-	// Get the rowid value at the specified row index
-	auto rowid_value = rowid_vector.GetValue(row_idx);
-
 	if (pk_info.IsScalar()) {
 		// Scalar PK: rowid is the PK value directly
-		pk_values.push_back(std::move(rowid_value));
-	} else {
-		// Composite PK: rowid is STRUCT with PK fields
-		// Extract each field in PK column order
-		if (rowid_value.type().id() != LogicalTypeId::STRUCT) {
-			throw InternalException("Expected STRUCT rowid for composite PK, got %s", rowid_value.type().ToString());
-		}
+		rows.data.emplace_back(rowid_vector.GetType());
+		rows.data.back().Reference(rowid_vector);
+		return;
+	}
 
-		auto &struct_children = StructValue::GetChildren(rowid_value);
+	// Composite PK: rowid is STRUCT with PK fields
+	// Extract each field in PK column order
+	if (rowid_vector.GetType().id() != LogicalTypeId::STRUCT) {
+		throw InternalException("Expected STRUCT rowid for composite PK, got %s", rowid_vector.GetType().ToString());
+	}
+
+	auto &struct_children = StructVector::GetEntries(rowid_vector);
+	if (struct_children.size() < pk_info.columns.size()) {
+		throw InternalException("STRUCT rowid has fewer fields than PK columns");
+	}
 
-		// PK columns are stored in key_ordinal order (1-based in sys.index_columns)
-		// The STRUCT fields should match this order
-		for (idx_t i = 0; i < pk_info.columns.size(); i++) {
-			if (i >= struct_children.size()) {
-				throw InternalException("STRUCT rowid has fewer fields than PK columns");
-			}
-			pk_values.push_back(struct_children[i]);
+	// A flat STRUCT's children line up with its rows; otherwise row i is child
+	// row sel[i], so the children are sliced into row order
+	const bool is_flat = rowid_vector.GetVectorType() == VectorType::FLAT_VECTOR;
+	SelectionVector sel;
+	if (!is_flat) {
+		UnifiedVectorFormat fmt;
+		rowid_vector.ToUnifiedFormat(fmt);
+		sel.Initialize(count);
+		for (idx_t i = 0; i < count; i++) {
+			sel.set_index(i, fmt.sel->get_index(i));
 		}
 	}
 
-	return pk_values;
+	// PK columns are stored in key_ordinal order (1-based in sys.index_columns)
+	// The STRUCT fields should match this order
+	for (idx_t i = 0; i < pk_info.columns.size(); i++) {
+		auto &child = *struct_children[i];
+		rows.data.emplace_back(child.GetType());
+		rows.data.back().Reference(child);
+		if (!is_flat) {
+			rows.data.back().Slice(sel, count);
+		}
+	}
 }
 
 //===----------------------------------------------------------------------===//
-// ExtractPKFromRowid - Extract PK values from rowid column (bulk)
+// AppendRowRange - Append a range of rows to a pending batch
 //===----------------------------------------------------------------------===//
 
-vector<vector<Value>> ExtractPKFromRowid(Vector &rowid_vector, idx_t count, const mssql::PrimaryKeyInfo &pk_info) {
-	vector<vector<Value>> result;
-	result.reserve(count);
+void AppendRowRange(ColumnDataCollection &target, DataChunk &rows, idx_t offset, idx_t count) {
+	if (count == 0) {
+		return;
+	}
+	if (offset == 0 && count == rows.size()) {
+		target.Append(rows);
+		return;
+	}
 
+	// Slice a referencing copy, so `rows` itself is left as it is
+	DataChunk part;
+	for (auto &column : rows.data) {
+		part.data.emplace_back(column.GetType());
+		part.data.back().Reference(column);
+	}
+	part.SetCardinalityUnsafe(rows.size());
+	SelectionVector sel(count);
 	for (idx_t i = 0; i < count; i++) {
-		result.push_back(ExtractSingleRowPK(rowid_vector, i, pk_info));
+		sel.set_index(i, offset + i);
 	}
-
-	return result;
+	part.Slice(sel, count);
+	target.Append(part);
 }
 
 //===----------------------------------------------------------------------===//
@@ -8,8 +8,10 @@
 #include "dml/mssql_rowid_extractor.hpp"
 #include "dml/update/mssql_update_statement.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "query/mssql_simple_query.hpp"
 #include "tds/tds_connection_pool.hpp"
 #include "tds/tds_packet.hpp"
 #include "tds/tds_token_parser.hpp"
@@ -44,6 +46,29 @@ MSSQLUpdateExecutor::MSSQLUpdateExecutor(ClientContext &context, const MSSQLUpda
 	UPDATE_DEBUG(1, "UpdateExecutor: effective_batch_size=%llu (params_per_row=%llu)",
 				 (unsigned long long)effective_batch_size_, (unsigned long long)target_.GetParamsPerRow());
 
+	// TVP path: a batch is one table-valued parameter, not bounded by the parameter limit
+	if (config_.use_tvp) {
+		vector<LogicalType> column_types;
+		vector<string> declarations;
+		for (auto &pk_col : target_.pk_info.columns) {
+			column_types.push_back(pk_col.duckdb_type);
+			declarations.push_back(MSSQLDMLTvpType::KeyColumnDeclaration(pk_col));
+		}
+		for (auto &update_col : target_.update_columns) {
+			column_types.push_back(update_col.duckdb_type);
+		}
+		auto tvp_type = make_uniq<MSSQLDMLTvpType>();
+		if (MSSQLDMLTvpType::TryCreate(target_.schema_name, std::move(column_types), std::move(declarations),
+									   *tvp_type)) {
+			tvp_type_ = std::move(tvp_type);
+			effective_batch_size_ = config_.tvp_batch_size;
+			UPDATE_DEBUG(1, "UpdateExecutor: TVP path, type=%s, batch_size=%llu",
+						 tvp_type_->GetQualifiedName().c_str(), (unsigned long long)effective_batch_size_);
+		} else {
+			UPDATE_DEBUG(1, "UpdateExecutor: a column type has no TVP encoding, using VALUES batches");
+		}
+	}
+
 	// Check if we need to defer execution until Finalize
 	// This is required when in an explicit transaction because:
 	// 1. The scan uses the pinned connection to stream rowids
@@ -60,7 +85,13 @@ MSSQLUpdateExecutor::MSSQLUpdateExecutor(ClientContext &context, const MSSQLUpda
 	}
 }
 
-MSSQLUpdateExecutor::~MSSQLUpdateExecutor() = default;
+MSSQLUpdateExecutor::~MSSQLUpdateExecutor() {
+	// Finalize was never reached (error or cancel): give the connection back
+	try {
+		ReleaseConnection();
+	} catch (...) {
+	}
+}
 
 tds::ConnectionPool &MSSQLUpdateExecutor::GetConnectionPool() {
 	if (connection_pool_) {
@@ -74,6 +105,46 @@ tds::ConnectionPool &MSSQLUpdateExecutor::GetConnectionPool() {
 	return *connection_pool_;
 }
 
+std::shared_ptr<tds::TdsConnection> MSSQLUpdateExecutor::AcquireConnection() {
+	if (connection_) {
+		return connection_;
+	}
+	auto &catalog = Catalog::GetCatalog(context_, Identifier(target_.catalog_name));
+	connection_catalog_ = &catalog.Cast<MSSQLCatalog>();
+
+	// Acquire connection via ConnectionProvider (handles transaction pinning)
+	connection_ = ConnectionProvider::GetConnection(context_, *connection_catalog_);
+	if (connection_) {
+		connection_->SetPreparedCacheCapacity(config_.prepared_cache_size);
+	}
+	return connection_;
+}
+
+void MSSQLUpdateExecutor::PrepareTvpType() {
+	string error = "failed to acquire connection";
+	auto connection = AcquireConnection();
+	if (connection) {
+		auto result = MSSQLSimpleQuery::Execute(*connection, tvp_type_->GenerateCreateSql());
+		if (!result.HasError()) {
+			tvp_type_ready_ = true;
+			return;
+		}
+		error = result.error_message;
+	}
+	// Typically no CREATE TYPE permission: VALUES batches need none
+	UPDATE_DEBUG(1, "PrepareTvpType: %s, falling back to VALUES batches", error.c_str());
+	tvp_type_.reset();
+	effective_batch_size_ = config_.EffectiveBatchSize(target_.GetParamsPerRow());
+}
+
+void MSSQLUpdateExecutor::ReleaseConnection() {
+	if (!connection_) {
+		return;
+	}
+	ConnectionProvider::ReleaseConnection(context_, *connection_catalog_, std::move(connection_));
+	connection_ = nullptr;
+}
+
 idx_t MSSQLUpdateExecutor::Execute(DataChunk &chunk) {
 	UPDATE_DEBUG(1, "Execute: chunk_size=%llu", (unsigned long long)chunk.size());
 
@@ -81,30 +152,43 @@ idx_t MSSQLUpdateExecutor::Execute(DataChunk &chunk) {
 		throw InternalException("MSSQLUpdateExecutor::Execute called after Finalize");
 	}
 
-	// Process each row in the chunk
-	for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
-		AccumulateRow(chunk, row_idx);
+	// The batch size must be settled before rows are cut into batches
+	// (in defer_execution_ mode that happens in Finalize)
+	if (tvp_type_ && !tvp_type_ready_ && !defer_execution_) {
+		PrepareTvpType();
+	}
 
-		// Check if we need to flush the batch
-		// In defer_execution_ mode, we accumulate everything and flush in Finalize
-		if (!defer_execution_ && pending_pk_values_.size() >= effective_batch_size_) {
-			UPDATE_DEBUG(1, "Execute: batch full at row %llu, flushing...", (unsigned long long)row_idx);
-			auto result = FlushBatch();
-			if (!result.success) {
-				throw IOException("%s", result.FormatError("UPDATE"));
-			}
-		}
+	// DuckDB UPDATE chunk layout:
+	// - Columns 0 to N-1: update expression values
+	// - Column N: rowid (added by BindRowIdColumns at the END of projection)
+	//
+	// The rowid column is the LAST column in the chunk. Its PK columns and the
+	// update columns are referenced in VALUES order, without copying.
+	idx_t rowid_col_idx = chunk.ColumnCount() - 1;
+	DataChunk rows;
+	ReferencePKColumns(chunk.data[rowid_col_idx], chunk.size(), target_.pk_info, rows);
+	for (auto &update_col : target_.update_columns) {
+		// Update column values are at chunk index as specified in update_col.chunk_index
+		auto &values = chunk.data[update_col.chunk_index];
+		rows.data.emplace_back(values.GetType());
+		rows.data.back().Reference(values);
+	}
+	rows.SetCardinalityUnsafe(chunk.size());
+
+	auto result = BufferRows(rows);
+	if (!result.success) {
+		throw IOException("%s", result.FormatError("UPDATE"));
 	}
 
 	UPDATE_DEBUG(1, "Execute: chunk processed, total_updated=%llu, pending=%llu",
-				 (unsigned long long)total_rows_updated_, (unsigned long long)pending_pk_values_.size());
+				 (unsigned long long)total_rows_updated_, (unsigned long long)PendingRowCount());
 
 	return total_rows_updated_;
 }
 
 MSSQLDMLResult MSSQLUpdateExecutor::Finalize() {
 	UPDATE_DEBUG(1, "Finalize: starting, finalized=%d, pending=%llu, defer_execution=%d", finalized_,
-				 (unsigned long long)pending_pk_values_.size(), defer_execution_);
+				 (unsigned long long)PendingRowCount(), defer_execution_);
 
 	if (finalized_) {
 		return MSSQLDMLResult::Success(total_rows_updated_, batch_count_);
@@ -112,77 +196,96 @@ MSSQLDMLResult MSSQLUpdateExecutor::Finalize() {
 
 	finalized_ = true;
 
-	// Flush all remaining rows in batches
-	// In defer_execution_ mode, we may have accumulated many batches worth of rows
-	while (!pending_pk_values_.empty()) {
-		UPDATE_DEBUG(1, "Finalize: flushing batch, pending=%llu", (unsigned long long)pending_pk_values_.size());
+	// In defer_execution_ mode every row was held until now: the scan is done,
+	// so cut them into batches (flushing each one as it fills)
+	if (defer_execution_) {
+		defer_execution_ = false;
+		auto buffered = std::move(pending_);
+		if (buffered) {
+			if (tvp_type_ && !tvp_type_ready_) {
+				PrepareTvpType();
+			}
+			for (auto &chunk : buffered->Chunks()) {
+				auto result = BufferRows(chunk);
+				if (!result.success) {
+					ReleaseConnection();
+					return result;
+				}
+			}
+		}
+	}
+
+	// Flush the last, partial batch
+	if (PendingRowCount() > 0) {
+		UPDATE_DEBUG(1, "Finalize: flushing batch, pending=%llu", (unsigned long long)PendingRowCount());
 		auto result = FlushBatch();
 		if (!result.success) {
+			ReleaseConnection();
 			return result;
 		}
 	}
+	ReleaseConnection();
 
 	UPDATE_DEBUG(1, "Finalize: done, total_updated=%llu, batch_count=%llu", (unsigned long long)total_rows_updated_,
 				 (unsigned long long)batch_count_);
 	return MSSQLDMLResult::Success(total_rows_updated_, batch_count_);
 }
 
-void MSSQLUpdateExecutor::AccumulateRow(DataChunk &chunk, idx_t row_idx) {
-	// DuckDB UPDATE chunk layout:
-	// - Columns 0 to N-1: update expression values
-	// - Column N: rowid (added by BindRowIdColumns at the END of projection)
-	//
-	// The rowid column is the LAST column in the chunk
-	idx_t rowid_col_idx = chunk.ColumnCount() - 1;
-
-	// Extract PK values from rowid (last column)
-	auto pk_values = ExtractSingleRowPK(chunk.data[rowid_col_idx], row_idx, target_.pk_info);
-	pending_pk_values_.push_back(std::move(pk_values));
+MSSQLDMLResult MSSQLUpdateExecutor::BufferRows(DataChunk &rows) {
+	idx_t offset = 0;
+	while (offset < rows.size()) {
+		if (!pending_) {
+			pending_ = make_uniq<ColumnDataCollection>(Allocator::Get(context_), rows.GetTypes());
+		}
 
-	// Extract update values (columns 0 to N-1)
-	vector<Value> update_values;
-	update_values.reserve(target_.update_columns.size());
+		// Fill the pending batch up to the batch size
+		// In defer_execution_ mode, we accumulate everything and cut batches in Finalize
+		idx_t count = rows.size() - offset;
+		if (!defer_execution_) {
+			count = MinValue<idx_t>(count, effective_batch_size_ - pending_->Count());
+		}
+		AppendRowRange(*pending_, rows, offset, count);
+		offset += count;
 
-	for (idx_t col_idx = 0; col_idx < target_.update_columns.size(); col_idx++) {
-		auto &update_col = target_.update_columns[col_idx];
-		// Update column values are at chunk index as specified in update_col.chunk_index
-		auto value = chunk.data[update_col.chunk_index].GetValue(row_idx);
-		update_values.push_back(std::move(value));
+		if (!defer_execution_ && pending_->Count() >= effective_batch_size_) {
+			UPDATE_DEBUG(1, "BufferRows: batch full, flushing...");
+			auto result = FlushBatch();
+			if (!result.success) {
+				return result;
+			}
+		}
 	}
+	return MSSQLDMLResult::Success(total_rows_updated_, batch_count_);
+}
 
-	pending_update_values_.push_back(std::move(update_values));
+idx_t MSSQLUpdateExecutor::PendingRowCount() const {
+	return pending_ ? pending_->Count() : 0;
 }
 
 MSSQLDMLResult MSSQLUpdateExecutor::FlushBatch() {
-	if (pending_pk_values_.empty()) {
+	if (PendingRowCount() == 0) {
 		return MSSQLDMLResult::Success(0, batch_count_);
 	}
 
 	batch_count_++;
 
-	// Extract up to effective_batch_size_ rows for this batch
-	idx_t rows_to_process = std::min<idx_t>(pending_pk_values_.size(), effective_batch_size_);
+	// The pending rows become this batch; the next row starts a new one
+	auto batch_rows = std::move(pending_);
 
-	vector<vector<Value>> batch_pk_values;
-	vector<vector<Value>> batch_update_values;
-	batch_pk_values.reserve(rows_to_process);
-	batch_update_values.reserve(rows_to_process);
-
-	for (idx_t i = 0; i < rows_to_process; i++) {
-		batch_pk_values.push_back(std::move(pending_pk_values_[i]));
-		batch_update_values.push_back(std::move(pending_update_values_[i]));
-	}
-
-	// Remove processed rows from pending
-	pending_pk_values_.erase(pending_pk_values_.begin(), pending_pk_values_.begin() + rows_to_process);
-	pending_update_values_.erase(pending_update_values_.begin(), pending_update_values_.begin() + rows_to_process);
-
-	UPDATE_DEBUG(1, "FlushBatch: batch %llu with %llu rows (remaining=%llu)", (unsigned long long)batch_count_,
-				 (unsigned long long)rows_to_process, (unsigned long long)pending_pk_values_.size());
+	UPDATE_DEBUG(1, "FlushBatch: batch %llu with %llu rows", (unsigned long long)batch_count_,
+				 (unsigned long long)batch_rows->Count());
 
 	// Build the UPDATE statement
-	MSSQLUpdateStatement stmt(target_);
-	auto batch = stmt.Build(batch_pk_values, batch_update_values, batch_count_);
+	MSSQLDMLBatch batch;
+	if (tvp_type_) {
+		batch = MSSQLUpdateStatement(target_).BuildTvp(*tvp_type_, *batch_rows, batch_count_);
+	}
+	if (!batch.IsValid()) {
+		// VALUES path. A TVP-sized batch with a value the TVP cannot carry is
+		// inlined: as parameters it could exceed the request's parameter limit.
+		MSSQLUpdateStatement stmt(target_, config_.use_prepared && !tvp_type_);
+		batch = stmt.Build(*batch_rows, batch_count_);
+	}
 
 	if (!batch.IsValid()) {
 		return MSSQLDMLResult::Failure("Failed to build UPDATE batch", 0, batch_count_);
@@ -192,7 +295,7 @@ MSSQLDMLResult MSSQLUpdateExecutor::FlushBatch() {
 
 	// Execute the batch
 	try {
-		auto rows_affected = ExecuteBatch(batch.sql);
+		auto rows_affected = ExecuteBatch(batch);
 		total_rows_updated_ += rows_affected;
 		UPDATE_DEBUG(1, "FlushBatch: rows_affected=%llu", (unsigned long long)rows_affected);
 		return MSSQLDMLResult::Success(rows_affected, batch_count_);
@@ -201,15 +304,11 @@ MSSQLDMLResult MSSQLUpdateExecutor::FlushBatch() {
 	}
 }
 
-idx_t MSSQLUpdateExecutor::ExecuteBatch(const string &sql) {
-	UPDATE_DEBUG(1, "ExecuteBatch: starting, sql_length=%zu", sql.size());
-
-	// Get the MSSQLCatalog for ConnectionProvider
-	auto &catalog = Catalog::GetCatalog(context_, Identifier(target_.catalog_name));
-	auto &mssql_catalog = catalog.Cast<MSSQLCatalog>();
+idx_t MSSQLUpdateExecutor::ExecuteBatch(const MSSQLDMLBatch &batch) {
+	UPDATE_DEBUG(1, "ExecuteBatch: starting, sql_length=%zu", batch.sql.size());
 
-	// Acquire connection via ConnectionProvider (handles transaction pinning)
-	auto connection = ConnectionProvider::GetConnection(context_, mssql_catalog);
+	// One connection for every batch of the statement, so its prepared handles are reused
+	auto connection = AcquireConnection();
 	if (!connection) {
 		UPDATE_DEBUG(1, "ExecuteBatch: failed to acquire connection");
 		throw IOException("Failed to acquire connection for UPDATE execution");
@@ -224,19 +323,19 @@ idx_t MSSQLUpdateExecutor::ExecuteBatch(const string &sql) {
 		auto *socket = connection->GetSocket();
 		if (!socket) {
 			UPDATE_DEBUG(1, "ExecuteBatch: socket is null");
-			ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+			ReleaseConnection();
 			throw IOException("Connection socket is null");
 		}
 
 		// Clear any leftover data before starting
 		socket->ClearReceiveBuffer();
 
-		// Send the SQL batch
-		UPDATE_DEBUG(1, "ExecuteBatch: sending SQL batch...");
-		if (!connection->ExecuteBatch(sql)) {
+		// Send the batch: sp_execute / sp_prepexec with its parameters, or a plain SQL batch
+		UPDATE_DEBUG(1, "ExecuteBatch: sending batch, %zu parameter(s)...", batch.parameters.values.size());
+		if (!connection->ExecutePrepared(batch.sql, batch.parameters)) {
 			string error = connection->GetLastError();
 			UPDATE_DEBUG(1, "ExecuteBatch: ExecuteBatch failed, error=%s", error.c_str());
-			ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+			ReleaseConnection();
 			throw IOException("UPDATE execution failed: %s", error);
 		}
 
@@ -258,7 +357,7 @@ idx_t MSSQLUpdateExecutor::ExecuteBatch(const string &sql) {
 				UPDATE_DEBUG(1, "ExecuteBatch: TIMEOUT after 30s, packets_received=%d", packet_count);
 				connection->SendAttention();
 				connection->WaitForAttentionAck(5000);
-				ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+				ReleaseConnection();
 				throw IOException("UPDATE execution timeout");
 			}
 
@@ -270,7 +369,7 @@ idx_t MSSQLUpdateExecutor::ExecuteBatch(const string &sql) {
 			if (!socket->ReceivePacket(packet, recv_timeout)) {
 				string socket_error = socket->GetLastError();
 				UPDATE_DEBUG(1, "ExecuteBatch: ReceivePacket FAILED, error='%s'", socket_error.c_str());
-				ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+				ReleaseConnection();
 				throw IOException("Failed to receive TDS packet: %s", socket_error);
 			}
 
@@ -314,6 +413,12 @@ idx_t MSSQLUpdateExecutor::ExecuteBatch(const string &sql) {
 					// Continue reading to drain the response
 					break;
 				}
+				case tds::ParsedTokenType::ReturnValue:
+					// sp_prepexec's handle, cached for the next batch of the same shape
+					if (!connection->OnReturnValue(parser.GetReturnValue()) && error_message.empty()) {
+						error_message = "sp_prepexec returned its statement handle in an unexpected type";
+					}
+					break;
 				default:
 					// Skip other tokens
 					break;
@@ -333,18 +438,17 @@ idx_t MSSQLUpdateExecutor::ExecuteBatch(const string &sql) {
 
 		// Check for errors
 		if (!error_message.empty()) {
-			ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+			ReleaseConnection();
 			throw IOException("UPDATE failed: %s", error_message);
 		}
 
 	} catch (const IOException &) {
 		throw;	// Re-throw IO exceptions
 	} catch (const std::exception &e) {
-		ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
+		ReleaseConnection();
 		throw IOException("UPDATE execution failed: %s", e.what());
 	}
 
-	ConnectionProvider::ReleaseConnection(context_, mssql_catalog, std::move(connection));
 	return rows_affected;
 }
 
@@ -2,6 +2,8 @@
 #include "dml/insert/mssql_value_serializer.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "tds/encoding/rpc_parameter_encoder.hpp"
+#include "tds/encoding/tvp_encoder.hpp"
 
 namespace duckdb {
 
@@ -9,25 +11,25 @@ namespace duckdb {
 // MSSQLUpdateStatement Implementation
 //===----------------------------------------------------------------------===//
 
-MSSQLUpdateStatement::MSSQLUpdateStatement(const MSSQLUpdateTarget &target) : target_(target) {}
+MSSQLUpdateStatement::MSSQLUpdateStatement(const MSSQLUpdateTarget &target, bool parameterize)
+	: target_(target), parameterize_(parameterize) {}
 
-MSSQLDMLBatch MSSQLUpdateStatement::Build(const vector<vector<Value>> &pk_values,
-										  const vector<vector<Value>> &update_values, idx_t batch_number) {
+MSSQLDMLBatch MSSQLUpdateStatement::Build(ColumnDataCollection &rows, idx_t batch_number) {
 	MSSQLDMLBatch batch;
 	batch.batch_number = batch_number;
-	batch.row_count = pk_values.size();
+	batch.row_count = rows.Count();
 
 	if (batch.row_count == 0) {
 		return batch;
 	}
 
-	// Build SQL statement using inline literals (not parameters)
+	// Build SQL statement with typed parameters (or inline literals)
 	// UPDATE t
 	// SET t.[col1] = v.[col1], t.[col2] = v.[col2]
 	// FROM [schema].[table] AS t
 	// JOIN (VALUES
-	//   (1, 'value1', 100),
-	//   (2, 'value2', 200)
+	//   (@p0, @p1, @p2),
+	//   (@p3, @p4, @p5)
 	// ) AS v([pk1], [col1], [col2])
 	// ON t.[pk1] = v.[pk1]
 
@@ -36,39 +38,44 @@ MSSQLDMLBatch MSSQLUpdateStatement::Build(const vector<vector<Value>> &pk_values
 	sql += "\nFROM " + target_.GetFullyQualifiedName() + " AS t\n";
 	sql += "JOIN (VALUES\n";
 
-	for (idx_t row_idx = 0; row_idx < batch.row_count; row_idx++) {
-		if (row_idx > 0) {
-			sql += ",\n";
+	const idx_t pk_count = target_.pk_info.columns.size();
+	bool first_row = true;
+	for (auto &chunk : rows.Chunks()) {
+		// One format per column per chunk; cells are read through it
+		vector<UnifiedVectorFormat> formats(chunk.ColumnCount());
+		for (idx_t col = 0; col < chunk.ColumnCount(); col++) {
+			chunk.data[col].ToUnifiedFormat(formats[col]);
 		}
-		sql += "  (";
 
-		// Add PK values first (serialized as literals)
-		for (idx_t pk_idx = 0; pk_idx < pk_values[row_idx].size(); pk_idx++) {
-			if (pk_idx > 0) {
-				sql += ", ";
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			if (!first_row) {
+				sql += ",\n";
 			}
-			const auto &pk_type = target_.pk_info.columns[pk_idx].duckdb_type;
-			sql += MSSQLValueSerializer::Serialize(pk_values[row_idx][pk_idx], pk_type);
-		}
-
-		// Add update values (serialized as literals)
-		for (idx_t col_idx = 0; col_idx < update_values[row_idx].size(); col_idx++) {
-			sql += ", ";
-			const auto &col_type = target_.update_columns[col_idx].duckdb_type;
-			auto literal = MSSQLValueSerializer::Serialize(update_values[row_idx][col_idx], col_type);
-
-			// XML columns: reject if serialized literal exceeds SQL Server's TDS buffer limit
-			if (target_.update_columns[col_idx].mssql_type == "xml" && literal.size() > 4096) {
-				throw InvalidInputException(
-					"MSSQL Error: XML column '%s' value is too large for UPDATE via SQL literals "
-					"(%zu bytes, limit 4096). Use COPY TO with BCP protocol instead (FORMAT bcp).",
-					target_.update_columns[col_idx].name.c_str(), literal.size());
+			first_row = false;
+			sql += "  (";
+
+			// PK values first, then update values
+			for (idx_t col = 0; col < chunk.ColumnCount(); col++) {
+				if (col > 0) {
+					sql += ", ";
+				}
+				const idx_t literal_start = sql.size();
+				EncodeValue(chunk.data[col], formats[col], row, GetColumnType(col), batch, sql);
+
+				// XML columns: reject if serialized literal exceeds SQL Server's TDS buffer limit
+				// (a parameter placeholder is never that long)
+				const idx_t literal_size = sql.size() - literal_start;
+				if (col >= pk_count && target_.update_columns[col - pk_count].mssql_type == "xml" &&
+					literal_size > 4096) {
+					throw InvalidInputException(
+						"MSSQL Error: XML column '%s' value is too large for UPDATE via SQL literals "
+						"(%zu bytes, limit 4096). Use COPY TO with BCP protocol instead (FORMAT bcp).",
+						target_.update_columns[col - pk_count].name.c_str(), literal_size);
+				}
 			}
 
-			sql += literal;
+			sql += ")";
 		}
-
-		sql += ")";
 	}
 
 	sql += "\n) AS v(" + GenerateValuesColumnList() + ")\n";
@@ -78,6 +85,69 @@ MSSQLDMLBatch MSSQLUpdateStatement::Build(const vector<vector<Value>> &pk_values
 	return batch;
 }
 
+MSSQLDMLBatch MSSQLUpdateStatement::BuildTvp(const MSSQLDMLTvpType &tvp_type, ColumnDataCollection &rows,
+											 idx_t batch_number) const {
+	MSSQLDMLBatch batch;
+	batch.batch_number = batch_number;
+	batch.row_count = rows.Count();
+
+	if (batch.row_count == 0) {
+		return batch;
+	}
+
+	// Rows in VALUES order: PK values, then update values
+	tds::encoding::TvpEncoder tvp(tvp_type.column_types);
+	for (auto &chunk : rows.Chunks()) {
+		vector<UnifiedVectorFormat> formats(chunk.ColumnCount());
+		for (idx_t col = 0; col < chunk.ColumnCount(); col++) {
+			chunk.data[col].ToUnifiedFormat(formats[col]);
+		}
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			tvp.BeginRow();
+			for (idx_t col = 0; col < chunk.ColumnCount(); col++) {
+				if (!tvp.AppendFromFormat(chunk.data[col], formats[col], row)) {
+					return MSSQLDMLBatch();
+				}
+			}
+		}
+	}
+	batch.parameters.declarations = tvp_type.GenerateDeclaration();
+	batch.parameters.values.push_back(
+		tvp.Finish(MSSQLDMLTvpType::PARAMETER_NAME, tvp_type.schema_name, tvp_type.type_name));
+
+	// UPDATE t
+	// SET t.[col1] = v.[col1]
+	// FROM [schema].[table] AS t
+	// JOIN (SELECT * FROM @rows) AS v([pk1], [col1])
+	// ON t.[pk1] = v.[pk1]
+	batch.sql = "UPDATE t\n";
+	batch.sql += GenerateSetClause();
+	batch.sql += "\nFROM " + target_.GetFullyQualifiedName() + " AS t\n";
+	batch.sql += "JOIN " + MSSQLDMLTvpType::GenerateSource(GenerateValuesColumnList()) + "\n";
+	batch.sql += GenerateOnClause();
+	return batch;
+}
+
+void MSSQLUpdateStatement::EncodeValue(Vector &input, const UnifiedVectorFormat &fmt, idx_t row,
+									   const LogicalType &type, MSSQLDMLBatch &batch, string &sql) const {
+	if (parameterize_) {
+		auto placeholder = tds::encoding::RpcParameterEncoder::BindFromFormat(input, fmt, row, type, batch.parameters);
+		if (!placeholder.empty()) {
+			sql += placeholder;
+			return;
+		}
+	}
+	MSSQLValueSerializer::AppendFromFormat(input, fmt, row, type, sql);
+}
+
+const LogicalType &MSSQLUpdateStatement::GetColumnType(idx_t col) const {
+	const idx_t pk_count = target_.pk_info.columns.size();
+	if (col < pk_count) {
+		return target_.pk_info.columns[col].duckdb_type;
+	}
+	return target_.update_columns[col - pk_count].duckdb_type;
+}
+
 string MSSQLUpdateStatement::GenerateSetClause() const {
 	string result = "SET ";
 	for (idx_t i = 0; i < target_.update_columns.size(); i++) {
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 #include "catalog/mssql_catalog_filter.hpp"
@@ -229,6 +231,24 @@ public:
 	// find+erase is atomic under one lock.
 	std::unique_ptr<MSSQLResultStream> RetrieveStream(const std::string &uuid);
 
+	//===----------------------------------------------------------------------===//
+	// Described Result Shapes (mssql_scan_describe_bind)
+	//
+	// Result columns of mssql_scan queries, as sp_describe_first_result_set
+	// reported them, keyed on the exact query text. Lets a re-bound query skip
+	// the describe round trip too. Cleared with the metadata cache, and an entry
+	// that no longer matches the executed result is dropped at InitGlobal.
+	//===----------------------------------------------------------------------===//
+
+	struct DescribedResult {
+		vector<LogicalType> types;
+		vector<string> names;
+	};
+
+	bool TryGetDescribedResult(const std::string &query, DescribedResult &out) const;
+	void CacheDescribedResult(const std::string &query, DescribedResult result);
+	void ForgetDescribedResult(const std::string &query);
+
 	//===----------------------------------------------------------------------===//
 	// Access Mode (READ_ONLY Support)
 	//===----------------------------------------------------------------------===//
@@ -297,6 +317,25 @@ private:
 	// Query database default collation
 	void QueryDatabaseCollation();
 
+	// Catalog snapshot (ATTACH option catalog_snapshot): fill the metadata cache
+	// from the file at ATTACH, write it back at teardown. Both are best effort.
+	void LoadCatalogSnapshot();
+	void SaveCatalogSnapshot();
+
+	// Delta refresh (mssql_catalog_delta_refresh): patch the metadata cache once
+	// its TTL is within `margin_seconds` of running out, then evict the bound
+	// entries of whatever changed. `context` (null from the background thread)
+	// selects the transaction's pinned connection. Returns false when nothing ran
+	// or it failed; the cache is then left to the usual full reload.
+	bool RefreshCatalogDelta(ClientContext *context, int64_t margin_seconds);
+
+	// Background refresh (mssql_catalog_background_refresh): a thread, started on
+	// first use, that runs the delta refresh halfway through the TTL so lookups
+	// find a fresh cache. Stopped before the pool goes away.
+	void StartBackgroundRefresh();
+	void StopBackgroundRefresh();
+	void BackgroundRefreshLoop();
+
 	//===----------------------------------------------------------------------===//
 	// Member Variables
 	//===----------------------------------------------------------------------===//
@@ -318,6 +357,15 @@ private:
 	unique_ptr<MSSQLStatisticsProvider> statistics_provider_;  // Statistics provider
 	string database_collation_;								   // Database default collation
 	string default_schema_;									   // Default schema ("dbo")
+	string snapshot_path_;									   // Snapshot file (empty = disabled)
+	string snapshot_key_;									   // Server, database and login it is for
+
+	// Background refresh thread; refresh_stop_ is guarded by refresh_mutex_
+	std::thread refresh_thread_;
+	std::mutex refresh_mutex_;
+	std::condition_variable refresh_cv_;
+	bool refresh_stop_ = false;
+	std::atomic<bool> background_refresh_{false};  // Setting as of the last lookup
 	// Spec 052 (Option D): shared_ptr ownership for schema entries. The bind-
 	// time anchor (MSSQLBindAnchors, per ClientContext, released at QueryEnd)
 	// keeps entries alive across concurrent Invalidate / OnDetach. emplace-
@@ -331,6 +379,12 @@ private:
 	// two via the serializable BindData.
 	mutable std::mutex streams_mutex_;
 	std::unordered_map<std::string, std::unique_ptr<MSSQLResultStream>> active_streams_;
+
+	// Described result shapes (see TryGetDescribedResult). Bounded: cleared
+	// wholesale when full rather than tracking recency — re-describing costs
+	// one round trip.
+	mutable std::mutex described_mutex_;
+	std::unordered_map<std::string, DescribedResult> described_results_;
 };
 
 }  // namespace duckdb
@@ -0,0 +1,278 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// catalog/mssql_catalog_snapshot.hpp
+//
+// On-disk copy of the metadata cache's column lists (ATTACH option
+// `catalog_snapshot`), so re-attaching a database with thousands of tables
+// does not rediscover every column.
+//
+// The file is a hint, never the truth. On ATTACH the cache lists every object
+// with its object_id and modify_date in one query, takes the columns of each
+// object whose pair still matches from the snapshot, and reloads only the
+// rest. ALTER TABLE moves modify_date; DROP + CREATE moves object_id. A file
+// that is missing, truncated, from another build or for another login is
+// ignored and rewritten at DETACH.
+//
+// The file name is a hash of the key (server, database, login), so one
+// directory serves any number of attachments; the key is stored in the file
+// as well and compared on load.
+//
+// Deliberately a self-contained header of plain types, like
+// table_scan/scan_range_policy.hpp: -I src/include is the whole build recipe
+// for test/cpp/test_catalog_snapshot.cpp.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+//! One sys.columns row, as the metadata queries return it
+struct MSSQLSnapshotColumn {
+	std::string name;
+	int32_t column_id = 0;
+	std::string type_name;
+	int16_t max_length = 0;
+	uint8_t precision = 0;
+	uint8_t scale = 0;
+	bool is_nullable = true;
+	std::string collation_name;
+};
+
+//! A table or view whose columns were loaded when the snapshot was written
+struct MSSQLSnapshotTable {
+	std::string schema_name;
+	std::string name;
+	int64_t object_id = 0;
+	//! CONVERT(varchar(23), sys.objects.modify_date, 121)
+	std::string modify_date;
+	std::vector<MSSQLSnapshotColumn> columns;
+};
+
+struct MSSQLCatalogSnapshot {
+	//! MSSQLCatalogSnapshotKey() of the attachment that wrote it
+	std::string key;
+	std::vector<MSSQLSnapshotTable> tables;
+};
+
+//! Bumped whenever the encoding changes; older files are then ignored
+constexpr uint32_t MSSQL_CATALOG_SNAPSHOT_VERSION = 1;
+
+//! Server, database and login of an attachment. Host, database and login are
+//! compared case-insensitively by SQL Server's default collations, so they are
+//! lowered here.
+inline std::string MSSQLCatalogSnapshotKey(const std::string &host, uint16_t port, const std::string &database,
+										   const std::string &login) {
+	auto lower = [](std::string value) {
+		std::transform(value.begin(), value.end(), value.begin(),
+					   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return value;
+	};
+	return lower(host) + ":" + std::to_string(port) + "/" + lower(database) + "/" + lower(login);
+}
+
+//! FNV-1a, 64-bit. Stable across builds and platforms, unlike std::hash.
+inline uint64_t MSSQLCatalogSnapshotHash(const std::string &data) {
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned char c : data) {
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+//! `directory`/mssql_catalog_<hash of key>.snapshot
+inline std::string MSSQLCatalogSnapshotPath(const std::string &directory, const std::string &key) {
+	static const char *HEX = "0123456789abcdef";
+	uint64_t hash = MSSQLCatalogSnapshotHash(key);
+	std::string name = "mssql_catalog_";
+	for (int shift = 60; shift >= 0; shift -= 4) {
+		name += HEX[(hash >> shift) & 0xF];
+	}
+	name += ".snapshot";
+	if (directory.empty()) {
+		return name;
+	}
+	char last = directory.back();
+	return (last == '/' || last == '\\') ? directory + name : directory + "/" + name;
+}
+
+//===----------------------------------------------------------------------===//
+// Encoding: "MSSQLCAT", version, payload, FNV-1a of the payload. Integers are
+// little-endian, strings are a uint32 length and the bytes.
+//===----------------------------------------------------------------------===//
+
+namespace mssql_snapshot_detail {
+
+static const char MAGIC[8] = {'M', 'S', 'S', 'Q', 'L', 'C', 'A', 'T'};
+
+inline void PutUInt(std::string &out, uint64_t value, int bytes) {
+	for (int i = 0; i < bytes; i++) {
+		out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+	}
+}
+
+inline void PutString(std::string &out, const std::string &value) {
+	PutUInt(out, value.size(), 4);
+	out += value;
+}
+
+struct Reader {
+	const std::string &data;
+	size_t pos;
+
+	bool GetUInt(uint64_t &value, int bytes) {
+		if (data.size() - pos < static_cast<size_t>(bytes)) {
+			return false;
+		}
+		value = 0;
+		for (int i = 0; i < bytes; i++) {
+			value |= static_cast<uint64_t>(static_cast<unsigned char>(data[pos + i])) << (8 * i);
+		}
+		pos += bytes;
+		return true;
+	}
+
+	bool GetString(std::string &value) {
+		uint64_t size;
+		if (!GetUInt(size, 4) || data.size() - pos < size) {
+			return false;
+		}
+		value = data.substr(pos, size);
+		pos += size;
+		return true;
+	}
+};
+
+}  // namespace mssql_snapshot_detail
+
+inline std::string MSSQLEncodeCatalogSnapshot(const MSSQLCatalogSnapshot &snapshot) {
+	using namespace mssql_snapshot_detail;
+	std::string payload;
+	PutString(payload, snapshot.key);
+	PutUInt(payload, snapshot.tables.size(), 4);
+	for (const auto &table : snapshot.tables) {
+		PutString(payload, table.schema_name);
+		PutString(payload, table.name);
+		PutUInt(payload, static_cast<uint64_t>(table.object_id), 8);
+		PutString(payload, table.modify_date);
+		PutUInt(payload, table.columns.size(), 4);
+		for (const auto &column : table.columns) {
+			PutString(payload, column.name);
+			PutUInt(payload, static_cast<uint32_t>(column.column_id), 4);
+			PutString(payload, column.type_name);
+			PutUInt(payload, static_cast<uint16_t>(column.max_length), 2);
+			PutUInt(payload, column.precision, 1);
+			PutUInt(payload, column.scale, 1);
+			PutUInt(payload, column.is_nullable ? 1 : 0, 1);
+			PutString(payload, column.collation_name);
+		}
+	}
+
+	std::string out(MAGIC, sizeof(MAGIC));
+	PutUInt(out, MSSQL_CATALOG_SNAPSHOT_VERSION, 4);
+	out += payload;
+	PutUInt(out, MSSQLCatalogSnapshotHash(payload), 8);
+	return out;
+}
+
+//! False when `data` is not a complete snapshot of this version; `out` is then unspecified
+inline bool MSSQLDecodeCatalogSnapshot(const std::string &data, MSSQLCatalogSnapshot &out) {
+	using namespace mssql_snapshot_detail;
+	const size_t header = sizeof(MAGIC) + 4;
+	if (data.size() < header + 8 || data.compare(0, sizeof(MAGIC), MAGIC, sizeof(MAGIC)) != 0) {
+		return false;
+	}
+	Reader reader {data, sizeof(MAGIC)};
+	uint64_t version;
+	if (!reader.GetUInt(version, 4) || version != MSSQL_CATALOG_SNAPSHOT_VERSION) {
+		return false;
+	}
+	const std::string payload = data.substr(header, data.size() - header - 8);
+	Reader trailer {data, data.size() - 8};
+	uint64_t checksum;
+	if (!trailer.GetUInt(checksum, 8) || checksum != MSSQLCatalogSnapshotHash(payload)) {
+		return false;
+	}
+
+	Reader in {payload, 0};
+	uint64_t table_count;
+	if (!in.GetString(out.key) || !in.GetUInt(table_count, 4)) {
+		return false;
+	}
+	out.tables.clear();
+	for (uint64_t t = 0; t < table_count; t++) {
+		MSSQLSnapshotTable table;
+		uint64_t object_id, column_count;
+		if (!in.GetString(table.schema_name) || !in.GetString(table.name) || !in.GetUInt(object_id, 8) ||
+			!in.GetString(table.modify_date) || !in.GetUInt(column_count, 4)) {
+			return false;
+		}
+		table.object_id = static_cast<int64_t>(object_id);
+		for (uint64_t c = 0; c < column_count; c++) {
+			MSSQLSnapshotColumn column;
+			uint64_t column_id, max_length, precision, scale, is_nullable;
+			if (!in.GetString(column.name) || !in.GetUInt(column_id, 4) || !in.GetString(column.type_name) ||
+				!in.GetUInt(max_length, 2) || !in.GetUInt(precision, 1) || !in.GetUInt(scale, 1) ||
+				!in.GetUInt(is_nullable, 1) || !in.GetString(column.collation_name)) {
+				return false;
+			}
+			column.column_id = static_cast<int32_t>(static_cast<uint32_t>(column_id));
+			column.max_length = static_cast<int16_t>(static_cast<uint16_t>(max_length));
+			column.precision = static_cast<uint8_t>(precision);
+			column.scale = static_cast<uint8_t>(scale);
+			column.is_nullable = is_nullable != 0;
+			table.columns.push_back(std::move(column));
+		}
+		out.tables.push_back(std::move(table));
+	}
+	return in.pos == payload.size();
+}
+
+//! False when the file is missing or does not decode
+inline bool MSSQLReadCatalogSnapshot(const std::string &path, MSSQLCatalogSnapshot &out) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return MSSQLDecodeCatalogSnapshot(data, out);
+}
+
+//! Writes `path`.tmp and renames it over `path`, so a reader never sees half a file
+inline bool MSSQLWriteCatalogSnapshot(const std::string &path, const MSSQLCatalogSnapshot &snapshot) {
+	const std::string tmp_path = path + ".tmp";
+	{
+		std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			return false;
+		}
+		const std::string data = MSSQLEncodeCatalogSnapshot(snapshot);
+		file.write(data.data(), static_cast<std::streamsize>(data.size()));
+		if (!file) {
+			file.close();
+			std::remove(tmp_path.c_str());
+			return false;
+		}
+	}
+	if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+		// Windows will not rename over an existing file
+		std::remove(path.c_str());
+		if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+			std::remove(tmp_path.c_str());
+			return false;
+		}
+	}
+	return true;
+}
+
+}  // namespace duckdb
@@ -66,6 +66,12 @@ struct MSSQLTableMetadata {
 	MSSQLIndexKind index_kind = MSSQLIndexKind::HEAP;
 	idx_t partition_count = 0;
 
+	// Version of the object's definition: sys.objects.object_id and
+	// CONVERT(varchar(23), modify_date, 121), read with the row count. A catalog
+	// snapshot reuses cached columns only while both still match.
+	int64_t object_id = 0;
+	string modify_date;
+
 	// Incremental cache state for columns.
 	// Issue #178 (D6): all fields — including these states — are guarded by the
 	// cache-wide MSSQLMetadataCache::mutex_; the former per-table load_mutex is gone.
@@ -98,6 +104,17 @@ struct MSSQLSchemaMetadata {
 	explicit MSSQLSchemaMetadata(const string &n) : name(n) {}
 };
 
+//===----------------------------------------------------------------------===//
+// CatalogDelta - What a delta refresh found changed (MSSQLMetadataCache::DeltaRefresh)
+//===----------------------------------------------------------------------===//
+
+struct MSSQLCatalogDelta {
+	// (schema, name) of tables and views created, altered, recreated or dropped
+	vector<std::pair<string, string>> tables;
+	// Schemas created or dropped
+	vector<string> schemas;
+};
+
 //===----------------------------------------------------------------------===//
 // CacheState - Metadata cache state machine (global cache state)
 //===----------------------------------------------------------------------===//
@@ -114,6 +131,9 @@ enum class MSSQLCacheState : uint8_t {
 // MSSQLMetadataCache - In-memory cache of schema/table/column metadata
 //===----------------------------------------------------------------------===//
 
+// One BulkLoadAll work unit (defined in mssql_metadata_cache.cpp)
+struct MSSQLBulkLoadUnit;
+
 class MSSQLMetadataCache {
 public:
 	explicit MSSQLMetadataCache(int64_t ttl_seconds = 0);
@@ -163,14 +183,18 @@ public:
 	// Bulk Catalog Preload (Spec 033: US5)
 	//===----------------------------------------------------------------------===//
 
-	// Load all metadata in a single SQL Server round trip
-	// @param connection TDS connection to use
+	// Load all metadata, one query per schema (or per object_id shard of a schema
+	// when there are fewer schemas than connections), spread over up to
+	// `max_connections` pooled connections. Only the first connection is waited
+	// for; the others are used if the pool can hand them out immediately.
+	// @param pool Connection pool of the attached database
 	// @param schema_name If non-empty, limit bulk load to this schema only
+	// @param max_connections Upper bound on connections used (mssql_catalog_preload_connections)
 	// @param schema_count Output: number of schemas loaded
 	// @param table_count Output: number of tables loaded
 	// @param column_count Output: number of columns loaded
-	void BulkLoadAll(tds::TdsConnection &connection, const string &schema_name, idx_t &schema_count, idx_t &table_count,
-					 idx_t &column_count);
+	void BulkLoadAll(tds::ConnectionPool &pool, const string &schema_name, idx_t max_connections, idx_t &schema_count,
+					 idx_t &table_count, idx_t &column_count);
 
 	//===----------------------------------------------------------------------===//
 	// Cache Management
@@ -265,6 +289,38 @@ public:
 	// Get column metadata load state for table
 	CacheLoadState GetColumnsState(const string &schema_name, const string &table_name) const;
 
+	//===----------------------------------------------------------------------===//
+	// Catalog Snapshot (ATTACH option catalog_snapshot)
+	//===----------------------------------------------------------------------===//
+
+	// Fill the cache from the snapshot file at `path` if it was written for `key`.
+	// One query lists every object with its object_id and modify_date; tables whose
+	// pair matches the file take their columns from it, changed ones are reloaded,
+	// and the rest load lazily as usual. Returns false (cache untouched) when the
+	// file is missing, unreadable or for another key.
+	bool LoadSnapshot(tds::TdsConnection &connection, const string &path, const string &key);
+
+	// Write every table whose columns are loaded to `path`. Returns false when
+	// there is nothing to write or the file cannot be written.
+	bool SaveSnapshot(const string &path, const string &key) const;
+
+	//===----------------------------------------------------------------------===//
+	// Delta Refresh (setting mssql_catalog_delta_refresh)
+	//===----------------------------------------------------------------------===//
+
+	// True when the schema list is loaded and the TTL runs out within
+	// `margin_seconds` (0 = has run out). Always false with TTL 0.
+	bool DeltaRefreshDue(int64_t margin_seconds = 0) const;
+
+	// Bring a due cache up to date without discarding it. One aggregate query
+	// fingerprints sys.objects and sys.schemas; if it matches the last listing,
+	// only the TTL clock restarts. Otherwise the catalog snapshot's listing query
+	// patches the cache in place: unchanged tables keep their columns, changed
+	// ones that were loaded are reloaded in one batch, dropped ones go away.
+	// `delta` receives what changed, for the catalog's own entry caches.
+	// Returns false without querying when no longer due (another thread did it).
+	bool DeltaRefresh(tds::TdsConnection &connection, MSSQLCatalogDelta &delta, int64_t margin_seconds = 0);
+
 private:
 	//===----------------------------------------------------------------------===//
 	// Internal Loading Methods
@@ -276,10 +332,27 @@ private:
 	// Load tables and views from sys.objects
 	void LoadTables(tds::TdsConnection &connection, const string &schema_name);
 
+	// Run one BulkLoadAll unit (a schema or a shard of one) into `out_tables`,
+	// in query order. Takes no lock: the caller merges the result.
+	void LoadBulkUnit(tds::TdsConnection &connection, const MSSQLBulkLoadUnit &unit, const string &database_collation,
+					  vector<MSSQLTableMetadata> &out_tables);
+
 	// Load columns from sys.columns
 	void LoadColumns(tds::TdsConnection &connection, const string &schema_name, const string &table_name,
 					 MSSQLTableMetadata &table_metadata);
 
+	// Rebuild schemas_ from one whole-catalog listing (object_id and modify_date
+	// per object). Tables whose version matches `previous` keep its columns,
+	// loaded ones whose version moved are reloaded, the rest stay lazy. `delta`
+	// (optional) receives what differs from `previous`. Caller holds mutex_.
+	void ReconcileLocked(tds::TdsConnection &connection, const unordered_map<string, MSSQLSchemaMetadata> &previous,
+						 MSSQLCatalogDelta *delta, idx_t &reused, idx_t &reloaded);
+
+	// Delta refresh watermark, as one string. Caller holds mutex_.
+	string QueryCatalogFingerprint(tds::TdsConnection &connection);
+
+	bool DeltaRefreshDueLocked(int64_t margin_seconds) const;
+
 	// Execute metadata query with configured timeout (metadata_timeout_ms_)
 	using MetadataRowCallback = std::function<void(const vector<string> &values)>;
 	void ExecuteMetadataQuery(tds::TdsConnection &connection, const string &sql, MetadataRowCallback callback);
@@ -303,6 +376,7 @@ private:
 	unordered_map<string, MSSQLSchemaMetadata> schemas_;  // Cached schemas
 	std::chrono::steady_clock::time_point last_refresh_;  // Last refresh timestamp (backward compat)
 	string database_collation_;							  // Database default collation
+	string catalog_fingerprint_;						  // Watermark of the last whole-catalog listing
 
 	// Atomics, NOT guarded by mutex_ (issue #178 D4): written by EnsureCacheLoaded
 	// on every catalog lookup while loaders concurrently read them mid-query
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "tds/tds_connection_pool.hpp"
+
+namespace duckdb {
+namespace mssql {
+
+//===----------------------------------------------------------------------===//
+// PartitionSchemeInfo - how a partitioned table's rows map to partitions
+//
+// Discovered lazily, once per table entry, for tables whose metadata reports
+// partition_count > 1. Describes the partition function of the table's heap or
+// clustered index (index_id 0 or 1) — the rowset a catalog scan reads.
+//===----------------------------------------------------------------------===//
+
+struct PartitionSchemeInfo {
+	// Only meaningful once the owning MSSQLTableEntry has published this struct
+	// via its partition_loaded_ atomic (same contract as PrimaryKeyInfo).
+	bool exists = false;
+
+	string function_name;	  // Partition function, for $PARTITION.<function>(<column>)
+	string column_name;		  // Partitioning column (partition_ordinal = 1)
+	LogicalType column_type;  // Mapped DuckDB type of the partitioning column
+	bool range_right = false;  // RANGE RIGHT: a boundary value belongs to the partition on its right
+	idx_t partition_count = 0;
+
+	// Boundary values in ascending order, cast to column_type. Left EMPTY when
+	// DuckDB's ordering of the column cannot be trusted to match SQL Server's —
+	// strings (collations), uniqueidentifier (byte-group order), floating point
+	// and boundaries finer than the mapped timestamp type. The scan still
+	// splits by partition then, it just cannot prune.
+	vector<Value> boundaries;
+
+	PartitionSchemeInfo() : column_type(LogicalType::SQLNULL) {}
+
+	// Can pushed-down filters prune partitions client-side?
+	bool CanPrune() const {
+		return exists && boundaries.size() + 1 == partition_count;
+	}
+
+	// Factory method - discovers the partition scheme from SQL Server
+	static PartitionSchemeInfo Discover(tds::TdsConnection &connection, const string &schema_name,
+										const string &table_name);
+};
+
+}  // namespace mssql
+}  // namespace duckdb
@@ -19,8 +19,16 @@ struct PKColumnInfo {
 	LogicalType duckdb_type;  // Mapped DuckDB type
 	string collation_name;	  // For string columns (may affect DML predicates)
 
+	// Declared SQL Server type, for objects that must compare equal to the
+	// column without a conversion (the TVP table type of UPDATE/DELETE batches)
+	string type_name;	 // Base system type name (e.g., "varchar")
+	int16_t max_length;	 // Bytes (-1 for MAX types)
+	uint8_t precision;
+	uint8_t scale;
+
 	// Default constructor
-	PKColumnInfo() : column_id(0), key_ordinal(0), duckdb_type(LogicalType::INTEGER) {}
+	PKColumnInfo()
+		: column_id(0), key_ordinal(0), duckdb_type(LogicalType::INTEGER), max_length(0), precision(0), scale(0) {}
 
 	// Construct from discovery query result
 	static PKColumnInfo FromMetadata(const string &name, int32_t column_id, int32_t key_ordinal,
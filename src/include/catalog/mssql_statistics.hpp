@@ -11,6 +11,25 @@
 
 namespace duckdb {
 
+//===----------------------------------------------------------------------===//
+// MSSQLColumnStatistics - What SQL Server's histogram says about one column
+//
+// Taken from the newest unfiltered statistics object led by the column. Only
+// the distinct count is kept: it is an estimate, so a stale one costs a worse
+// plan, never a wrong result. The histogram's bounds are not exported.
+//===----------------------------------------------------------------------===//
+
+struct MSSQLColumnStatistics {
+	//! A statistics object exists and was read
+	bool found = false;
+
+	//! Sum of DISTINCT_RANGE_ROWS + 1 over the non-NULL steps
+	idx_t distinct_count = 0;
+
+	//! When these statistics were last fetched
+	std::chrono::steady_clock::time_point fetched_at;
+};
+
 //===----------------------------------------------------------------------===//
 // MSSQLTableStatistics - Cached statistics for a single table
 //===----------------------------------------------------------------------===//
@@ -24,6 +43,9 @@ struct MSSQLTableStatistics {
 
 	//! Whether the statistics are valid
 	bool is_valid = false;
+
+	//! Column statistics fetched so far, by column name. Each has its own age.
+	std::unordered_map<string, MSSQLColumnStatistics> columns;
 };
 
 //===----------------------------------------------------------------------===//
@@ -65,6 +87,28 @@ public:
 	unique_ptr<BaseStatistics> GetTableStatistics(tds::TdsConnection &connection, const string &schema_name,
 												  const string &table_name);
 
+	//! Get statistics for one column for DuckDB's optimizer (uses cache like GetRowCount)
+	//! @param connection Connection to use for querying
+	//! @param schema_name SQL Server schema name
+	//! @param table_name SQL Server table name
+	//! @param column_name SQL Server column name
+	//! @param type Type the scan returns for the column
+	//! @param is_nullable Whether the column admits NULL
+	//! @param level mssql_statistics_level: 1 marks NOT NULL columns, 2 also exports the distinct count
+	//! @param use_dbcc Fall back to DBCC SHOW_STATISTICS when the histogram DMV fails
+	//! @return Statistics of `type`, or nullptr when there is nothing to export
+	unique_ptr<BaseStatistics> GetColumnStatistics(tds::TdsConnection &connection, const string &schema_name,
+												   const string &table_name, const string &column_name,
+												   const LogicalType &type, bool is_nullable, int64_t level,
+												   bool use_dbcc);
+
+	//! Column statistics without a connection: always at level 1 (NOT NULL is
+	//! the catalog's), at level 2 only from a valid cache entry. False when
+	//! GetColumnStatistics has to fetch; `out` may be nullptr on true.
+	bool TryGetCachedColumnStatistics(const string &schema_name, const string &table_name, const string &column_name,
+									  const LogicalType &type, bool is_nullable, int64_t level,
+									  unique_ptr<BaseStatistics> &out);
+
 	//! Invalidate statistics for a specific table
 	void InvalidateTable(const string &schema_name, const string &table_name);
 
@@ -97,6 +141,18 @@ private:
 	//! Fetch row count from SQL Server
 	idx_t FetchRowCount(tds::TdsConnection &connection, const string &schema_name, const string &table_name);
 
+	//! Fetch one column's histogram summary from SQL Server
+	static MSSQLColumnStatistics FetchColumnStatistics(tds::TdsConnection &connection, const string &schema_name,
+													   const string &table_name, const string &column_name,
+													   bool use_dbcc);
+
+	//! Check if cached column statistics are still valid
+	bool IsCacheValid(const MSSQLColumnStatistics &stats) const;
+
+	//! BaseStatistics of `type` from a histogram summary (empty below level 2)
+	static unique_ptr<BaseStatistics> BuildColumnStatistics(const MSSQLColumnStatistics &column,
+															const LogicalType &type, bool is_nullable);
+
 	//! Cache TTL in seconds
 	int64_t cache_ttl_seconds_;
 
@@ -5,6 +5,7 @@
 #include <vector>
 #include "catalog/mssql_column_info.hpp"
 #include "catalog/mssql_metadata_cache.hpp"
+#include "catalog/mssql_partition_info.hpp"
 #include "catalog/mssql_primary_key.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/shared_ptr.hpp"	   // duckdb::enable_shared_from_this (spec 052)
@@ -111,10 +112,20 @@ public:
 	// Get full PK metadata (lazy loads if needed)
 	const mssql::PrimaryKeyInfo &GetPrimaryKeyInfo(ClientContext &context);
 
+	//===----------------------------------------------------------------------===//
+	// Partition Scheme Support
+	//===----------------------------------------------------------------------===//
+
+	// Partition function, column and boundaries (lazy loads if needed). Only
+	// tables whose metadata reported partition_count > 1 pay for the lookup;
+	// every other entry returns an info with exists == false.
+	const mssql::PartitionSchemeInfo &GetPartitionInfo(ClientContext &context);
+
 private:
 	vector<MSSQLColumnInfo> mssql_columns_;	 // Column metadata with collation
 	MSSQLObjectType object_type_;			 // TABLE or VIEW
 	idx_t approx_row_count_;				 // Cardinality estimate
+	idx_t partition_count_;					 // From the metadata cache; > 1 = partitioned
 
 	// Lazy-loaded PK cache.
 	// Spec 052 EnsurePKLoaded race fix: pk_load_mutex_ serialises concurrent
@@ -134,6 +145,14 @@ private:
 
 	// Ensure PK info is loaded
 	void EnsurePKLoaded(ClientContext &context) const;
+
+	// Lazy-loaded partition scheme cache, published the same way as pk_info_.
+	mutable std::atomic<bool> partition_loaded_{false};
+	mutable std::mutex partition_load_mutex_;
+	mutable mssql::PartitionSchemeInfo partition_info_;
+
+	// Ensure partition scheme info is loaded
+	void EnsurePartitionInfoLoaded(ClientContext &context) const;
 };
 
 }  // namespace duckdb
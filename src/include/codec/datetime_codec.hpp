@@ -98,6 +98,11 @@ void EncodeToBcp(Vector &in, idx_t row, const mssql::BCPColumnMetadata &col, duc
 // Single-Value overload for the BCPRowEncoder::EncodeValue public path.
 void EncodeToBcp(const Value &value, const mssql::BCPColumnMetadata &col, duckdb::vector<uint8_t> &buf);
 std::string FormatSqlLiteral(const Value &v, const LogicalType &type, LiteralContext ctx);
+// Split a TIMESTAMP_* raw value (in `source_type`'s native unit) into DATETIME2
+// wire components at `target_scale`: sub-day ticks and days since 0001-01-01.
+// Narrowing rounds, carrying into the date like SQL Server's own CAST.
+void ComputeDatetime2Components(int64_t raw_ticks, LogicalTypeId source_type, uint8_t target_scale,
+								uint64_t &time_value, uint32_t &date_value);
 std::string FormatDdlTypeName(const LogicalType &type, const mssql::CTASConfig &cfg, DdlContext ctx);
 size_t EstimateLiteralSize(const LogicalType &type);
 
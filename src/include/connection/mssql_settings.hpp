@@ -31,6 +31,9 @@ struct MSSQLPoolConfig {
 	// keeps sending UTF-16, so this is an opt-OUT for environments that want the
 	// pre-#225 wire form back.
 	bool utf8_support = true;
+	// Hand the TLS record layer of each pooled connection to the Linux kernel
+	// after the handshake (kTLS). Opt-in; falls back to OpenSSL per connection.
+	bool tls_kernel_offload = false;
 };
 
 //===----------------------------------------------------------------------===//
@@ -64,6 +67,15 @@ MSSQLPoolConfig LoadPoolConfig(ClientContext &context);
 // Load catalog cache TTL setting (0 = manual refresh only)
 int64_t LoadCatalogCacheTTL(ClientContext &context);
 
+// Load mssql_preload_catalog connection count (default 4)
+int64_t LoadCatalogPreloadConnections(ClientContext &context);
+
+// Load catalog delta refresh setting (patch the cache on TTL expiry, default true)
+bool LoadCatalogDeltaRefresh(ClientContext &context);
+
+// Load catalog background refresh setting (refresh from a thread, default false)
+bool LoadCatalogBackgroundRefresh(ClientContext &context);
+
 // Load query timeout setting (0 = no timeout)
 int LoadQueryTimeout(ClientContext &context);
 
@@ -120,6 +132,37 @@ constexpr bool DEFAULT_CTAS_USE_BCP = true;
 // Load CTAS BCP setting
 bool LoadCTASUseBCP(ClientContext &context);
 
+//===----------------------------------------------------------------------===//
+// Parallel Table Scan Configuration
+//===----------------------------------------------------------------------===//
+
+// Load mssql_scan_parallel_ranges (0 = derive from the thread count)
+int64_t LoadScanParallelRanges(ClientContext &context);
+
+// Load mssql_scan_parallel_min_rows
+int64_t LoadScanParallelMinRows(ClientContext &context);
+
+// Load mssql_scan_partition_aligned
+bool LoadScanPartitionAligned(ClientContext &context);
+
+// Load mssql_scan_read_ahead (0 = no read-ahead thread)
+idx_t LoadScanReadAhead(ClientContext &context);
+
+// Load mssql_scan_describe_bind (bind mssql_scan from sp_describe_first_result_set)
+bool LoadScanDescribeBind(ClientContext &context);
+
+// Load mssql_aggregate_pushdown (GROUP BY aggregates computed on SQL Server)
+bool LoadAggregatePushdown(ClientContext &context);
+
+// Load mssql_join_pushdown (joins within one attached database run on SQL Server)
+bool LoadJoinPushdown(ClientContext &context);
+
+// Load mssql_scan_parameterize_filters (filter constants as sp_executesql parameters)
+bool LoadScanParameterizeFilters(ClientContext &context);
+
+// Load mssql_join_filter_max_in (largest runtime join IN set pushed into a scan)
+idx_t LoadJoinFilterMaxIn(ClientContext &context);
+
 // Load whether mssql_exec() DDL auto-invalidates the catalog cache (issue #151)
 bool LoadExecInvalidateCache(ClientContext &context);
 
@@ -108,6 +108,18 @@ struct CTASConfig {
 	// True if creating a brand-new table (table didn't exist or OR REPLACE dropped it)
 	bool is_new_table = false;
 
+	//===----------------------------------------------------------------------===//
+	// Server-side CTAS
+	//===----------------------------------------------------------------------===//
+
+	// From mssql_ctas_server_side setting - copy a source that reads only the
+	// target's own catalog on the server instead of through DuckDB
+	bool server_side = true;
+
+	// The source as one T-SQL SELECT, set by the planner when it qualifies. The
+	// table is then filled by INSERT ... SELECT and the source plan never runs.
+	string server_select;
+
 	// Load configuration from client context
 	static CTASConfig Load(ClientContext &context);
 
@@ -159,6 +159,10 @@ struct CTASExecutionState {
 	// Flush any remaining INSERT batches (or BCP batch if in BCP mode)
 	void FlushInserts(ClientContext &context);
 
+	// Server-side mode: fill the created table with INSERT ... SELECT of
+	// config.server_select, on a pool connection. Sets rows_inserted.
+	void ExecuteServerInsert(ClientContext &context);
+
 	//===----------------------------------------------------------------------===//
 	// BCP Mode Methods (Spec 027)
 	//===----------------------------------------------------------------------===//
@@ -170,6 +174,9 @@ struct CTASExecutionState {
 	// Build the INSERT BULK text from bcp_target / bcp_columns / config.bcp_tablock
 	string BuildInsertBulkSql() const;
 
+	// Index shape of the table CTAS creates, for the TABLOCK decision
+	MSSQLIndexKind TargetShape() const;
+
 	// Execute INSERT BULK command to start BCP session
 	void ExecuteBCPInsert(ClientContext &context);
 
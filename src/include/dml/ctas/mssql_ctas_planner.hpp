@@ -40,6 +40,10 @@ private:
 	//! Map columns from child plan types to CTAS column definitions
 	static vector<CTASColumnDef> MapColumns(const LogicalCreateTable &op, PhysicalOperator &child_plan,
 											const CTASConfig &config);
+
+	//! The source as one T-SQL SELECT when it reads only `catalog` and every
+	//! column and filter encodes exactly; empty otherwise
+	static string EncodeServerSelect(ClientContext &context, MSSQLCatalog &catalog, LogicalOperator &source);
 };
 
 }  // namespace mssql
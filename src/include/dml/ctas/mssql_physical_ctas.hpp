@@ -24,6 +24,10 @@ class MSSQLCatalog;
 //
 // Uses sink pattern to receive rows from child query and stream-insert
 // them into the newly created SQL Server table.
+//
+// When the planner set config.server_select (a source reading only this
+// catalog), the operator has no child and is a source only: it runs the DDL
+// and one INSERT ... SELECT on the server and returns the row count.
 //===----------------------------------------------------------------------===//
 
 class MSSQLPhysicalCreateTableAs : public PhysicalOperator {
@@ -68,11 +72,11 @@ public:
 	//===----------------------------------------------------------------------===//
 
 	string GetName() const override {
-		return "MSSQL_CREATE_TABLE_AS";
+		return IsServerSide() ? "MSSQL_CREATE_TABLE_AS_PUSHDOWN" : "MSSQL_CREATE_TABLE_AS";
 	}
 
 	bool IsSink() const override {
-		return true;
+		return !IsServerSide();
 	}
 
 	OrderPreservationType SourceOrder() const override {
@@ -106,6 +110,8 @@ public:
 	// Source Interface (for returning row count)
 	//===----------------------------------------------------------------------===//
 
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+
 	SourceResultType GetDataInternal(ExecutionContext &context, DataChunk &chunk,
 									 OperatorSourceInput &input) const override;
 
@@ -113,6 +119,15 @@ public:
 		return true;
 	}
 
+private:
+	bool IsServerSide() const {
+		return !config_.server_select.empty();
+	}
+
+	//! The whole statement on the server (config.server_select)
+	SourceResultType GetDataServerSide(ExecutionContext &context, DataChunk &chunk,
+									   OperatorSourceInput &input) const;
+
 private:
 	MSSQLCatalog &catalog_;
 	mssql::CTASTarget target_;
@@ -8,18 +8,25 @@
 
 #pragma once
 
+#include <memory>
 #include "dml/delete/mssql_delete_statement.hpp"
 #include "dml/delete/mssql_delete_target.hpp"
 #include "dml/mssql_dml_config.hpp"
 #include "dml/mssql_dml_result.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/main/client_context.hpp"
 
 namespace duckdb {
 
+class MSSQLCatalog;
+namespace tds {
+class TdsConnection;
+}
+
 //! MSSQLDeleteExecutor handles batch accumulation and execution of DELETE operations
 //! Coordinates between the physical operator and the TDS layer
 class MSSQLDeleteExecutor {
@@ -66,8 +73,20 @@ private:
 	//! Statement generator
 	unique_ptr<MSSQLDeleteStatement> statement_;
 
-	//! Accumulated PK values for current batch
-	vector<vector<Value>> pending_pk_values_;
+	//! Connection held from the first batch until Finalize, so every batch runs
+	//! on one session and reuses its prepared handles
+	std::shared_ptr<tds::TdsConnection> connection_;
+	MSSQLCatalog *connection_catalog_ = nullptr;
+
+	//! Table type of the TVP path (mssql_dml_use_tvp); null on the VALUES path
+	unique_ptr<MSSQLDMLTvpType> tvp_type_;
+
+	//! Has the table type been created (or found) on the server?
+	bool tvp_type_ready_ = false;
+
+	//! PK columns of the pending batch; at most effective_batch_size_ rows, or
+	//! every row in defer_execution_ mode
+	unique_ptr<ColumnDataCollection> pending_;
 
 	//! Total rows deleted
 	idx_t total_rows_deleted_ = 0;
@@ -85,6 +104,13 @@ private:
 	//! This is needed when in a transaction where the scan and delete share the pinned connection
 	bool defer_execution_ = false;
 
+	//! Add rows to the pending batch, flushing it each time it fills up
+	//! @return Failure of the first batch that failed, else success
+	MSSQLDMLResult BufferRows(DataChunk &rows);
+
+	//! Rows waiting in the pending batch
+	idx_t PendingRowCount() const;
+
 	//! Flush the current batch to the database
 	//! @return Result of the batch execution
 	MSSQLDMLResult FlushBatch();
@@ -93,6 +119,16 @@ private:
 	//! @param batch The batch to execute
 	//! @return Result of the execution
 	MSSQLDMLResult ExecuteBatch(const MSSQLDMLBatch &batch);
+
+	//! Connection for the next batch, acquired on first use
+	std::shared_ptr<tds::TdsConnection> AcquireConnection();
+
+	//! Give the held connection back (no-op when none is held)
+	void ReleaseConnection();
+
+	//! Create the TVP table type before the first row is batched; if that
+	//! fails, fall back to VALUES batches for the rest of the statement
+	void PrepareTvpType();
 };
 
 }  // namespace duckdb
@@ -10,7 +10,9 @@
 
 #include "dml/delete/mssql_delete_target.hpp"
 #include "dml/mssql_dml_batch.hpp"
+#include "dml/mssql_dml_tvp.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/vector.hpp"
 
@@ -22,7 +24,9 @@ class MSSQLDeleteStatement {
 public:
 	//! Constructor
 	//! @param target The target table metadata
-	explicit MSSQLDeleteStatement(const MSSQLDeleteTarget &target);
+	//! @param parameterize Send PK values as typed parameters (MSSQLDMLBatch::parameters)
+	//!        instead of inline literals, so equal-sized batches share one statement text
+	explicit MSSQLDeleteStatement(const MSSQLDeleteTarget &target, bool parameterize = false);
 
 	//! Build a DELETE statement for a batch of rows
 	//! Uses the VALUES join pattern for efficient batched deletion:
@@ -30,14 +34,15 @@ public:
 	//!   JOIN (VALUES (@p1), (@p2), ...) AS v([pk1])
 	//!   ON t.[pk1] = v.[pk1]
 	//!
-	//! @param pk_values Vector of PK value vectors (one inner vector per row)
+	//! @param rows The batch's PK values, one column per PK column
 	//! @return MSSQLDMLBatch containing the SQL and parameters
-	MSSQLDMLBatch Build(const vector<vector<Value>> &pk_values) const;
+	MSSQLDMLBatch Build(ColumnDataCollection &rows) const;
 
-	//! Build a DELETE statement for a single row
-	//! @param pk_value PK values for the row (one value for scalar PK, multiple for composite)
-	//! @return MSSQLDMLBatch containing the SQL and parameters
-	MSSQLDMLBatch BuildSingle(const vector<Value> &pk_value) const;
+	//! Build a DELETE statement joining a table-valued parameter (MSSQLDMLTvpType)
+	//! that carries the batch's PK values; the SQL text does not depend on the row count
+	//! @return Batch with one TVP parameter, or an invalid batch (empty SQL) if a
+	//!         value has no TVP encoding and the batch must go through Build
+	MSSQLDMLBatch BuildTvp(const MSSQLDMLTvpType &tvp_type, ColumnDataCollection &rows) const;
 
 	//! Get the number of parameters per row (equals PK column count)
 	idx_t GetParametersPerRow() const {
@@ -48,12 +53,25 @@ private:
 	//! Reference to the target table metadata
 	const MSSQLDeleteTarget &target_;
 
+	//! Whether values are bound as parameters
+	bool parameterize_;
+
+	//! Append the placeholder for a cell bound into batch.parameters, or its SQL literal, to `sql`
+	void EncodeValue(Vector &input, const UnifiedVectorFormat &fmt, idx_t row, const LogicalType &type,
+					 MSSQLDMLBatch &batch, string &sql) const;
+
+	//! Throw unless `rows` has one column per PK column
+	void CheckColumnCount(const ColumnDataCollection &rows) const;
+
 	//! Generate the base DELETE ... JOIN clause
 	string GenerateDeleteClause() const;
 
 	//! Generate the ON clause for PK matching
 	string GenerateOnClause() const;
 
+	//! Generate the VALUES alias column list: [pk1], [pk2], ...
+	string GenerateValuesColumnList() const;
+
 	//! Escape a SQL Server identifier with square brackets
 	static string EscapeIdentifier(const string &identifier);
 };
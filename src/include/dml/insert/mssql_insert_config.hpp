@@ -24,6 +24,9 @@ constexpr idx_t MSSQL_DEFAULT_INSERT_MAX_SQL_BYTES = 8388608;
 // Default: use OUTPUT INSERTED for RETURNING clause
 constexpr bool MSSQL_DEFAULT_INSERT_USE_RETURNING_OUTPUT = true;
 
+// Default: run INSERT ... SELECT on the server when the SELECT encodes as T-SQL
+constexpr bool MSSQL_DEFAULT_INSERT_PUSHDOWN = true;
+
 // Minimum allowed max_sql_bytes (1KB)
 constexpr idx_t MSSQL_MIN_INSERT_SQL_BYTES = 1024;
 
@@ -47,6 +50,9 @@ struct MSSQLInsertConfig {
 	// Use OUTPUT INSERTED for RETURNING clause
 	bool use_returning_output = MSSQL_DEFAULT_INSERT_USE_RETURNING_OUTPUT;
 
+	// Run INSERT ... SELECT as one server-side statement when possible
+	bool pushdown = MSSQL_DEFAULT_INSERT_PUSHDOWN;
+
 	//===----------------------------------------------------------------------===//
 	// Derived Values
 	//===----------------------------------------------------------------------===//
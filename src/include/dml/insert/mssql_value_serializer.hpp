@@ -43,6 +43,13 @@ public:
 	// @return T-SQL literal string
 	static string SerializeFromVector(Vector &vector, idx_t index, const LogicalType &target_type);
 
+	// Append the literal for row `row` of `vector`, read through its
+	// precomputed UnifiedVectorFormat, to `out`. NULL, BOOLEAN, the integer
+	// types and VARCHAR are rendered straight from the vector data; other types
+	// go through Serialize. Output is byte-identical to Serialize(GetValue(row)).
+	static void AppendFromFormat(Vector &vector, const UnifiedVectorFormat &fmt, idx_t row,
+								 const LogicalType &target_type, string &out);
+
 	// Estimate serialized size for batch sizing decisions
 	// @param value The value to estimate
 	// @param type The value's logical type
@@ -4,6 +4,7 @@
 #include <vector>
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "tds/tds_protocol.hpp"
 
 namespace duckdb {
 
@@ -42,15 +43,13 @@ struct MSSQLDMLBatch {
 	// Parameters
 	//===----------------------------------------------------------------------===//
 
-	// Flattened parameter values for binding
-	// Order depends on operation type:
+	// Typed parameters the SQL references as @p0, @p1, ... (mssql_dml_use_prepared);
+	// empty when every value is an inline literal. Order depends on operation type:
 	// - UPDATE: [pk1_r1, pk2_r1, v1_r1, v2_r1, pk1_r2, pk2_r2, v1_r2, v2_r2, ...]
 	// - DELETE: [pk1_r1, pk2_r1, pk1_r2, pk2_r2, ...]
-	vector<Value> parameters;
-
-	// Parameter types (for TDS binding)
-	// Matches 1:1 with parameters vector
-	vector<LogicalType> parameter_types;
+	// NULLs and values without a typed encoding stay inline literals, so a
+	// position may be skipped.
+	tds::ExecuteSqlParameters parameters;
 
 	//===----------------------------------------------------------------------===//
 	// Validation
@@ -58,7 +57,7 @@ struct MSSQLDMLBatch {
 
 	// Check if batch is valid and ready for execution
 	bool IsValid() const {
-		return row_count > 0 && !sql.empty() && parameters.size() == parameter_types.size();
+		return row_count > 0 && !sql.empty();
 	}
 
 	// Clear batch for reuse
@@ -66,8 +65,7 @@ struct MSSQLDMLBatch {
 		batch_number = 0;
 		row_count = 0;
 		sql.clear();
-		parameters.clear();
-		parameter_types.clear();
+		parameters = tds::ExecuteSqlParameters();
 	}
 };
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include "duckdb/common/types.hpp"
+#include "tds/tds_prepared_cache.hpp"
 
 namespace duckdb {
 
@@ -21,6 +22,15 @@ constexpr idx_t MSSQL_DEFAULT_DML_MAX_PARAMETERS = 2000;
 // Default: use prepared statements for DML operations
 constexpr bool MSSQL_DEFAULT_DML_USE_PREPARED = true;
 
+// Default: VALUES batches; the TVP path creates a table type on the server
+constexpr bool MSSQL_DEFAULT_DML_USE_TVP = false;
+
+// Default rows per table-valued parameter batch (no parameter limit applies)
+constexpr idx_t MSSQL_DEFAULT_DML_TVP_BATCH_SIZE = 10000;
+
+// Default: run fully encodable UPDATE/DELETE statements as one server-side statement
+constexpr bool MSSQL_DEFAULT_DML_PUSHDOWN = true;
+
 //===----------------------------------------------------------------------===//
 // MSSQLDMLConfig - Configuration for UPDATE/DELETE operations
 //
@@ -38,6 +48,19 @@ struct MSSQLDMLConfig {
 	// Use prepared statements for execution
 	bool use_prepared = MSSQL_DEFAULT_DML_USE_PREPARED;
 
+	// Prepared statement handles kept per connection (mssql_prepared_cache_size)
+	idx_t prepared_cache_size = static_cast<idx_t>(tds::DEFAULT_PREPARED_CACHE_SIZE);
+
+	// Send batches as one table-valued parameter (MSSQLDMLTvpType)
+	bool use_tvp = MSSQL_DEFAULT_DML_USE_TVP;
+
+	// Maximum rows per batch on the TVP path (replaces EffectiveBatchSize)
+	idx_t tvp_batch_size = MSSQL_DEFAULT_DML_TVP_BATCH_SIZE;
+
+	// Plan statements whose WHERE and SET encode completely as one server-side
+	// UPDATE/DELETE (MSSQLDMLPushdown) instead of rowid batches
+	bool pushdown = MSSQL_DEFAULT_DML_PUSHDOWN;
+
 	//===----------------------------------------------------------------------===//
 	// Effective Batch Size Calculation
 	//===----------------------------------------------------------------------===//
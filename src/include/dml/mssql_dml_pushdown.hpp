@@ -0,0 +1,86 @@
+#pragma once
+
+#include <string>
+#include "dml/delete/mssql_delete_target.hpp"
+#include "dml/insert/mssql_insert_target.hpp"
+#include "dml/update/mssql_update_target.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+class ClientContext;
+class LogicalDelete;
+class LogicalInsert;
+class LogicalUpdate;
+class MSSQLCatalog;
+
+//===----------------------------------------------------------------------===//
+// MSSQLDMLPushdown - UPDATE/DELETE as one server-side statement (mssql_dml_pushdown)
+//
+// DuckDB plans UPDATE/DELETE as a scan returning each matching row's rowid
+// (and its new values), which MSSQLPhysicalUpdate/Delete send back to the
+// server in batches. When the scan's filters and every SET expression encode
+// as T-SQL (FilterEncoder), the statement runs on the server as written and no
+// row leaves it:
+//
+// UPDATE [schema].[table] SET [col1] = <expr>, ... WHERE <filters>
+// DELETE FROM [schema].[table] WHERE <filters>
+//
+// Anything between the statement and the scan other than projections (a join,
+// a filter the scan did not accept), a pushed-down TOP, RETURNING, or an
+// expression without an encoding keeps the batched path.
+//
+// INSERT ... SELECT (mssql_insert_pushdown) takes the same route when the
+// SELECT encodes as a whole (EncodeRemoteSelect) and reads either the target's
+// attached database or another one on the same server under the same login,
+// named with a three-part name:
+//
+// INSERT INTO [schema].[table] ([col1], ...) SELECT ... FROM [database].[schema].[source]
+//===----------------------------------------------------------------------===//
+
+struct MSSQLDMLPushdown {
+	// Server-side statement for `op`, or empty when it must run batched
+	static string TryBuildUpdate(const LogicalUpdate &op, const MSSQLUpdateTarget &target);
+	static string TryBuildDelete(const LogicalDelete &op, const MSSQLDeleteTarget &target);
+	static string TryBuildInsert(ClientContext &context, MSSQLCatalog &catalog, const LogicalInsert &op,
+								 const MSSQLInsertTarget &target);
+};
+
+//! MSSQLPhysicalDMLPushdown runs a pushed-down UPDATE/DELETE/INSERT and returns its row count
+class MSSQLPhysicalDMLPushdown : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::EXTENSION;
+
+	//! Constructor
+	//! @param plan The physical plan
+	//! @param types Return types (just row count)
+	//! @param estimated_cardinality Estimated number of affected rows
+	//! @param catalog_name DuckDB catalog name (MSSQL attachment name)
+	//! @param operation "UPDATE", "DELETE" or "INSERT"
+	//! @param sql The statement from MSSQLDMLPushdown
+	MSSQLPhysicalDMLPushdown(PhysicalPlan &plan, vector<LogicalType> types, idx_t estimated_cardinality,
+							 string catalog_name, string operation, string sql);
+
+	//! Get the name of this operator
+	string GetName() const override {
+		return "MSSQL_" + operation_ + "_PUSHDOWN";
+	}
+
+	//! Source only: the statement runs once, on the first GetData
+	bool IsSource() const override {
+		return true;
+	}
+
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+
+	//! Source interface - run the statement and return the row count
+	SourceResultType GetDataInternal(ExecutionContext &context, DataChunk &chunk,
+									 OperatorSourceInput &input) const override;
+
+private:
+	string catalog_name_;
+	string operation_;
+	string sql_;
+};
+
+}  // namespace duckdb
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "duckdb/common/types.hpp"
+
+namespace duckdb {
+
+namespace mssql {
+struct PKColumnInfo;
+}
+
+//===----------------------------------------------------------------------===//
+// MSSQLDMLTvpType - Table type carrying UPDATE/DELETE batches (mssql_dml_use_tvp)
+//
+// With a TVP the batch's keys and SET values travel as the rows of one
+// table-valued parameter instead of a VALUES list in the SQL text:
+//
+// UPDATE t
+// SET t.[col1] = v.[col1]
+// FROM [schema].[table] AS t
+// JOIN (SELECT * FROM @rows) AS v([pk1], [col1])
+// ON t.[pk1] = v.[pk1]
+//
+// The text is the same for every batch size and the 2100-parameter limit no
+// longer bounds the batch. The parameter's table type must exist on the server:
+// it is created on first use in the target's schema, named after its column
+// declarations (tds::encoding::TvpEncoder::TypeName), so tables with the same
+// key and value types share it. Columns are [c0], [c1], ... in VALUES order.
+//
+// Key columns are declared exactly as the target's key columns, collation and
+// length included (KeyColumnDeclaration). The join then compares like with
+// like: an nvarchar(max) key against a varchar key converts the table's side,
+// which turns the clustered index seek into a scan, and a different collation
+// can make the comparison fail outright. The rows still travel in the
+// encoder's wire types; the server converts them into the declared columns.
+//===----------------------------------------------------------------------===//
+
+struct MSSQLDMLTvpType {
+	// Parameter name used in the generated SQL
+	static constexpr const char *PARAMETER_NAME = "@rows";
+
+	string schema_name;
+	string type_name;
+	vector<LogicalType> column_types;
+	vector<string> column_declarations;
+
+	// Describe the table type for `column_types` in `schema_name`.
+	// `declarations` overrides the encoder's column declaration where non-empty
+	// (same length as `column_types`, or empty for no overrides).
+	// @return false if a column type has no TVP encoding (the VALUES path is used)
+	static bool TryCreate(const string &schema_name, vector<LogicalType> column_types, vector<string> declarations,
+						  MSSQLDMLTvpType &result);
+
+	// The key column's own declaration ("varchar(20) COLLATE Latin1_General_CI_AS",
+	// "decimal(18,2)", "datetime", ...), or empty for a type not spelled out here
+	static string KeyColumnDeclaration(const mssql::PKColumnInfo &column);
+
+	// [schema].[type]
+	string GetQualifiedName() const;
+
+	// Create the type unless it exists; tolerates a concurrent creator
+	string GenerateCreateSql() const;
+
+	// sp_executesql declaration: @rows [schema].[type] READONLY
+	string GenerateDeclaration() const;
+
+	// Derived table over the parameter: (SELECT * FROM @rows) AS v(<column_list>)
+	static string GenerateSource(const string &column_list);
+};
+
+}  // namespace duckdb
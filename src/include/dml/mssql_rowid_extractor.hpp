@@ -2,6 +2,8 @@
 
 #include <vector>
 #include "catalog/mssql_primary_key.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/types/vector.hpp"
 
@@ -14,33 +16,40 @@ namespace duckdb {
 // For tables with PK:
 //   - Scalar PK (single column): rowid is the PK value directly
 //   - Composite PK (multiple columns): rowid is STRUCT with PK fields
+//
+// UPDATE/DELETE keep their pending rows columnar: the PK columns (and, for
+// UPDATE, the SET values) are referenced as vectors of a DataChunk and
+// appended to a ColumnDataCollection, and the statement builders read the
+// cells through UnifiedVectorFormat instead of one Value per cell.
 //===----------------------------------------------------------------------===//
 
 //===----------------------------------------------------------------------===//
-// ExtractPKFromRowid - Extract PK values from rowid column
+// ReferencePKColumns - Reference the PK columns of a rowid column
 //
-// Extracts primary key component values from a rowid vector.
-// Returns a vector of Value objects for each row, where each inner vector
-// contains the PK column values in order.
+// Appends one vector per PK column (in PK order) to `rows.data`, each
+// referencing the rowid data for `count` rows; the caller sets the chunk's
+// cardinality. Scalar PK: the rowid vector itself. Composite PK: the STRUCT's
+// child vectors, sliced through the rowid's selection when the rowid is not
+// flat (a dictionary or constant STRUCT does not index its children by row).
 //
 // @param rowid_vector The rowid column from DuckDB DataChunk
-// @param count Number of rows to extract
+// @param count Number of rows in the rowid column
 // @param pk_info Primary key metadata (for composite PK field order)
-// @return Vector of vectors: outer[row_idx] = inner[pk_col_idx] = value
+// @param rows Chunk whose column list is extended with the PK columns
 //===----------------------------------------------------------------------===//
 
-vector<vector<Value>> ExtractPKFromRowid(Vector &rowid_vector, idx_t count, const mssql::PrimaryKeyInfo &pk_info);
+void ReferencePKColumns(Vector &rowid_vector, idx_t count, const mssql::PrimaryKeyInfo &pk_info, DataChunk &rows);
 
 //===----------------------------------------------------------------------===//
-// ExtractSingleRowPK - Extract PK values for a single row
+// AppendRowRange - Append a range of rows to a pending batch
 //
-// @param rowid_vector The rowid column
-// @param row_idx Index of the row to extract
-// @param pk_info Primary key metadata
-// @return Vector of PK column values for this row
+// @param target Collection with the same column types as `rows`
+// @param rows Source chunk
+// @param offset First row of `rows` to append
+// @param count Number of rows to append
 //===----------------------------------------------------------------------===//
 
-vector<Value> ExtractSingleRowPK(Vector &rowid_vector, idx_t row_idx, const mssql::PrimaryKeyInfo &pk_info);
+void AppendRowRange(ColumnDataCollection &target, DataChunk &rows, idx_t offset, idx_t count);
 
 //===----------------------------------------------------------------------===//
 // GetPKValueAsString - Convert PK value to T-SQL literal string
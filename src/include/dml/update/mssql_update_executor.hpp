@@ -5,16 +5,21 @@
 #include <vector>
 #include "dml/mssql_dml_config.hpp"
 #include "dml/mssql_dml_result.hpp"
+#include "dml/mssql_dml_tvp.hpp"
 #include "dml/update/mssql_update_target.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/client_context.hpp"
 
 namespace duckdb {
 
 // Forward declarations
+class MSSQLCatalog;
+struct MSSQLDMLBatch;
 namespace tds {
 class ConnectionPool;
+class TdsConnection;
 }
 
 //===----------------------------------------------------------------------===//
@@ -74,14 +79,23 @@ private:
 	// Connection pool (lazy initialized)
 	tds::ConnectionPool *connection_pool_ = nullptr;
 
+	// Connection held from the first batch until Finalize, so every batch runs
+	// on one session and reuses its prepared handles
+	std::shared_ptr<tds::TdsConnection> connection_;
+	MSSQLCatalog *connection_catalog_ = nullptr;
+
+	// Table type of the TVP path (mssql_dml_use_tvp); null on the VALUES path
+	unique_ptr<MSSQLDMLTvpType> tvp_type_;
+
+	// Has the table type been created (or found) on the server?
+	bool tvp_type_ready_ = false;
+
 	// Effective batch size (computed from config and params per row)
 	idx_t effective_batch_size_;
 
-	// Accumulated PK values for pending batch [row][pk_col]
-	vector<vector<Value>> pending_pk_values_;
-
-	// Accumulated update values for pending batch [row][update_col]
-	vector<vector<Value>> pending_update_values_;
+	// Rows of the pending batch: PK columns, then update columns. Holds at most
+	// effective_batch_size_ rows, or every row in defer_execution_ mode.
+	unique_ptr<ColumnDataCollection> pending_;
 
 	// Statistics
 	idx_t total_rows_updated_ = 0;
@@ -101,14 +115,25 @@ private:
 	// Get or initialize connection pool
 	tds::ConnectionPool &GetConnectionPool();
 
+	// Add rows to the pending batch, flushing it each time it fills up
+	MSSQLDMLResult BufferRows(DataChunk &rows);
+
+	// Rows waiting in the pending batch
+	idx_t PendingRowCount() const;
+
 	// Flush pending batch to SQL Server
 	MSSQLDMLResult FlushBatch();
 
 	// Execute SQL batch and return rows affected
-	idx_t ExecuteBatch(const string &sql);
+	idx_t ExecuteBatch(const MSSQLDMLBatch &batch);
+
+	// Connection for the next batch (acquired on first use) / give it back
+	std::shared_ptr<tds::TdsConnection> AcquireConnection();
+	void ReleaseConnection();
 
-	// Extract row data from chunk and add to pending
-	void AccumulateRow(DataChunk &chunk, idx_t row_idx);
+	// Create the TVP table type before the first row is batched; if that
+	// fails, fall back to VALUES batches for the rest of the statement
+	void PrepareTvpType();
 };
 
 }  // namespace duckdb
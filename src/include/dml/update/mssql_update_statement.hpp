@@ -3,8 +3,10 @@
 #include <string>
 #include <vector>
 #include "dml/mssql_dml_batch.hpp"
+#include "dml/mssql_dml_tvp.hpp"
 #include "dml/update/mssql_update_target.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/value.hpp"
 
 namespace duckdb {
@@ -12,7 +14,7 @@ namespace duckdb {
 //===----------------------------------------------------------------------===//
 // MSSQLUpdateStatement - SQL generator for UPDATE operations
 //
-// Generates parameterized UPDATE statements using VALUES join pattern:
+// Generates UPDATE statements using VALUES join pattern:
 //
 // UPDATE t
 // SET t.[col1] = v.[col1], t.[col2] = v.[col2]
@@ -22,6 +24,10 @@ namespace duckdb {
 //   (@p4, @p5, @p6)
 // ) AS v([pk1], [col1], [col2])
 // ON t.[pk1] = v.[pk1]
+//
+// With `parameterize` the values travel as typed parameters in
+// MSSQLDMLBatch::parameters, so every full batch of a statement has the same
+// text and reuses one prepared handle; otherwise they are inline literals.
 //===----------------------------------------------------------------------===//
 
 class MSSQLUpdateStatement {
@@ -30,22 +36,35 @@ public:
 	// Construction
 	//===----------------------------------------------------------------------===//
 
-	explicit MSSQLUpdateStatement(const MSSQLUpdateTarget &target);
+	explicit MSSQLUpdateStatement(const MSSQLUpdateTarget &target, bool parameterize = false);
 
 	//===----------------------------------------------------------------------===//
 	// SQL Generation
 	//===----------------------------------------------------------------------===//
 
 	// Build UPDATE SQL with parameters for a batch of rows
-	// @param pk_values Vector of PK values per row [row][pk_col]
-	// @param update_values Vector of update values per row [row][update_col]
+	// @param rows The batch's rows: PK columns, then update columns (VALUES order)
 	// @param batch_number Sequential batch number for error reporting
 	// @return Complete batch ready for execution
-	MSSQLDMLBatch Build(const vector<vector<Value>> &pk_values, const vector<vector<Value>> &update_values,
-						idx_t batch_number);
+	MSSQLDMLBatch Build(ColumnDataCollection &rows, idx_t batch_number);
+
+	// Build UPDATE SQL joining a table-valued parameter (MSSQLDMLTvpType) that
+	// carries the batch's rows; the SQL text does not depend on the row count.
+	// @return Batch with one TVP parameter, or an invalid batch (empty SQL) if
+	//         a value has no TVP encoding and the batch must go through Build
+	MSSQLDMLBatch BuildTvp(const MSSQLDMLTvpType &tvp_type, ColumnDataCollection &rows, idx_t batch_number) const;
 
 private:
 	const MSSQLUpdateTarget &target_;
+	bool parameterize_;
+
+	// Append the placeholder for a cell bound into batch.parameters, or its SQL
+	// literal, to `sql`
+	void EncodeValue(Vector &input, const UnifiedVectorFormat &fmt, idx_t row, const LogicalType &type,
+					 MSSQLDMLBatch &batch, string &sql) const;
+
+	// Type of VALUES column `col`: the PK columns, then the update columns
+	const LogicalType &GetColumnType(idx_t col) const;
 
 	// Generate SET clause: SET t.[col1] = v.[col1], t.[col2] = v.[col2]
 	string GenerateSetClause() const;
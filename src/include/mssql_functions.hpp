@@ -9,10 +9,12 @@
 #pragma once
 
 #include "catalog/mssql_column_info.hpp"
+#include "catalog/mssql_partition_info.hpp"
 #include "duckdb.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "query/mssql_result_stream.hpp"
+#include "table_scan/partition_scan_policy.hpp"
 #include "table_scan/table_scan_state.hpp"
 
 #include <atomic>
@@ -37,6 +39,20 @@ struct MSSQLScanBindData : public FunctionData {
 	// no pre-built stream (InitGlobal then re-executes the query).
 	string result_stream_id;
 
+	// Partitioned scan (partition_column / partitions / partition_bounds named
+	// parameters): one bounded subquery per range, drained in parallel. Empty
+	// for a single-stream scan. The registered stream above is range 0's.
+	vector<string> range_queries;
+
+	// Schema came from sp_describe_first_result_set (mssql_scan_describe_bind):
+	// nothing was executed at bind, and InitGlobal checks the executed result
+	// against return_types.
+	bool described = false;
+
+	// Query built by the optimizer from an aggregate or join over attached
+	// tables (DescribeMSSQLScanQuery); a later rewrite may nest it further.
+	bool pushed_down = false;
+
 	unique_ptr<FunctionData> Copy() const override;
 	bool Equals(const FunctionData &other) const override;
 };
@@ -109,6 +125,20 @@ struct MSSQLCatalogScanBindData : public FunctionData {
 	// The rowid type (scalar or STRUCT)
 	LogicalType rowid_type;
 
+	//===----------------------------------------------------------------------===//
+	// Partition-Aligned Scan
+	//===----------------------------------------------------------------------===//
+
+	// Partition scheme of the table (exists == false when unpartitioned)
+	mssql::PartitionSchemeInfo partition_info;
+
+	// Index of the partitioning column in all_column_names
+	idx_t partition_column_index = DConstants::INVALID_INDEX;
+
+	// Interval the pushed-down filters restrict the partitioning column to, set by
+	// ComplexFilterPushdown; InitGlobal prunes partitions outside it.
+	mutable MSSQLPartitionKeyInterval<Value> partition_filter;
+
 	unique_ptr<FunctionData> Copy() const override;
 	bool Equals(const FunctionData &other) const override;
 };
@@ -176,16 +206,41 @@ struct MSSQLScanGlobalState : public GlobalTableFunctionState {
 	// SQL result indices of PK columns (for reading PK data from result)
 	vector<idx_t> pk_sql_indices;
 
+	//===----------------------------------------------------------------------===//
+	// Parallel key-range scan (table_scan/scan_range_policy.hpp)
+	//===----------------------------------------------------------------------===//
+
+	// One query per key range. Empty for a single-stream scan, which is then
+	// served from result_stream above; when set, result_stream stays null and
+	// each thread opens its own stream per claimed range (TableScanLocalState).
+	vector<string> range_queries;
+
+	// Pushed-down filter constants bound as sp_executesql parameters
+	// (mssql_scan_parameterize_filters), shared by every range query.
+	tds::ExecuteSqlParameters filter_parameters;
+
+	// Next range to hand out. Threads claim ranges until this passes the end.
+	std::atomic<idx_t> next_range {0};
+
+	// Ceiling on ranges drained at once (0 = one thread per range). A partitioned
+	// mssql_scan may ask for more ranges than the pool can serve concurrently;
+	// the surplus threads would only block in Acquire().
+	idx_t max_streams = 0;
+
+	// Resolved on the client thread at InitGlobal: a worker opening a range
+	// stream must not touch the ClientContext for any of these (issue #178).
+	weak_ptr<tds::ConnectionPool> pool_handle;
+	int acquire_timeout_ms = 30000;
+	int query_timeout_seconds = 0;
+	bool reset_on_release = tds::DEFAULT_RESET_CONNECTION;
+	idx_t read_ahead_packets = 0;
+
 	MSSQLScanGlobalState() = default;
 	~MSSQLScanGlobalState();
 
 	idx_t MaxThreads() const override;
 };
 
-struct MSSQLScanLocalState : public LocalTableFunctionState {
-	// No per-thread state needed - single-threaded streaming
-};
-
 // Bind: validates arguments, determines return schema
 unique_ptr<FunctionData> MSSQLScanBind(ClientContext &context, TableFunctionBindInput &input,
 									   vector<LogicalType> &return_types, vector<Identifier> &names);
@@ -193,13 +248,22 @@ unique_ptr<FunctionData> MSSQLScanBind(ClientContext &context, TableFunctionBind
 // Global init: sets up execution state
 unique_ptr<GlobalTableFunctionState> MSSQLScanInitGlobal(ClientContext &context, TableFunctionInitInput &input);
 
-// Local init: per-thread state
+// Local init: per-thread state (the range a thread drains in a partitioned scan)
 unique_ptr<LocalTableFunctionState> MSSQLScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
 													   GlobalTableFunctionState *global_state);
 
 // Execute: produces output rows
 void MSSQLScanFunction(ClientContext &context, TableFunctionInput &data, DataChunk &output);
 
+// The mssql_scan table function, as registered
+TableFunction GetMSSQLScanFunction();
+
+// Bind data for a query the extension generates itself (aggregate and join pushdown):
+// the shape comes from sp_describe_first_result_set and nothing runs before
+// execution. nullptr if the server cannot describe the query.
+unique_ptr<MSSQLScanBindData> DescribeMSSQLScanQuery(ClientContext &context, const string &context_name,
+													 const string &query);
+
 //===----------------------------------------------------------------------===//
 // Catalog-based Table Scan Functions
 //===----------------------------------------------------------------------===//
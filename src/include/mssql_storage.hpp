@@ -133,12 +133,20 @@ struct MSSQLConnectionInfo {
 	// wire form or two connections would decode the same column differently.
 	bool utf8_support = true;
 
+	// mssql_tls_kernel_offload, carried for the pool factory like utf8_support.
+	bool tls_kernel_offload = false;
+
 	//===----------------------------------------------------------------------===//
 	// Catalog Visibility Filters (Spec 033: regex-based object filtering)
 	//===----------------------------------------------------------------------===//
 	string schema_filter;  // Regex pattern for schema visibility (empty = all visible)
 	string table_filter;   // Regex pattern for table/view visibility (empty = all visible)
 
+	//===----------------------------------------------------------------------===//
+	// Catalog Snapshot (ATTACH option catalog_snapshot)
+	//===----------------------------------------------------------------------===//
+	string catalog_snapshot;  // Directory holding metadata cache snapshots (empty = disabled)
+
 	//===----------------------------------------------------------------------===//
 	// ORDER BY Pushdown (Spec 039)
 	//===----------------------------------------------------------------------===//
@@ -20,9 +20,11 @@ public:
 	~MSSQLQueryExecutor() = default;
 
 	// Execute a SQL query and return a streaming result
-	// Acquires connection from pool, sends SQL_BATCH, returns result stream
+	// Acquires connection from pool, sends SQL_BATCH (or the sp_executesql RPC
+	// when `parameters` is non-empty), returns result stream
 	// Throws on connection failure or initial protocol errors
-	unique_ptr<MSSQLResultStream> Execute(ClientContext &context, const std::string &sql);
+	unique_ptr<MSSQLResultStream> Execute(ClientContext &context, const std::string &sql,
+										  const tds::ExecuteSqlParameters &parameters = {});
 
 	// Validate that the context exists
 	void ValidateContext(ClientContext &context);
@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// query/mssql_read_ahead.hpp
+//
+// Background socket reader for one MSSQLResultStream (mssql_scan_read_ahead).
+//
+// Without it a stream's thread alternates between waiting in recv() and
+// decoding what it received, so the network wait and the decode are serialized
+// (fill_read vs fill_process in the MSSQL_COUNTERS summary). With it, a reader
+// thread keeps up to `depth` TDS packet payloads buffered while the stream's
+// thread decodes the previous one — double buffering at depth 2, triple at 3.
+//
+// OWNERSHIP OF THE SOCKET: while the reader runs it is the ONLY thread that
+// touches the socket. TLS sessions are not safe for a concurrent SSL_read and
+// SSL_write, so anything that sends (ATTENTION) or closes must Stop() first.
+// Stop() keeps what was already buffered; the stream consumes that before it
+// reads from the socket directly again, so wire order is preserved.
+//
+// The reader ends by itself after the packet carrying the EOM status bit — the
+// last packet of the server's response. It never reads into a following
+// response, so the connection is clean for the pool once the stream completes.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace duckdb {
+
+namespace tds {
+class TdsSocket;
+}  // namespace tds
+
+//! `mssql_scan_read_ahead` default: off. Each buffered packet costs one packet
+//! size of memory and the stream one thread.
+constexpr int64_t MSSQL_DEFAULT_SCAN_READ_AHEAD = 0;
+
+//! Upper bound on buffered packets per stream; deeper rings only add memory once
+//! the decoder is the bottleneck. The setting rejects larger values.
+constexpr uint64_t MSSQL_MAX_SCAN_READ_AHEAD = 64;
+
+class MSSQLReadAhead {
+public:
+	enum class ReadStatus : uint8_t {
+		Data,	  // `payload` holds the next packet's payload
+		Timeout,  // Nothing arrived within the timeout; the reader keeps going
+		Drained,  // Reader stopped or saw EOM, and everything buffered was consumed
+		Failed	  // The socket failed; GetError() says how. Buffered data came first.
+	};
+
+	//! Starts the reader thread on `socket`, which must stay alive and untouched
+	//! by any other thread until Stop() returns.
+	MSSQLReadAhead(tds::TdsSocket &socket, uint64_t depth);
+	~MSSQLReadAhead();
+
+	MSSQLReadAhead(const MSSQLReadAhead &) = delete;
+	MSSQLReadAhead &operator=(const MSSQLReadAhead &) = delete;
+
+	//! Next payload in wire order. The view stays valid until the next call to
+	//! Next() or Stop().
+	ReadStatus Next(const uint8_t *&payload, size_t &payload_length, int timeout_ms);
+
+	//! Stop the reader and join it. Buffered payloads remain available to Next().
+	void Stop();
+
+	const std::string &GetError() const {
+		return error_;
+	}
+
+private:
+	void ReaderLoop();
+
+	tds::TdsSocket &socket_;
+
+	// Ring of payload slots. Slots [head_, head_ + filled_) hold payloads in wire
+	// order; the one at head_ is lent to the consumer while `held_`.
+	std::vector<std::vector<uint8_t>> slots_;
+	std::vector<size_t> lengths_;
+	size_t head_ = 0;
+	size_t filled_ = 0;
+	bool held_ = false;
+
+	std::mutex mutex_;
+	std::condition_variable data_ready_;
+	std::condition_variable space_ready_;
+	bool stop_ = false;
+	bool finished_ = false;	 // Reader exited: EOM, Stop() or failure
+	std::string error_;		 // Set before finished_ on failure; read only after
+
+	std::thread reader_;
+};
+
+}  // namespace duckdb
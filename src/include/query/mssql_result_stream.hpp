@@ -6,6 +6,7 @@
 #include "codec/type_family.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "query/mssql_read_ahead.hpp"
 #include "tds/encoding/type_converter.hpp"
 #include "tds/tds_connection.hpp"
 #include "tds/tds_token_parser.hpp"
@@ -134,6 +135,20 @@ public:
 		target_vectors_ = std::move(targets);
 	}
 
+	// Buffer up to `packets` TDS packets ahead of the decoder on a background
+	// reader thread (mssql_scan_read_ahead; 0 = read inline). Must be called
+	// before Initialize(), which starts the reader once the batch is sent.
+	void SetReadAhead(idx_t packets) {
+		read_ahead_packets_ = packets;
+	}
+
+	// Send the query through sp_executesql with these typed parameters instead
+	// of as a SQL batch (mssql_scan_parameterize_filters). Must be called before
+	// Initialize(); empty parameters keep the batch.
+	void SetParameters(tds::ExecuteSqlParameters parameters) {
+		parameters_ = std::move(parameters);
+	}
+
 	// Surface warnings to DuckDB context
 	void SurfaceWarnings(ClientContext &context);
 
@@ -142,6 +157,10 @@ private:
 	// timeout_ms: socket receive timeout in milliseconds
 	bool ReadMoreData(int timeout_ms);
 
+	// Stop the read-ahead thread (if any) so this thread may use the socket
+	// directly; packets it already buffered are still consumed first.
+	void StopReadAhead();
+
 	// Process parsed row into DataChunk
 	void ProcessRow(DataChunk &chunk, idx_t row_idx);
 
@@ -178,13 +197,18 @@ private:
 
 	// Query
 	string sql_;
+	tds::ExecuteSqlParameters parameters_;
 
 	// State
 	MSSQLResultStreamState state_;
 	std::atomic<bool> is_cancelled_;
 
-	// Parser
-	tds::TokenParser parser_;
+	// Parser. Lives for the whole result, so its buffer is the mirrored ring.
+	tds::TokenParser parser_ {tds::RingBuffer::Layout::Mirrored};
+
+	// Background socket reader (null when read-ahead is off or has drained)
+	idx_t read_ahead_packets_ = 0;
+	unique_ptr<MSSQLReadAhead> read_ahead_;
 
 	// Column info (set after COLMETADATA)
 	vector<LogicalType> column_types_;
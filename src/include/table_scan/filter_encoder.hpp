@@ -16,14 +16,18 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/expression_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/table_filter_set.hpp"
 
 namespace duckdb {
 namespace mssql {
 
+class FilterParameters;
+
 //------------------------------------------------------------------------------
 // Result Structures
 //------------------------------------------------------------------------------
@@ -79,6 +83,23 @@ struct ExpressionEncodeContext {
 	// BoundReference(0), so the name travels here instead of in the expression.
 	const std::string *filter_column = nullptr;
 
+	// Outside a filter, once DuckDB has resolved column bindings (a planned
+	// server-side UPDATE's SET expressions): BoundReference(i) is projected
+	// column i, mapped through column_ids like a column binding.
+	bool bound_refs_are_columns = false;
+
+	// When set, column references are qualified as [alias].[column] (one side
+	// of a join pushed down as a single query)
+	const std::string *table_alias = nullptr;
+
+	// Optional IN filters (DuckDB's runtime join filters) with more values than
+	// this are left out of the WHERE clause (mssql_join_filter_max_in)
+	idx_t join_filter_max_in = DConstants::INVALID_INDEX;
+
+	// When set, comparison and IN constants become typed sp_executesql
+	// parameters (@p0, @p1, ...) collected here instead of inline literals.
+	FilterParameters *parameters = nullptr;
+
 	ExpressionEncodeContext(const std::vector<column_t> &col_ids, const std::vector<std::string> &col_names,
 							const std::vector<LogicalType> &col_types)
 		: column_ids(col_ids), column_names(col_names), column_types(col_types), depth(0) {}
@@ -103,6 +124,10 @@ struct ExpressionEncodeContext {
 		ctx.pk_column_types = pk_column_types;
 		ctx.pk_is_composite = pk_is_composite;
 		ctx.filter_column = filter_column;
+		ctx.bound_refs_are_columns = bound_refs_are_columns;
+		ctx.table_alias = table_alias;
+		ctx.join_filter_max_in = join_filter_max_in;
+		ctx.parameters = parameters;
 		return ctx;
 	}
 
@@ -128,18 +153,22 @@ public:
 	 * @param column_ids Projection mapping: projected index → table column index
 	 * @param column_names All table column names
 	 * @param column_types All table column types
+	 * @param parameters Optional: collect comparison / IN constants as typed
+	 *        parameters instead of inlining them (mssql_scan_parameterize_filters)
 	 * @return FilterEncoderResult with WHERE clause and re-filter flag
 	 *
 	 * Contract:
 	 * - If filters is nullptr or empty, returns empty where_clause
 	 * - If any filter cannot be pushed, needs_duckdb_filter is true
-	 * - All column references are bracket-escaped
+	 * - All column references are bracket-escaped (and qualified by table_alias when given)
 	 * - All string literals use N'' prefix
 	 * - Result is valid T-SQL syntax
 	 */
 	static FilterEncoderResult Encode(const TableFilterSet *filters, const std::vector<column_t> &column_ids,
 									  const std::vector<std::string> &column_names,
-									  const std::vector<LogicalType> &column_types);
+									  const std::vector<LogicalType> &column_types,
+									  FilterParameters *parameters = nullptr, const std::string *table_alias = nullptr,
+									  idx_t join_filter_max_in = DConstants::INVALID_INDEX);
 
 	//--------------------------------------------------------------------------
 	// Utility Functions (public for testing)
@@ -155,6 +184,11 @@ public:
 	 */
 	static std::string EscapeBracketIdentifier(const std::string &identifier);
 
+	/**
+	 * Bracket-escaped column reference, qualified by ctx.table_alias when set.
+	 */
+	static std::string QualifyColumn(const std::string &column_name, const ExpressionEncodeContext &ctx);
+
 	/**
 	 * Get T-SQL comparison operator for DuckDB ExpressionType.
 	 * @param type The ExpressionType
@@ -211,7 +245,8 @@ private:
 	 */
 	static ExpressionEncodeResult EncodeConstantComparison(const LegacyConstantFilter &filter,
 														   const std::string &column_name,
-														   const LogicalType &column_type);
+														   const LogicalType &column_type,
+														   const ExpressionEncodeContext &ctx);
 
 	/**
 	 * Encode IS_NULL filter.
@@ -227,7 +262,21 @@ private:
 	 * Encode IN_FILTER (col IN (values)).
 	 */
 	static ExpressionEncodeResult EncodeInFilter(const LegacyInFilter &filter, const std::string &column_name,
-												 const LogicalType &column_type);
+												 const LogicalType &column_type, const ExpressionEncodeContext &ctx);
+
+	/**
+	 * Encode a comparison / IN constant: a parameter placeholder when the
+	 * context collects parameters and the value has a typed encoding, the
+	 * inline literal otherwise.
+	 */
+	static std::string EncodeComparisonConstant(const Value &value, const LogicalType &type,
+												const ExpressionEncodeContext &ctx);
+
+	/**
+	 * Encode an operand of a comparison or BETWEEN: a parameter placeholder for
+	 * a constant when the context collects parameters, EncodeExpression otherwise.
+	 */
+	static ExpressionEncodeResult EncodeComparisonOperand(const Expression &expr, const ExpressionEncodeContext &ctx);
 
 	/**
 	 * Encode CONJUNCTION_AND filter.
@@ -245,6 +294,22 @@ private:
 													  const std::string &column_name, const LogicalType &column_type,
 													  const ExpressionEncodeContext &ctx);
 
+	/**
+	 * Encode OPTIONAL_FILTER (a filter DuckDB may skip, e.g. a join's IN set).
+	 * Always supported: a child the server cannot take is dropped, not re-checked.
+	 */
+	static ExpressionEncodeResult EncodeOptionalFilter(const LegacyOptionalFilter &filter,
+													   const std::string &column_name, const LogicalType &column_type,
+													   const ExpressionEncodeContext &ctx);
+
+	/**
+	 * Encode DYNAMIC_FILTER (a Top-N boundary): its current value, if any.
+	 * Always supported, like an optional filter.
+	 */
+	static ExpressionEncodeResult EncodeDynamicFilter(const LegacyDynamicFilter &filter, const std::string &column_name,
+													  const LogicalType &column_type,
+													  const ExpressionEncodeContext &ctx);
+
 	/**
 	 * Encode EXPRESSION_FILTER (arbitrary expression).
 	 */
@@ -291,6 +356,11 @@ private:
 	static ExpressionEncodeResult EncodeColumnRef(const BoundColumnRefExpression &expr,
 												  const ExpressionEncodeContext &ctx);
 
+	/**
+	 * Encode projected column `projected_idx` (mapped through ctx.column_ids).
+	 */
+	static ExpressionEncodeResult EncodeProjectedColumn(column_t projected_idx, const ExpressionEncodeContext &ctx);
+
 	/**
 	 * Encode a constant value.
 	 */
@@ -0,0 +1,59 @@
+// Filter Parameters
+// Pushed-down filter constants as typed sp_executesql parameters
+//
+// NAMING CONVENTION:
+// - Namespace: duckdb::mssql (MSSQL-specific module)
+// - Types in duckdb::mssql do NOT use MSSQL prefix
+
+#pragma once
+
+#include <string>
+#include "duckdb.hpp"
+#include "tds/tds_protocol.hpp"
+
+namespace duckdb {
+namespace mssql {
+
+/**
+ * Collects the constants of pushed-down filters as typed parameters
+ * (mssql_scan_parameterize_filters).
+ *
+ * Inlined literals make every distinct `WHERE [id] = 123` a distinct query
+ * text, so SQL Server compiles and caches a plan per value. Sent through
+ * sp_executesql as `WHERE [id] = @p0` with `@p0 int`, the text is the same for
+ * every value and the cached plan is reused.
+ *
+ * Each parameter is declared with the SQL Server counterpart of the column's
+ * DuckDB type, so the comparison keeps the column's type and stays sargable.
+ * Values without a typed encoding here (NULL, intervals, UUIDs, blobs, times,
+ * TIMESTAMP WITH TIME ZONE, HUGEINT, out-of-range dates) stay literals.
+ */
+class FilterParameters {
+public:
+	// SQL Server accepts at most 2100 parameters per request; beyond this the
+	// remaining constants of the query stay literals.
+	static constexpr idx_t MAX_PARAMETERS = 2000;
+
+	/**
+	 * Bind `value` as the next parameter, typed from `type`.
+	 * @return The placeholder ("@p3"), or empty if the value stays a literal
+	 */
+	std::string Bind(const Value &value, const LogicalType &type);
+
+	idx_t Count() const {
+		return parameters_.values.size();
+	}
+
+	/**
+	 * Declarations and wire-encoded values, for MSSQLResultStream::SetParameters.
+	 */
+	const tds::ExecuteSqlParameters &Get() const {
+		return parameters_;
+	}
+
+private:
+	tds::ExecuteSqlParameters parameters_;
+};
+
+}  // namespace mssql
+}  // namespace duckdb
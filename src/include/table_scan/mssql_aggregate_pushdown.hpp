@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// table_scan/mssql_aggregate_pushdown.hpp
+//
+// GROUP BY / aggregate pushdown, part of the MSSQL optimizer extension
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+//! Rewrite a LogicalAggregate over an MSSQLRemoteRelation (a catalog scan, or
+//! a join already pushed down) into a projection over an mssql_scan of the
+//! pre-aggregated query:
+//!
+//!   SELECT <keys>, <aggregates> FROM <relation> WHERE <filters> GROUP BY <keys>
+//!
+//! SUM / MIN / MAX / COUNT / COUNT(*) are computed by SQL Server, AVG as
+//! SUM / COUNT_BIG. The projection casts each remote column to the type the
+//! aggregate produced, and references to the aggregate's outputs anywhere in
+//! `root` are rebound to it. Returns false, leaving the plan untouched, when
+//! any group, aggregate or filter has no exact T-SQL equivalent.
+bool TryPushAggregate(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+					  unique_ptr<LogicalOperator> &plan);
+
+}  // namespace duckdb
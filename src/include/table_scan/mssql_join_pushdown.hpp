@@ -0,0 +1,28 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// table_scan/mssql_join_pushdown.hpp
+//
+// JOIN pushdown, part of the MSSQL optimizer extension
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+//! Rewrite an INNER or LEFT comparison join whose two inputs are relations of
+//! the same attached database (MSSQLRemoteRelation: a catalog scan, or a join
+//! already pushed down) into a projection over an mssql_scan of
+//!
+//!   SELECT <outputs> FROM <left> AS [l] {INNER|LEFT} JOIN <right> AS [r] ON <conditions> WHERE <filters>
+//!
+//! At least one condition must be an equality. References to the join's
+//! outputs anywhere in `root` are rebound to the projection. Returns false,
+//! leaving the plan untouched, when a condition, filter or output column has
+//! no exact T-SQL equivalent.
+bool TryPushJoin(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+				 unique_ptr<LogicalOperator> &plan);
+
+}  // namespace duckdb
@@ -14,8 +14,8 @@ namespace duckdb {
 
 class MSSQLOptimizer {
 public:
-	//! Optimizer callback: detect ORDER BY / TOP N patterns above MSSQL scans
-	//! and push them down to SQL Server
+	//! Optimizer callback: detect ORDER BY / TOP N, GROUP BY and JOIN patterns
+	//! over MSSQL scans and push them down to SQL Server
 	static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
 };
 
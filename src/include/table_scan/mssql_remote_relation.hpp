@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// table_scan/mssql_remote_relation.hpp
+//
+// Plan inputs the MSSQL optimizer extension can fold into a remote query,
+// shared by the aggregate and join pushdowns
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/planner/column_binding.hpp"
+#include "table_scan/filter_encoder.hpp"
+
+namespace duckdb {
+
+class LogicalGet;
+class LogicalProjection;
+struct MSSQLCatalogScanBindData;
+
+//! A relation SQL Server can compute as one FROM item: a catalog scan of an
+//! attached table, or an mssql_scan an earlier pushdown produced, optionally
+//! under one projection:
+//!
+//!   [LogicalProjection ->] LogicalGet(mssql_catalog_scan | pushed-down mssql_scan)
+struct MSSQLRemoteRelation {
+	const LogicalProjection *projection = nullptr;
+	const LogicalGet *get = nullptr;
+	//! Attached catalog the relation lives in
+	string context_name;
+	//! FROM item without alias: [schema].[table] or (<query>)
+	string from_sql;
+	//! The attached table; nullptr for a nested query
+	const MSSQLCatalogScanBindData *table = nullptr;
+	//! Columns of the FROM item, and each scan column_id mapped to them
+	const vector<string> *column_names = nullptr;
+	const vector<LogicalType> *column_types = nullptr;
+	vector<column_t> column_ids;
+
+	//! Match `op` as a relation; false for anything else, or a scan with a TOP
+	static bool Find(const LogicalOperator &op, MSSQLRemoteRelation &out);
+
+	//! FROM item, named `alias` when given (a derived table is always named)
+	string FromItem(const string *alias) const;
+
+	//! Encoding context over this relation's columns, qualified by `alias` when given
+	mssql::ExpressionEncodeContext EncodeContext(const string *alias) const;
+
+	//! Replace references to the projection's outputs by its expressions, so every
+	//! column reference left points at the scan. False if one points anywhere else.
+	bool InlineProjection(unique_ptr<Expression> &expr) const;
+
+	//! Column of the FROM item behind a bare reference to the scan
+	bool ResolveColumn(const Expression &expr, column_t &out_column) const;
+
+	//! T-SQL for `expr` as a SELECT list item, qualified by `alias` when given.
+	//! `expr` is left with the projection inlined. False if it has no encoding,
+	//! is a predicate, or is a column the table scan converts itself.
+	bool EncodeSelectItem(unique_ptr<Expression> &expr, const string *alias, string &out_sql) const;
+
+	//! The scan's filters as one T-SQL condition (empty when there are none).
+	//! False if any of them has no encoding or DuckDB would have to re-check it.
+	bool EncodeFilters(const string *alias, string &out_condition) const;
+};
+
+//! A BOOLEAN expression other than a bit column encodes as a predicate, which
+//! T-SQL does not accept as a value
+bool IsRemotePredicate(const Expression &expr);
+
+//! After column binding resolution a reference is a BoundReference into the
+//! child's output. Replace references into `projections[level]` (top first) by
+//! copies of its expressions, down to references to the output of the scan
+//! under the last one. False if a reference of another kind is left.
+bool InlineResolvedProjections(unique_ptr<Expression> &expr, const vector<const LogicalProjection *> &projections,
+							   idx_t level);
+
+//! A source plan handed to the catalog for a write (resolved, see above) as one
+//! SELECT the server can run on its own: projections over a relation, with its
+//! filters. The SELECT list follows `columns` (output indexes of `op`), or all
+//! of `op`'s outputs when null. The statement feeds columns of `op`'s types, so
+//! a widening cast on top of an item is left to the server's implicit one. With
+//! `database`, the table is named in it (a three-part name), which a nested
+//! query cannot be. False if any item or filter has no exact encoding.
+bool EncodeRemoteSelect(const LogicalOperator &op, const vector<idx_t> *columns, const string *database,
+						string &out_context_name, string &out_query);
+
+//! Replace `plan` by a projection over an mssql_scan of `query` on `context_name`.
+//! Column i of the query becomes `bindings[i]`, cast to `types[i]`, for every
+//! operator in `root`. False, leaving the plan untouched, if the server cannot
+//! describe the query or describes a different number of columns.
+bool ReplaceWithRemoteQuery(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+							unique_ptr<LogicalOperator> &plan, const string &context_name, const string &query,
+							const vector<ColumnBinding> &bindings, const vector<LogicalType> &types);
+
+}  // namespace duckdb
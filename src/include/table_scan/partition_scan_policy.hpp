@@ -0,0 +1,205 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// table_scan/partition_scan_policy.hpp
+//
+// Which partitions of a partitioned table a catalog scan reads, and how the
+// surviving partitions are grouped onto streams.
+//
+// A table on a partition scheme is split by SQL Server itself: the partition
+// function maps every value of the partitioning column to a partition number,
+// and `$PARTITION.pf(col) = k` restricts a query to partition k with static
+// partition elimination — one partition's rowset, whatever the index. That is
+// a better split than the key ranges of scan_range_policy.hpp: it works for
+// heaps and columnstores, and needs no MIN/MAX round trip.
+//
+// Two decisions live here rather than in table_scan.cpp:
+//
+//   * PRUNING: the pushed-down filter narrows the partitioning column to an
+//     interval, and the function's boundary values map that interval to a
+//     contiguous run of partition numbers. A partition dropped here is never
+//     queried, so an off-by-one at a boundary silently loses rows;
+//   * GROUPING: a table may have thousands of partitions but the pool only a
+//     handful of spare connections, so partitions are packed into at most
+//     `streams` contiguous groups.
+//
+// Templated on the boundary type so the unit test can use int64_t while the
+// scan uses duckdb::Value. T needs operator< and operator==.
+//
+// Deliberately a self-contained header of plain types, like copy/load_policy.hpp:
+// -I src/include is the whole build recipe for its unit test.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+//! A closed/open interval on the partitioning column, narrowed one pushed-down
+//! comparison at a time. An unset side is unbounded. `empty` records a
+//! contradiction (x > 5 AND x < 3) — no partition survives.
+template <class T>
+struct MSSQLPartitionKeyInterval {
+	bool has_lower = false;
+	bool lower_inclusive = true;
+	T lower {};
+	bool has_upper = false;
+	bool upper_inclusive = true;
+	T upper {};
+	bool empty = false;
+
+	bool IsBounded() const {
+		return has_lower || has_upper || empty;
+	}
+
+	//! x >= value (inclusive) or x > value. Keeps the tighter of the two bounds.
+	void NarrowLower(const T &value, bool inclusive) {
+		if (!has_lower || lower < value || (lower == value && !inclusive)) {
+			has_lower = true;
+			lower = value;
+			lower_inclusive = inclusive;
+		}
+		CheckEmpty();
+	}
+
+	//! x <= value (inclusive) or x < value. Keeps the tighter of the two bounds.
+	void NarrowUpper(const T &value, bool inclusive) {
+		if (!has_upper || value < upper || (upper == value && !inclusive)) {
+			has_upper = true;
+			upper = value;
+			upper_inclusive = inclusive;
+		}
+		CheckEmpty();
+	}
+
+private:
+	void CheckEmpty() {
+		if (!has_lower || !has_upper) {
+			return;
+		}
+		if (upper < lower || (lower == upper && !(lower_inclusive && upper_inclusive))) {
+			empty = true;
+		}
+	}
+};
+
+//! 1-based partition number of the first partition that can hold a value
+//! >= lower (inclusive) or > lower. `boundaries` are the function's boundary
+//! values in ascending order; partition_count is boundaries.size() + 1.
+//!
+//! RANGE LEFT puts a boundary value in the partition to its left (partition k
+//! holds b[k-1] < x <= b[k]); RANGE RIGHT puts it in the partition to its right
+//! (b[k-1] <= x < b[k]). A boundary equal to the bound therefore counts as
+//! "passed" for RANGE RIGHT always, and for RANGE LEFT only when the bound is
+//! exclusive: x > b[k] starts in partition k + 1 under either.
+template <class T>
+uint64_t MSSQLFirstPartitionFor(const std::vector<T> &boundaries, bool range_right, const T &lower, bool inclusive) {
+	uint64_t passed = 0;
+	for (const auto &b : boundaries) {
+		if (b < lower || (b == lower && (range_right || !inclusive))) {
+			passed++;
+		} else {
+			break;
+		}
+	}
+	return passed + 1;
+}
+
+//! 1-based partition number of the last partition that can hold a value
+//! <= upper (inclusive) or < upper. Mirror of MSSQLFirstPartitionFor: x < b[k]
+//! under RANGE RIGHT ends in partition k, while x <= b[k] reaches k + 1.
+template <class T>
+uint64_t MSSQLLastPartitionFor(const std::vector<T> &boundaries, bool range_right, const T &upper, bool inclusive) {
+	uint64_t passed = 0;
+	for (const auto &b : boundaries) {
+		if (b < upper || (b == upper && range_right && inclusive)) {
+			passed++;
+		} else {
+			break;
+		}
+	}
+	return passed + 1;
+}
+
+//! Partition numbers (ascending) that can hold a row matching `interval`.
+//! An unbounded interval keeps all `partition_count` partitions; so does a
+//! boundary list that does not describe them (a size mismatch means the cached
+//! boundaries are unusable, and pruning on them would be a guess).
+//!
+//! NULLs land in partition 1, but no comparison matches NULL, so a bounded
+//! interval never has to keep partition 1 for them.
+template <class T>
+std::vector<uint64_t> MSSQLPrunePartitions(uint64_t partition_count, const std::vector<T> &boundaries,
+										   bool range_right, const MSSQLPartitionKeyInterval<T> &interval) {
+	std::vector<uint64_t> partitions;
+	if (interval.empty) {
+		return partitions;
+	}
+	uint64_t first = 1;
+	uint64_t last = partition_count;
+	if (boundaries.size() + 1 == partition_count) {
+		if (interval.has_lower) {
+			first = MSSQLFirstPartitionFor(boundaries, range_right, interval.lower, interval.lower_inclusive);
+		}
+		if (interval.has_upper) {
+			last = MSSQLLastPartitionFor(boundaries, range_right, interval.upper, interval.upper_inclusive);
+		}
+	}
+	for (uint64_t k = first; k <= last; k++) {
+		partitions.push_back(k);
+	}
+	return partitions;
+}
+
+//! Pack `partitions` into at most `streams` groups of consecutive entries, as
+//! evenly as the count allows (sizes differ by at most one). Consecutive, so a
+//! group over a run of adjacent partitions reads them in partition order.
+inline std::vector<std::vector<uint64_t>> MSSQLGroupPartitions(const std::vector<uint64_t> &partitions,
+															   uint64_t streams) {
+	std::vector<std::vector<uint64_t>> groups;
+	if (partitions.empty()) {
+		return groups;
+	}
+	if (streams < 1) {
+		streams = 1;
+	}
+	if (streams > partitions.size()) {
+		streams = partitions.size();
+	}
+	const uint64_t per_group = partitions.size() / streams;
+	const uint64_t extra = partitions.size() % streams;
+	size_t next = 0;
+	for (uint64_t g = 0; g < streams; g++) {
+		const uint64_t size = per_group + (g < extra ? 1 : 0);
+		groups.emplace_back(partitions.begin() + next, partitions.begin() + next + size);
+		next += size;
+	}
+	return groups;
+}
+
+//! T-SQL predicate restricting a scan to one group of partitions.
+//! `partition_expr` is the already-quoted `$PARTITION.[pf]([col])`. A run of
+//! adjacent partitions renders as BETWEEN, anything else as IN; either form
+//! gets static partition elimination.
+inline std::string MSSQLBuildPartitionPredicate(const std::string &partition_expr,
+												const std::vector<uint64_t> &group) {
+	if (group.size() == 1) {
+		return partition_expr + " = " + std::to_string(group.front());
+	}
+	if (group.back() - group.front() + 1 == group.size()) {
+		return partition_expr + " BETWEEN " + std::to_string(group.front()) + " AND " + std::to_string(group.back());
+	}
+	std::string in_list;
+	for (const auto k : group) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += std::to_string(k);
+	}
+	return partition_expr + " IN (" + in_list + ")";
+}
+
+}  // namespace duckdb
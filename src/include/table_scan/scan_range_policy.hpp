@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// table_scan/scan_range_policy.hpp
+//
+// How many key ranges a catalog table scan splits into, and where the ranges
+// start and end.
+//
+// A catalog scan used to be ONE result stream on ONE connection: MaxThreads()
+// returned 1, so a large fact table streamed through a single socket while
+// every other DuckDB thread waited. The parallel scan splits the table on the
+// leading key of its clustered index into N half-open ranges, and each DuckDB
+// thread drains its own range on its own pooled connection.
+//
+// Two decisions live here rather than in table_scan.cpp:
+//
+//   * the range COUNT, which has four independent ceilings (the setting, the
+//     thread count, the pool's headroom, and the table's size) and is easy to
+//     get subtly wrong in a way that only shows as a scan that did not scale;
+//   * the range PREDICATES, where an off-by-one is silent — a boundary row
+//     either appears twice or not at all, and COUNT(*) over a 500M-row table is
+//     not where anyone looks first.
+//
+// Deliberately a self-contained header of plain types, like copy/load_policy.hpp:
+// -I src/include is the whole build recipe for its unit test.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+//! Ceiling on key ranges per scan when `mssql_scan_parallel_ranges` is 0.
+//! Each range holds a pooled connection for the life of its stream, so the cap
+//! is about the server and the pool, not about DuckDB's thread count.
+constexpr uint64_t MSSQL_MAX_SCAN_RANGES = 16;
+
+//! `mssql_scan_parallel_ranges` default: derive from the thread count.
+constexpr int64_t MSSQL_DEFAULT_SCAN_PARALLEL_RANGES = 0;
+
+//! `mssql_scan_parallel_min_rows` default. A range smaller than this costs more
+//! in connection acquisition and query compilation than it saves in transfer,
+//! so a table below it stays on one stream.
+constexpr int64_t MSSQL_DEFAULT_SCAN_PARALLEL_MIN_ROWS = 500000;
+
+//! Resolve how many key ranges a scan splits into. 1 means a single stream.
+//!
+//! `configured` is `mssql_scan_parallel_ranges` (0 = derive from
+//! `thread_count`, capped at MSSQL_MAX_SCAN_RANGES). `connection_headroom` is
+//! what the pool can still hand out; a range past it would block in Acquire()
+//! for the full acquire timeout. `row_count` is the statistics provider's
+//! estimate and `min_rows_per_range` the setting of that name. `key_span` is
+//! MAX(key) - MIN(key) + 1, saturated; there is no point in more ranges than
+//! there are distinct keys.
+inline uint64_t MSSQLResolveScanRangeCount(int64_t configured, uint64_t thread_count, uint64_t connection_headroom,
+										   uint64_t row_count, uint64_t min_rows_per_range, uint64_t key_span) {
+	uint64_t ranges;
+	if (configured > 0) {
+		ranges = static_cast<uint64_t>(configured);
+	} else {
+		ranges = thread_count < MSSQL_MAX_SCAN_RANGES ? thread_count : MSSQL_MAX_SCAN_RANGES;
+	}
+	if (ranges > connection_headroom) {
+		ranges = connection_headroom;
+	}
+	if (min_rows_per_range > 0) {
+		const uint64_t by_size = row_count / min_rows_per_range;
+		if (ranges > by_size) {
+			ranges = by_size;
+		}
+	}
+	if (ranges > key_span) {
+		ranges = key_span;
+	}
+	return ranges > 0 ? ranges : 1;
+}
+
+//! Interior boundaries splitting [min_key, max_key] into `ranges` ranges of
+//! near-equal key width: ranges - 1 values, strictly increasing, each
+//! > min_key and <= max_key. Empty when ranges < 2 or the span cannot be split.
+//!
+//! The arithmetic is unsigned on the key count so a BIGINT key from INT64_MIN to
+//! INT64_MAX does not overflow, and the per-step product is split into quotient
+//! and remainder for the same reason.
+inline std::vector<int64_t> MSSQLSplitKeyRange(int64_t min_key, int64_t max_key, uint64_t ranges) {
+	std::vector<int64_t> bounds;
+	if (ranges < 2 || max_key <= min_key) {
+		return bounds;
+	}
+	const uint64_t span = static_cast<uint64_t>(max_key) - static_cast<uint64_t>(min_key);
+	const uint64_t keys = span == UINT64_MAX ? span : span + 1;
+	const uint64_t step = keys / ranges;
+	const uint64_t rem = keys % ranges;
+	for (uint64_t i = 1; i < ranges; i++) {
+		const uint64_t offset = step * i + (rem * i) / ranges;
+		const int64_t bound = static_cast<int64_t>(static_cast<uint64_t>(min_key) + offset);
+		if (bound <= min_key || (!bounds.empty() && bound <= bounds.back())) {
+			continue;
+		}
+		bounds.push_back(bound);
+	}
+	return bounds;
+}
+
+//! One T-SQL predicate per range over `quoted_key` (already bracket-quoted),
+//! for interior bounds already rendered as T-SQL literals in ascending order:
+//! bound_literals.size() + 1 entries.
+//!
+//! The outer ranges are OPEN — the first has no lower bound, the last no upper —
+//! so a row inserted outside [MIN, MAX] after the boundaries were read is still
+//! returned exactly once, as it would be by the single-stream scan. The first
+//! range also owns NULL keys: a clustered index may lead with a nullable column,
+//! and `key < b` never matches NULL.
+inline std::vector<std::string> MSSQLBuildRangePredicates(const std::string &quoted_key,
+														  const std::vector<std::string> &bound_literals) {
+	std::vector<std::string> predicates;
+	if (bound_literals.empty()) {
+		return predicates;
+	}
+	predicates.push_back("(" + quoted_key + " < " + bound_literals.front() + " OR " + quoted_key + " IS NULL)");
+	for (size_t i = 1; i < bound_literals.size(); i++) {
+		predicates.push_back(quoted_key + " >= " + bound_literals[i - 1] + " AND " + quoted_key + " < " +
+							 bound_literals[i]);
+	}
+	predicates.push_back(quoted_key + " >= " + bound_literals.back());
+	return predicates;
+}
+
+//! MSSQLBuildRangePredicates for the integer bounds from MSSQLSplitKeyRange.
+inline std::vector<std::string> MSSQLBuildKeyRangePredicates(const std::string &quoted_key,
+															 const std::vector<int64_t> &bounds) {
+	std::vector<std::string> literals;
+	literals.reserve(bounds.size());
+	for (const auto bound : bounds) {
+		literals.push_back(std::to_string(bound));
+	}
+	return MSSQLBuildRangePredicates(quoted_key, literals);
+}
+
+}  // namespace duckdb
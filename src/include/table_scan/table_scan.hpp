@@ -11,8 +11,13 @@
 #include "duckdb.hpp"
 
 namespace duckdb {
+
+struct MSSQLScanGlobalState;
+
 namespace mssql {
 
+struct TableScanLocalState;
+
 /**
  * Get the table function for catalog-based MSSQL table scans.
  *
@@ -22,9 +27,20 @@ namespace mssql {
  * - func.projection_pushdown = true
  * - func.filter_pushdown = true
  * - func.filter_prune = true
- * - MaxThreads() = 1 (single-threaded)
+ * - MaxThreads() = number of key ranges or partition groups (1 = single stream)
  */
 TableFunction GetCatalogScanFunction();
 
+/**
+ * Produce the next chunk of a parallel scan (global_state.range_queries set).
+ *
+ * Each thread claims one range at a time, opens its stream on its own pooled
+ * connection, drains it, and claims the next. Shared by the catalog scan and by
+ * a partitioned mssql_scan; a stream already open in global_state.result_stream
+ * is used for range 0. Emits an empty chunk once this thread has no range left.
+ */
+void ExecuteScanRanges(ClientContext &context, MSSQLScanGlobalState &global_state, TableScanLocalState &local_state,
+					   DataChunk &output);
+
 }  // namespace mssql
 }  // namespace duckdb
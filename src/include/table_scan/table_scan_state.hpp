@@ -66,10 +66,23 @@ struct TableScanGlobalState : public GlobalTableFunctionState {
 };
 
 /**
- * Per-thread local state (minimal for single-threaded scan).
+ * Per-thread local state.
+ *
+ * A single-stream scan keeps nothing here. A parallel key-range scan keeps the
+ * stream of the range this thread claimed; it is released (and its connection
+ * returned to the pool) before the next range is claimed.
  */
 struct TableScanLocalState : public LocalTableFunctionState {
 	idx_t current_chunk = 0;
+
+	// Stream of the key range this thread is draining (parallel scan only)
+	unique_ptr<MSSQLResultStream> range_stream;
+
+	// Index of that range, for debug logging
+	idx_t range_index = 0;
+
+	// Set once no range is left to claim, or the scan was interrupted
+	bool done = false;
 };
 
 }  // namespace mssql
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "tds/tds_protocol.hpp"
+
+namespace duckdb {
+namespace tds {
+namespace encoding {
+
+//===----------------------------------------------------------------------===//
+// RpcParameterEncoder - DuckDB values as typed RPC parameters
+//
+// Encodes a value as an sp_executesql / sp_execute parameter: the SQL Server
+// declaration (`int`, `decimal(18,2)`, `nvarchar(4000)`, ...), the TYPE_INFO
+// and the TYPE_VARBYTE value. Value bytes come from BCPRowEncoder: an RPC
+// parameter value is the same length-prefixed form a BulkLoadBCP row carries.
+//
+// Types without a typed encoding here (intervals, UUIDs, blobs, times,
+// TIMESTAMP WITH TIME ZONE, HUGEINT, UBIGINT above INT64_MAX, out-of-range
+// dates) are left to the caller, which keeps them as SQL literals.
+//===----------------------------------------------------------------------===//
+
+class RpcParameterEncoder {
+public:
+	// Encode `value`, which must already be of `type`, into `param` (its name is
+	// kept). Returns the declaration, or empty if the type has no encoding.
+	static std::string Encode(const Value &value, const LogicalType &type, RpcParameter &param);
+
+	// Cast `value` to `type`, encode it as the next parameter of `parameters`
+	// (@p0, @p1, ...) and append its declaration. Returns the placeholder, or
+	// empty (nothing appended) for NULL and for values Encode leaves out.
+	static std::string Bind(const Value &value, const LogicalType &type, ExecuteSqlParameters &parameters);
+
+	// Bind for row `row` of `input`, read through its precomputed
+	// UnifiedVectorFormat. When `input` is already of `type`, BOOLEAN, SMALLINT,
+	// INTEGER, BIGINT and VARCHAR are encoded from the vector data; anything
+	// else goes through Bind(GetValue(row)). Same result as that call.
+	static std::string BindFromFormat(Vector &input, const UnifiedVectorFormat &fmt, idx_t row,
+									  const LogicalType &type, ExecuteSqlParameters &parameters);
+
+private:
+	// Append an encoded parameter and its declaration; returns its placeholder
+	static std::string AppendParameter(RpcParameter param, const std::string &declaration,
+									   ExecuteSqlParameters &parameters);
+};
+
+}  // namespace encoding
+}  // namespace tds
+}  // namespace duckdb
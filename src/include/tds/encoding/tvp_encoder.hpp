@@ -0,0 +1,91 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "tds/tds_protocol.hpp"
+
+namespace duckdb {
+namespace tds {
+namespace encoding {
+
+//===----------------------------------------------------------------------===//
+// TvpEncoder - rows as one table-valued RPC parameter
+//
+// A TVP carries a whole row set in a single parameter of a user-defined table
+// type, so the statement text stays the same however many rows travel and the
+// 2100-parameter request limit does not apply. The type must already exist on
+// the server. ColumnDeclaration gives a column declaration that fits the wire
+// type; a table type may declare the column differently (a varchar key, say),
+// and the server converts each value into it.
+//
+// Wire form (MS-TDS 2.2.5.5.5): TYPE_INFO is TVPTYPE plus the type's
+// (database, schema, name); the value is TVP_COLMETADATA, TVP_END_TOKEN, one
+// TVP_ROW_TOKEN + column values per row, TVP_END_TOKEN. Column values use the
+// same TYPE_VARBYTE forms as RpcParameterEncoder; strings are always
+// nvarchar(max), because a column's type cannot depend on the batch.
+//
+// Usage:
+//   TvpEncoder tvp(types);
+//   for (auto &row : rows) {
+//       tvp.BeginRow();
+//       for (auto &value : row) {
+//           if (!tvp.Append(value)) { /* value has no TVP encoding */ }
+//       }
+//       // or, per column: tvp.AppendFromFormat(vector, fmt, row)
+//   }
+//   auto param = tvp.Finish("@rows", "dbo", TvpEncoder::TypeName(declarations));
+//===----------------------------------------------------------------------===//
+
+class TvpEncoder {
+public:
+	// Table type column declaration for `type` ("int", "decimal(18,2)",
+	// "nvarchar(max)", ...), or empty if the type cannot be a TVP column.
+	static std::string ColumnDeclaration(const LogicalType &type);
+
+	// Table type name for a column list: tables whose keys and values are
+	// declared the same share one type ("duckdb_tvp_" + hash of the declarations).
+	static std::string TypeName(const vector<std::string> &declarations);
+
+	// `types` must all have a ColumnDeclaration
+	explicit TvpEncoder(vector<LogicalType> types);
+
+	// Start the next row; exactly one Append per column must follow
+	void BeginRow();
+
+	// Append the next column value of the current row (cast to the column's
+	// type). False if the value has no encoding (out-of-range date, UBIGINT
+	// above INT64_MAX, ...); the encoder is then unusable.
+	bool Append(const Value &value);
+
+	// Append row `row` of `input`, read through its precomputed
+	// UnifiedVectorFormat, as the next column value. NULLs, and BOOLEAN,
+	// SMALLINT, INTEGER, BIGINT and VARCHAR cells of the column's own type, are
+	// encoded from the vector data; anything else goes through Append(Value).
+	bool AppendFromFormat(Vector &input, const UnifiedVectorFormat &fmt, idx_t row);
+
+	idx_t RowCount() const {
+		return row_count_;
+	}
+
+	// The finished parameter, declared as `[schema].[type_name] READONLY`
+	RpcParameter Finish(const std::string &name, const std::string &schema, const std::string &type_name);
+
+private:
+	// NULL of a column: PLP_NULL for nvarchar(max), a zero length otherwise
+	void AppendNull(const LogicalType &type);
+
+	// nvarchar(max) value as one PLP chunk
+	void AppendPlpString(const std::string &utf8);
+
+	vector<LogicalType> types_;
+	std::vector<uint8_t> rows_;
+	idx_t column_ = 0;
+	idx_t row_count_ = 0;
+};
+
+}  // namespace encoding
+}  // namespace tds
+}  // namespace duckdb
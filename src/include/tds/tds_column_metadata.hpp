@@ -60,13 +60,14 @@ public:
 	// Throws on parse error
 	static bool Parse(const uint8_t *data, size_t length, size_t &bytes_consumed, std::vector<ColumnMetadata> &columns);
 
+	// Parse type-specific metadata (length, precision, scale, collation).
+	// Also the TYPE_INFO of a RETURNVALUE token, which has the same layout.
+	static bool ParseTypeInfo(const uint8_t *data, size_t length, size_t &offset, ColumnMetadata &column);
+
 private:
 	// Parse a single column definition
 	static bool ParseColumn(const uint8_t *data, size_t length, size_t &offset, ColumnMetadata &column);
 
-	// Parse type-specific metadata (length, precision, scale, collation)
-	static bool ParseTypeInfo(const uint8_t *data, size_t length, size_t &offset, ColumnMetadata &column);
-
 	// Parse B_VARCHAR column name
 	static bool ParseColumnName(const uint8_t *data, size_t length, size_t &offset, std::string &name);
 };
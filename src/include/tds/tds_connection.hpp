@@ -7,6 +7,7 @@
 #include <string>
 #include "tds/auth/iauthenticator.hpp"
 #include "tds_platform.hpp"
+#include "tds_prepared_cache.hpp"
 #include "tds_protocol.hpp"
 #include "tds_socket.hpp"
 #include "tds_types.hpp"
@@ -14,6 +15,8 @@
 namespace duckdb {
 namespace tds {
 
+struct ReturnValueToken;
+
 // Outcome of ONE login attempt against ONE target (spec 068 D1).
 //
 // The contract, in one rule: a login helper that sees ROUTING in the response
@@ -153,6 +156,27 @@ public:
 	// After this, use ReceiveData() to read response packets
 	bool ExecuteBatch(const std::string &sql);
 
+	// Execute `sql` through sp_executesql with typed parameters (RPC request).
+	// Same contract as ExecuteBatch; with no parameters it IS ExecuteBatch.
+	bool ExecuteSql(const std::string &sql, const ExecuteSqlParameters &parameters);
+
+	// Execute `sql` with typed parameters through a prepared handle: sp_execute
+	// when this session already prepared the same (declarations, text), else
+	// sp_prepexec. Handles evicted from the LRU are released by sp_unprepare
+	// calls batched into the same request. Same contract as ExecuteBatch; with
+	// no parameters it IS ExecuteBatch, with capacity 0 it is ExecuteSql.
+	// The reader of the response must pass RETURNVALUE tokens to OnReturnValue.
+	bool ExecutePrepared(const std::string &sql, const ExecuteSqlParameters &parameters);
+
+	// RETURNVALUE from the response to ExecutePrepared: sp_prepexec's handle.
+	// Other OUTPUT parameters are ignored whatever their type. False only when
+	// the handle itself came back in a type the parser does not decode; the
+	// reader keeps draining and then fails the statement.
+	bool OnReturnValue(const ReturnValueToken &value);
+
+	// Prepared handles kept for this session (mssql_prepared_cache_size)
+	void SetPreparedCacheCapacity(size_t capacity);
+
 	// Receive more response data into provided buffer
 	// Returns bytes received, 0 on connection close, -1 on error
 	// timeout_ms: 0 = non-blocking, >0 = wait up to timeout_ms
@@ -202,6 +226,18 @@ public:
 	bool IsTlsEnabled() const {
 		return tls_enabled_;
 	}
+	// True when the login's TLS handshake resumed a cached session instead of
+	// running the full key exchange
+	bool IsTlsSessionReused() const {
+		return tls_enabled_ && socket_ && socket_->IsTlsSessionReused();
+	}
+	// True when mssql_tls_kernel_offload engaged for the receive / send side
+	bool IsKernelTlsRx() const {
+		return tls_enabled_ && socket_ && socket_->IsKernelTlsRx();
+	}
+	bool IsKernelTlsTx() const {
+		return tls_enabled_ && socket_ && socket_->IsKernelTlsTx();
+	}
 
 	// Transaction descriptor management (for SQL_BATCH ALL_HEADERS)
 	// Set the transaction descriptor (8 bytes) from ENVCHANGE BEGIN_TRANS response
@@ -276,6 +312,13 @@ public:
 		request_utf8_support_ = request;
 	}
 
+	// Offload the TLS record layer to the kernel right after the handshake
+	// (Linux kTLS, mssql_tls_kernel_offload). Best effort: a connection whose
+	// kernel, TLS version or cipher rules it out stays on OpenSSL.
+	void SetKernelTls(bool enable) {
+		kernel_tls_ = enable;
+	}
+
 	// True only if this connection asked for UTF8SUPPORT and the server acked it,
 	// i.e. UTF-8-collation columns arrive as UTF-8 rather than transcoded UTF-16.
 	bool UTF8SupportAcked() const {
@@ -283,6 +326,10 @@ public:
 	}
 
 private:
+	// Send a built request (SQL_BATCH or RPC) on an Executing connection,
+	// setting RESET_CONNECTION on the first packet when a reset is pending
+	bool SendRequest(std::vector<TdsPacket> &packets);
+
 	// Issue #225: record what the server granted. Assignment, not accumulation —
 	// a routed reconnect logs in again, and the new server's answer is the one
 	// that counts. Only a feature this client asked for can be granted: the
@@ -303,6 +350,9 @@ private:
 	bool request_utf8_support_ = true;
 	bool utf8_support_acked_ = false;
 
+	// Install kernel TLS after each handshake (SetKernelTls)
+	bool kernel_tls_ = false;
+
 	// Connection info
 	std::string host_;
 	uint16_t port_;
@@ -354,6 +404,13 @@ private:
 	// Connection reset flag — when true, next SQL_BATCH sets RESET_CONNECTION in TDS header
 	bool needs_reset_ = false;
 
+	// Prepared statement handles of this session (ExecutePrepared). Evicted
+	// handles wait in pending_unprepare_ for the next request to release them;
+	// pending_prepare_key_ is the statement an in-flight sp_prepexec prepares.
+	PreparedStatementCache prepared_cache_;
+	std::vector<int32_t> pending_unprepare_;
+	std::string pending_prepare_key_;
+
 	// FEDAUTH echo flag — set during PRELOGIN if server's FEDAUTHREQUIRED was non-zero
 	// Per MS-TDS: client must echo this value back in LOGIN7's FEDAUTH options byte (bit 0)
 	bool fedauth_echo_ = false;
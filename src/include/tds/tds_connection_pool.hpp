@@ -3,10 +3,10 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <unordered_map>
 #include "tds_connection.hpp"
@@ -43,6 +43,14 @@ struct PoolStatistics {
 	size_t acquire_timeout_count = 0;
 	uint64_t acquire_wait_total_ms = 0;
 	int64_t pinned_count = 0;  // Connections pinned to active transactions (spec 047 FR-005)
+	// TLS logins of connections this pool created: resumed a cached session
+	// (hit) or ran the full handshake (miss). Plaintext logins count as neither.
+	size_t tls_session_hits = 0;
+	size_t tls_session_misses = 0;
+	// Connections this pool created whose records the kernel decrypts (rx) or
+	// encrypts (tx): mssql_tls_kernel_offload engaged. Zero without the setting.
+	size_t kernel_tls_rx = 0;
+	size_t kernel_tls_tx = 0;
 };
 
 // Connection factory function type
@@ -112,11 +120,19 @@ private:
 	PoolConfiguration config_;
 	ConnectionFactory factory_;
 
-	// Connection storage
-	std::queue<ConnectionMetadata> idle_connections_;
-	std::unordered_map<uint64_t, std::shared_ptr<TdsConnection>> active_connections_;
-
-	// Synchronization. available_cv_ is reserved for Acquire() waiters —
+	// Connection storage. Idle connections are reused LIFO: Acquire() takes the
+	// back (the most recently released, warmest one, least likely to need the
+	// long-idle ping) and the cleanup thread retires from the front, so under
+	// a steady load the surplus actually reaches idle_timeout instead of every
+	// connection being rotated through. Active connections are keyed by
+	// pointer, so Release() finds its entry without a scan.
+	std::deque<ConnectionMetadata> idle_connections_;
+	std::unordered_map<TdsConnection *, ConnectionMetadata> active_connections_;
+
+	// Synchronization. pool_mutex_ guards the containers and stats_ only: the
+	// long-idle validation ping, connection creation and Close() all run with
+	// it released, so one slow socket never stalls every other checkout.
+	// available_cv_ is reserved for Acquire() waiters —
 	// Release()'s notify_one must always reach a thread blocked on pool
 	// exhaustion. The cleanup thread parks on its own cleanup_cv_ (notified
 	// only by Shutdown()) so it can never consume that wakeup.
@@ -128,6 +144,24 @@ private:
 	PoolStatistics stats_;
 	uint64_t next_connection_id_;
 
+	// Pre-warm logins in flight. Counted against connection_limit next to
+	// stats_.total_connections, so Acquire() cannot overshoot the limit while
+	// min_connections are still being built.
+	size_t pending_connections_ = 0;
+	// Earliest next pre-warm attempt after a login failed (server down, bad
+	// credentials). Guarded by pool_mutex_.
+	std::chrono::steady_clock::time_point warm_retry_after_;
+
+	// Pre-warm logins run on detached threads, so Shutdown() never waits out a
+	// login timeout. This is all they share with the pool: a login that
+	// finishes after Shutdown() finds `pool` null and closes its connection
+	// instead of handing it over. Lock order: handoff mutex, then pool_mutex_.
+	struct WarmHandoff {
+		std::mutex mutex;
+		ConnectionPool *pool = nullptr;
+	};
+	std::shared_ptr<WarmHandoff> warm_handoff_;
+
 	// Background cleanup
 	std::thread cleanup_thread_;
 	std::atomic<bool> shutdown_flag_;
@@ -139,8 +173,13 @@ private:
 
 	// Internal methods
 	void CleanupThreadFunc();
-	std::shared_ptr<TdsConnection> TryAcquireIdle();
+	void ReapIdleConnections();
+	void WarmUp();
+	static void WarmOne(const std::shared_ptr<WarmHandoff> &handoff, const ConnectionFactory &factory,
+						const std::string &context_name);
+	std::shared_ptr<TdsConnection> AdoptWarmConnection(std::shared_ptr<TdsConnection> conn);
 	std::shared_ptr<TdsConnection> CreateNewConnection();
+	void CountNewConnection(const TdsConnection &conn);
 	bool ValidateConnection(std::shared_ptr<TdsConnection> &conn);
 };
 
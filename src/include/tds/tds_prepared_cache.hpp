@@ -0,0 +1,122 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// tds/tds_prepared_cache.hpp
+//
+// Per-connection LRU of prepared statement handles (sp_prepexec / sp_execute).
+//
+// A prepared handle names a statement the server has already parsed and bound,
+// so executing it again skips both, not only the optimizer (which sp_executesql
+// already avoids through the plan cache). Handles belong to one session: they
+// are freed by sp_unprepare, by the RESET_CONNECTION a pooled connection sends
+// on its next request, and by closing the connection. The cache therefore
+// lives on the TdsConnection and is cleared whenever the session is.
+//
+// Self-contained (no DuckDB, no sockets) so the eviction order is unit-tested
+// without a server: test/cpp/test_prepared_cache.cpp.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace duckdb {
+namespace tds {
+
+//! `mssql_prepared_cache_size` default: handles kept per connection.
+constexpr int64_t DEFAULT_PREPARED_CACHE_SIZE = 32;
+
+class PreparedStatementCache {
+public:
+	//! Cache key: a statement is prepared for one (declarations, text) pair.
+	static std::string MakeKey(const std::string &declarations, const std::string &sql) {
+		std::string key;
+		key.reserve(declarations.size() + 1 + sql.size());
+		key += declarations;
+		key += '\0';
+		key += sql;
+		return key;
+	}
+
+	size_t Capacity() const {
+		return capacity_;
+	}
+
+	size_t Size() const {
+		return index_.size();
+	}
+
+	//! Change the capacity; handles beyond it are evicted (least recent first)
+	//! into `evicted`, for the caller to sp_unprepare.
+	void SetCapacity(size_t capacity, std::vector<int32_t> &evicted) {
+		capacity_ = capacity;
+		EvictTo(capacity_, evicted);
+	}
+
+	//! Handle prepared for `key`, marked most recently used. False if absent.
+	bool Lookup(const std::string &key, int32_t &handle) {
+		auto it = index_.find(key);
+		if (it == index_.end()) {
+			return false;
+		}
+		entries_.splice(entries_.begin(), entries_, it->second);
+		handle = it->second->second;
+		return true;
+	}
+
+	//! Remember `handle` for `key`. A handle already cached for the key, and the
+	//! least recently used entries beyond capacity, go to `evicted`. With
+	//! capacity 0 the new handle itself is evicted.
+	void Insert(const std::string &key, int32_t handle, std::vector<int32_t> &evicted) {
+		auto it = index_.find(key);
+		if (it != index_.end()) {
+			evicted.push_back(it->second->second);
+			entries_.erase(it->second);
+			index_.erase(it);
+		}
+		entries_.emplace_front(key, handle);
+		index_[key] = entries_.begin();
+		EvictTo(capacity_, evicted);
+	}
+
+	//! Forget `key` without releasing its handle (the server no longer has it).
+	void Forget(const std::string &key) {
+		auto it = index_.find(key);
+		if (it == index_.end()) {
+			return;
+		}
+		entries_.erase(it->second);
+		index_.erase(it);
+	}
+
+	//! Forget every handle without releasing them: the session that owned them
+	//! was reset or closed, which released them on the server.
+	void Clear() {
+		entries_.clear();
+		index_.clear();
+	}
+
+private:
+	void EvictTo(size_t limit, std::vector<int32_t> &evicted) {
+		while (entries_.size() > limit) {
+			auto &last = entries_.back();
+			evicted.push_back(last.second);
+			index_.erase(last.first);
+			entries_.pop_back();
+		}
+	}
+
+	size_t capacity_ = static_cast<size_t>(DEFAULT_PREPARED_CACHE_SIZE);
+	// Most recently used first
+	std::list<std::pair<std::string, int32_t>> entries_;
+	std::unordered_map<std::string, std::list<std::pair<std::string, int32_t>>::iterator> index_;
+};
+
+}  // namespace tds
+}  // namespace duckdb
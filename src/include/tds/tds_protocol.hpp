@@ -59,6 +59,26 @@ struct LoginResponse {
 	bool utf8_support_acked = false;  // FeatureId 0x0A -- UTF-8 collations arrive as UTF-8
 };
 
+// One parameter of an RPC request ([MS-TDS] 2.2.6.6 ParameterData), with its
+// TYPE_INFO and value already in wire form.
+struct RpcParameter {
+	std::string name;				 // "@p0"; empty for a positional parameter
+	std::vector<uint8_t> type_info;	 // TYPE_INFO: type byte + max length / precision / collation
+	std::vector<uint8_t> value;		 // TYPE_VARBYTE: length prefix + data
+};
+
+// Typed parameters of a statement sent through sp_executesql. The server
+// caches one plan per distinct (statement, declarations) text, so a query that
+// differs only in parameter values reuses it instead of compiling again.
+struct ExecuteSqlParameters {
+	std::string declarations;  // sp_executesql @params, e.g. "@p0 int, @p1 nvarchar(4000)"
+	std::vector<RpcParameter> values;
+
+	bool Empty() const {
+		return values.empty();
+	}
+};
+
 // TDS Protocol message builders and parsers
 // Implements PRELOGIN, LOGIN7, and basic response handling
 class TdsProtocol {
@@ -214,6 +234,42 @@ public:
 														   size_t max_packet_size = TDS_DEFAULT_PACKET_SIZE,
 														   const uint8_t *transaction_descriptor = nullptr);
 
+	// Build RPC request packet(s) calling sp_executesql by ProcID ([MS-TDS]
+	// 2.2.6.6): `sql` is @stmt, `parameters.declarations` is @params, and the
+	// typed values follow. Returns packets with EOM on the last one only.
+	// Parameters:
+	//   sql - statement text referencing the parameters as @p0, @p1, ...
+	//   parameters - declarations and wire-encoded values (may be empty)
+	//   max_packet_size - maximum TDS packet size
+	//   transaction_descriptor - 8-byte transaction descriptor (nullptr = no active transaction)
+	static std::vector<TdsPacket> BuildExecuteSqlMultiPacket(const std::string &sql,
+															 const ExecuteSqlParameters &parameters,
+															 size_t max_packet_size = TDS_DEFAULT_PACKET_SIZE,
+															 const uint8_t *transaction_descriptor = nullptr);
+
+	// Build RPC request packet(s) calling sp_prepexec: prepare `sql` with
+	// `parameters.declarations` and execute it with the values in one round
+	// trip. The handle comes back as the first RETURNVALUE of the response.
+	// `unprepare_handles` are released by sp_unprepare calls batched ahead of it.
+	static std::vector<TdsPacket> BuildPrepExecMultiPacket(const std::string &sql,
+														   const ExecuteSqlParameters &parameters,
+														   const std::vector<int32_t> &unprepare_handles,
+														   size_t max_packet_size = TDS_DEFAULT_PACKET_SIZE,
+														   const uint8_t *transaction_descriptor = nullptr);
+
+	// Build RPC request packet(s) calling sp_execute on a handle returned by
+	// sp_prepexec, with the values in declaration order. `unprepare_handles` as
+	// for BuildPrepExecMultiPacket.
+	static std::vector<TdsPacket> BuildExecuteMultiPacket(int32_t handle, const ExecuteSqlParameters &parameters,
+														  const std::vector<int32_t> &unprepare_handles,
+														  size_t max_packet_size = TDS_DEFAULT_PACKET_SIZE,
+														  const uint8_t *transaction_descriptor = nullptr);
+
+	// NVARCHAR RPC parameter: nvarchar(4000) up to 4000 UTF-16 code units,
+	// nvarchar(max) (PLP) beyond. The collation is left zero — the server
+	// applies the database default to Unicode parameters.
+	static RpcParameter MakeNVarCharParameter(const std::string &name, const std::string &utf8);
+
 	// Build ATTENTION packet for cancellation
 	static TdsPacket BuildAttention();
 
@@ -0,0 +1,258 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB MSSQL Extension
+//
+// tds/tds_ring_buffer.hpp
+//
+// Byte FIFO for the receive side: the socket's frame assembly buffer and the
+// token parser's row assembly buffer.
+//
+// Both used to be flat vectors that were compacted — the unconsumed tail
+// memmoved to the front — so a frame or a row straddling the end of what had
+// arrived stayed contiguous. With 32 KB packets that was a frame-sized memmove
+// per read in the socket and up to half the parser buffer per compaction.
+//
+// Where the platform allows it, the buffer is a "mirrored" ring instead: one
+// memfd mapped twice, back to back, so byte `capacity + i` IS byte `i`. The
+// live bytes are then contiguous wherever they wrap, Consume() only moves the
+// head, and nothing is ever copied to keep a span contiguous. Data moves only
+// when the ring grows (a row larger than the whole ring, e.g. a big PLP value).
+//
+// A mirrored ring costs a memfd, an ftruncate and three mmaps to set up and a
+// munmap to tear down: about 8 us, against well under 1 us for a heap buffer
+// (the setup-cost benchmark in test_ring_buffer). Noise for a result stream
+// that lives for a whole scan, a measurable share of a single-row INSERT. So
+// the layout is the owner's choice: the socket and the result stream's parser
+// ask for Layout::Mirrored, and the per-statement parsers (DML, RETURNING,
+// simple queries) keep the default Layout::Flat, a plain heap buffer that
+// compacts lazily, in PrepareWrite, exactly as the vectors did. Their results
+// are a handful of packets, so the compaction they can hit is small.
+//
+// Without memfd (Windows, macOS, old kernels) a mirrored ring falls back to
+// the flat layout, so failure to map is never an error.
+//
+// Pointers from Data() stay valid across Consume() and are invalidated only by
+// the next PrepareWrite()/Append(). Both callers rely on this: a packet or row
+// view is handed out, consumed, and read before more bytes are received.
+//
+// Deliberately a self-contained header, like copy/load_policy.hpp:
+// -I src/include is the whole build recipe for test/cpp/test_ring_buffer.cpp.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+namespace tds {
+
+class RingBuffer {
+public:
+	//! Smallest ring; also the growth granularity's floor. A multiple of every page size in use.
+	static constexpr size_t MIN_CAPACITY = 64 * 1024;
+
+	enum class Layout : uint8_t {
+		Flat,	  //!< Heap buffer, compacts lazily; cheap to create and destroy
+		Mirrored  //!< memfd mapped twice; never compacts (flat where unavailable)
+	};
+
+	explicit RingBuffer(Layout layout = Layout::Flat) : layout_(layout) {}
+	~RingBuffer() {
+		Release();
+	}
+
+	RingBuffer(const RingBuffer &) = delete;
+	RingBuffer &operator=(const RingBuffer &) = delete;
+
+	RingBuffer(RingBuffer &&other) noexcept {
+		Take(other);
+	}
+	RingBuffer &operator=(RingBuffer &&other) noexcept {
+		if (this != &other) {
+			Release();
+			Take(other);
+		}
+		return *this;
+	}
+
+	//! The live bytes, contiguous. Valid until the next PrepareWrite()/Append().
+	const uint8_t *Data() const {
+		return base_ + head_;
+	}
+	size_t Size() const {
+		return size_;
+	}
+	bool Empty() const {
+		return size_ == 0;
+	}
+	size_t Capacity() const {
+		return capacity_;
+	}
+	Layout GetLayout() const {
+		return layout_;
+	}
+	//! True when the double mapping is in place (no compaction copies at all)
+	bool IsMirrored() const {
+		return mirrored_;
+	}
+
+	//! Grow so that at least `capacity` bytes fit. Live bytes are kept.
+	void Reserve(size_t capacity) {
+		if (capacity > capacity_) {
+			Grow(capacity);
+		}
+	}
+
+	//! Contiguous room for at least `min_room` bytes after the live ones.
+	//! Follow with CommitWrite() of however many were actually written.
+	uint8_t *PrepareWrite(size_t min_room) {
+		if (capacity_ - size_ < min_room) {
+			Grow(size_ + min_room);
+		} else if (!mirrored_ && capacity_ - head_ - size_ < min_room) {
+			// Flat fallback: the one place bytes are moved to keep them contiguous
+			std::memmove(base_, base_ + head_, size_);
+			head_ = 0;
+		}
+		return base_ + head_ + size_;
+	}
+	void CommitWrite(size_t count) {
+		size_ += count;
+	}
+
+	void Append(const uint8_t *data, size_t length) {
+		if (length == 0) {
+			return;
+		}
+		std::memcpy(PrepareWrite(length), data, length);
+		CommitWrite(length);
+	}
+
+	//! Drop `count` bytes from the front. O(1); nothing is moved or overwritten.
+	void Consume(size_t count) {
+		if (count >= size_) {
+			head_ = 0;
+			size_ = 0;
+			return;
+		}
+		head_ += count;
+		size_ -= count;
+		if (mirrored_ && head_ >= capacity_) {
+			head_ -= capacity_;
+		}
+	}
+
+	//! Drop everything, keeping the allocation
+	void Clear() {
+		head_ = 0;
+		size_ = 0;
+	}
+
+private:
+	uint8_t *base_ = nullptr;
+	size_t capacity_ = 0;
+	size_t head_ = 0;
+	size_t size_ = 0;
+	Layout layout_ = Layout::Flat;
+	bool mirrored_ = false;
+
+	void Take(RingBuffer &other) {
+		layout_ = other.layout_;
+		base_ = other.base_;
+		capacity_ = other.capacity_;
+		head_ = other.head_;
+		size_ = other.size_;
+		mirrored_ = other.mirrored_;
+		other.base_ = nullptr;
+		other.capacity_ = 0;
+		other.head_ = 0;
+		other.size_ = 0;
+		other.mirrored_ = false;
+	}
+
+	void Grow(size_t needed) {
+		size_t capacity = capacity_ < MIN_CAPACITY ? MIN_CAPACITY : capacity_;
+		while (capacity < needed) {
+			capacity *= 2;
+		}
+		uint8_t *base = layout_ == Layout::Mirrored ? MapMirrored(capacity) : nullptr;
+		bool mirrored = base != nullptr;
+		if (!base) {
+			mirrored = false;
+			base = new uint8_t[capacity];
+		}
+		if (size_ > 0) {
+			std::memcpy(base, Data(), size_);
+		}
+		Release();
+		base_ = base;
+		capacity_ = capacity;
+		head_ = 0;
+		mirrored_ = mirrored;
+	}
+
+	//! Frees the allocation only; head_ and size_ are the caller's business
+	void Release() {
+		if (!base_) {
+			return;
+		}
+		if (mirrored_) {
+#if defined(__linux__)
+			munmap(base_, capacity_ * 2);
+#endif
+		} else {
+			delete[] base_;
+		}
+		base_ = nullptr;
+		capacity_ = 0;
+	}
+
+	//! Two views of one memfd, adjacent. nullptr whenever any step fails; the
+	//! caller then falls back to a flat buffer, so failure is never an error.
+	static uint8_t *MapMirrored(size_t capacity) {
+#if defined(__linux__) && defined(SYS_memfd_create)
+		// Through syscall(): the memfd_create() wrapper is glibc 2.27+, and the
+		// extension is built against older glibc too.
+		const unsigned int cloexec = 0x0001U;  // MFD_CLOEXEC
+		int fd = static_cast<int>(syscall(SYS_memfd_create, "mssql_ring", cloexec));
+		if (fd < 0) {
+			return nullptr;
+		}
+		if (ftruncate(fd, static_cast<off_t>(capacity)) != 0) {
+			close(fd);
+			return nullptr;
+		}
+		// Reserve both halves first so the two MAP_FIXED views cannot land on
+		// anything else's memory.
+		void *area = mmap(nullptr, capacity * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (area == MAP_FAILED) {
+			close(fd);
+			return nullptr;
+		}
+		auto *base = static_cast<uint8_t *>(area);
+		const int prot = PROT_READ | PROT_WRITE;
+		bool mapped = mmap(base, capacity, prot, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+					  mmap(base + capacity, capacity, prot, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+		// The mappings hold the memory; the descriptor is not needed any more
+		close(fd);
+		if (!mapped) {
+			munmap(area, capacity * 2);
+			return nullptr;
+		}
+		return base;
+#else
+		(void)capacity;
+		return nullptr;
+#endif
+	}
+};
+
+}  // namespace tds
+}  // namespace duckdb
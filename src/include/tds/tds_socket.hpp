@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include "tds/tds_platform.hpp"
+#include "tds/tds_ring_buffer.hpp"
 #include "tds/tls/tds_tls_context.hpp"
 #include "tds_packet.hpp"
 #include "tds_types.hpp"
@@ -48,6 +49,19 @@ public:
 	// Get TLS information (only valid when TLS is enabled)
 	std::string GetTlsCipherSuite() const;
 	std::string GetTlsVersion() const;
+	// True when the handshake resumed a session from an earlier connection to
+	// the same host, port and SNI name
+	bool IsTlsSessionReused() const;
+
+	// Linux kernel TLS: after EnableTls, move record decryption (and, where the
+	// kernel allows, encryption) into the socket, so Receive() goes back to a
+	// plain recv() into the caller's buffer. Best effort: returns false and
+	// keeps OpenSSL in charge when the kernel, TLS version or cipher rules it
+	// out (GetLastError says which).
+	bool EnableKernelTls();
+	// Whether the kernel decrypts / encrypts this socket's records
+	bool IsKernelTlsRx() const;
+	bool IsKernelTlsTx() const;
 
 	// Data transfer
 	bool Send(const uint8_t *data, size_t length);
@@ -65,7 +79,9 @@ public:
 	//! View of the next packet's PAYLOAD, valid until the next receive call on
 	//! this socket. Lets the streaming read path skip the copy into
 	//! TdsPacket::payload_, which it immediately copied again.
-	bool ReceivePayloadView(const uint8_t *&payload, size_t &payload_length, int timeout_ms);
+	//! `end_of_message`, when given, reports the packet's EOM status bit.
+	bool ReceivePayloadView(const uint8_t *&payload, size_t &payload_length, int timeout_ms,
+							bool *end_of_message = nullptr);
 
 	// Receive all packets until EOM (End Of Message)
 	// Returns accumulated payload from all packets
@@ -87,10 +103,16 @@ public:
 		return last_error_;
 	}
 
+	//! True once a malformed frame has been received. The stream cannot be
+	//! resynchronised, so every later receive fails the same way; callers that
+	//! retry on timeout must stop on this. Reset by Connect().
+	bool HasFramingError() const {
+		return framing_error_;
+	}
+
 	// Clear receive buffer (useful before starting a new query)
 	void ClearReceiveBuffer() {
-		receive_len_ = 0;
-		receive_pos_ = 0;
+		receive_buffer_.Clear();
 	}
 
 	// Spec 055: size the receive staging buffer from the negotiated frame size.
@@ -110,25 +132,25 @@ private:
 	bool connected_;		  // Connection status
 	std::string last_error_;  // Last error message
 
+	//! Set when the peer sent a frame that can never be read past. The socket
+	//! itself stays connected, so IsConnected() cannot tell this apart from a
+	//! read that merely timed out.
+	bool framing_error_ = false;
+
 	// TLS context for encrypted connections (null when TLS is not enabled)
 	std::unique_ptr<TlsTdsContext> tls_context_;
 
 	// Internal receive buffer for partial packet handling.
 	//
-	// Its vector SIZE is capacity, not content — `receive_len_` says how much is
-	// valid and `receive_pos_` how much has been consumed. Letting the vector's
-	// own size track the content would mean resize() before every recv(), and
-	// resize() value-initialises the bytes the recv() is about to overwrite:
-	// a whole extra pass over the read buffer, every read, for nothing.
-	//
-	// A completed packet only advances the cursor; the tail is compacted to the
-	// front once, when the cursor has caught up with the end (spec 055).
-	std::vector<uint8_t> receive_buffer_;
-	size_t receive_len_ = 0;
-	size_t receive_pos_ = 0;
+	// recv() writes straight into its tail (PrepareWrite hands back raw room, so
+	// nothing value-initialises bytes the read is about to overwrite) and a
+	// completed packet is Consume()d. As a mirrored ring, a frame straddling the
+	// wrap is still one contiguous span, so the straddling tail is never
+	// memmoved to the front before the next read.
+	RingBuffer receive_buffer_ {RingBuffer::Layout::Mirrored};
 
 	//! Bytes per recv(). Not a buffer: reads go straight into the tail of
-	//! receive_buffer_, which SetReceiveFraming sizes to hold one read plus a
+	//! receive_buffer_, which SetReceiveFraming reserves to hold one read plus a
 	//! straddling frame.
 	size_t recv_read_size_ = TDS_DEFAULT_PACKET_SIZE;
 
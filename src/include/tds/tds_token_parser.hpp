@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include "tds_column_metadata.hpp"
+#include "tds_ring_buffer.hpp"
 #include "tds_types.hpp"
 
 namespace duckdb {
@@ -74,6 +75,24 @@ struct DoneToken {
 	}
 };
 
+//===----------------------------------------------------------------------===//
+// ReturnValueToken - OUTPUT parameter value from RETURNVALUE token
+//
+// Only integer OUTPUT parameters are decoded: the one this client requests is
+// the statement handle sp_prepexec returns. Any other type is skipped by its
+// TYPE_INFO and reported with decoded = false; whether that is an error is up
+// to the reader that asked for the parameter (TdsConnection::OnReturnValue).
+//===----------------------------------------------------------------------===//
+
+struct ReturnValueToken {
+	uint16_t ordinal = 0;	 // Parameter position in the RPC call
+	std::string name;		 // Parameter name (empty when passed positionally)
+	uint8_t type_id = 0;	 // TDS type of the value
+	bool decoded = false;	 // Integer value read; false when skipped
+	bool is_null = true;	 // NULL value
+	int64_t int_value = 0;	 // Value when decoded && !is_null
+};
+
 //===----------------------------------------------------------------------===//
 // RowData - Raw row values from ROW token
 //===----------------------------------------------------------------------===//
@@ -129,12 +148,15 @@ enum class ParsedTokenType : uint8_t {
 	Error,		  // ERROR token parsed
 	Info,		  // INFO token parsed
 	EnvChange,	  // ENVCHANGE consumed (no data exposed)
+	ReturnValue,  // RETURNVALUE parsed (OUTPUT parameter available)
 	NeedMoreData  // Incomplete token, need more data
 };
 
 class TokenParser {
 public:
-	TokenParser();
+	//! Per-statement parsers keep the default flat buffer; a parser that lives
+	//! for a whole result stream asks for the mirrored ring (see tds_ring_buffer.hpp).
+	explicit TokenParser(RingBuffer::Layout layout = RingBuffer::Layout::Flat);
 	~TokenParser() = default;
 
 	// Feed data into the parser buffer
@@ -161,6 +183,9 @@ public:
 	const DoneToken &GetDone() const {
 		return current_done_;
 	}
+	const ReturnValueToken &GetReturnValue() const {
+		return current_return_value_;
+	}
 
 	// State queries
 	ParserState GetState() const {
@@ -209,7 +234,8 @@ public:
 	//! Wire bytes of the row last returned as ParsedTokenType::Row, valid until
 	//! the next TryParseNext() call (which is when the bytes are consumed).
 	const uint8_t *GetRawRow() const {
-		return buffer_.data() + raw_row_offset_;
+		// The row is still at the front of the buffer, after its token byte
+		return buffer_.Data() + 1;
 	}
 	size_t GetRawRowLength() const {
 		return raw_row_length_;
@@ -234,37 +260,34 @@ private:
 	bool ParseError();
 	bool ParseInfo();
 	bool ParseEnvChange();
+	bool ParseReturnValue();
 
 	// Buffer management
 	void ConsumeBytes(size_t count);
 	size_t Available() const {
-		return buffer_.size() - buffer_pos_;
+		return buffer_.Size();
 	}
 	const uint8_t *Current() const {
-		return buffer_.data() + buffer_pos_;
+		return buffer_.Data();
 	}
 
-	// Compact buffer if needed
-	void CompactBuffer();
-
 	// State
 	ParserState state_;
 	std::string parse_error_;
 	bool skip_rows_ = false;  // Skip ROW content during drain
 
 	//! Raw-row mode state. The consume of a raw row is DEFERRED to the next
-	//! TryParseNext() rather than done inside ParseRow: ConsumeBytes compacts the
-	//! buffer, which erases from the front and would invalidate the pointer we
-	//! just handed the caller.
+	//! TryParseNext() rather than done inside ParseRow, so the row stays at the
+	//! front of the buffer where GetRawRow() points.
 	bool raw_row_mode_ = false;
-	size_t raw_row_offset_ = 0;
 	size_t raw_row_length_ = 0;
 	bool raw_row_nbc_ = false;
 	size_t pending_consume_ = 0;
 
-	// Buffer
-	std::vector<uint8_t> buffer_;
-	size_t buffer_pos_;
+	//! Unconsumed token bytes. When mirrored, a row or PLP chunk that straddles
+	//! packets is one contiguous span without compaction copies; it only grows
+	//! (and copies) for a row larger than the whole ring.
+	RingBuffer buffer_;
 
 	// Parsed data
 	std::vector<ColumnMetadata> columns_;
@@ -276,6 +299,7 @@ private:
 	TdsError current_error_;
 	TdsInfo current_info_;
 	DoneToken current_done_;
+	ReturnValueToken current_return_value_;
 };
 
 // Scan a server response (e.g. a BEGIN TRANSACTION reply) for the ENVCHANGE
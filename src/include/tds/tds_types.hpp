@@ -180,6 +180,9 @@ constexpr uint8_t TDS_TYPE_TIME = 0x29;
 constexpr uint8_t TDS_TYPE_DATETIME2 = 0x2A;
 constexpr uint8_t TDS_TYPE_DATETIMEOFFSET = 0x2B;
 
+// Table-valued parameter (RPC requests only, never in a result set)
+constexpr uint8_t TDS_TYPE_TVP = 0xF3;
+
 // Unsupported types (will fail with clear error)
 constexpr uint8_t TDS_TYPE_XML = 0xF1;
 constexpr uint8_t TDS_TYPE_UDT = 0xF0;	// Also GEOGRAPHY, GEOMETRY, HIERARCHYID
@@ -76,6 +76,10 @@ public:
 	// Clear custom I/O callbacks (reverts to direct socket I/O)
 	void ClearBioCallbacks();
 
+	// Offer and store resumable sessions under `key` (see TlsImpl)
+	// Must be called before Handshake
+	void SetSessionCacheKey(const std::string &key);
+
 	// Perform TLS handshake
 	// timeout_ms: maximum time to wait for handshake completion
 	// Returns true on success, false on failure (check GetLastError)
@@ -108,6 +112,16 @@ public:
 	// Get TLS version string (for logging)
 	std::string GetTlsVersion() const;
 
+	// Check if the handshake resumed a cached session
+	bool IsSessionReused() const;
+
+	// Hand the record layer to the kernel after Handshake (Linux kTLS, see
+	// TlsImpl). Returns false, with GetLastError set, when it stays in OpenSSL
+	bool EnableKernelTls();
+	// Directions the kernel now handles; the caller does plain socket I/O there
+	bool IsKernelTlsRx() const;
+	bool IsKernelTlsTx() const;
+
 private:
 	// PIMPL - hides mbedTLS types from header
 	std::unique_ptr<TlsTdsContextImpl> impl_;
@@ -60,9 +60,26 @@ public:
 	// Clear custom I/O callbacks (reverts to direct socket I/O)
 	void ClearBioCallbacks();
 
+	// Join the process-wide session cache under `key` (server and SNI): the
+	// handshake offers the session last stored there, and sessions the server
+	// issues are stored back. Call before Handshake(); empty = no resumption.
+	void SetSessionCacheKey(const std::string &key);
+
 	// Perform TLS handshake
 	bool Handshake(int timeout_ms = 30000);
 
+	// True when the last handshake resumed a cached session
+	bool IsSessionReused() const;
+
+	// Linux: move the record layer into the socket (kernel TLS) after
+	// Handshake(). TLS 1.2 with AES-GCM only. Returns false, and leaves OpenSSL
+	// in charge, when the kernel, the protocol version or the cipher does not
+	// allow it. On success the caller must do plain send()/recv() for every
+	// direction reported by IsKernelTlsRx()/IsKernelTlsTx().
+	bool EnableKernelTls();
+	bool IsKernelTlsRx() const;
+	bool IsKernelTlsTx() const;
+
 	// Send data over TLS
 	ssize_t Send(const uint8_t *data, size_t length);
 
@@ -1,8 +1,11 @@
 #include "mssql_functions.hpp"
+#include <cctype>
 #include <chrono>
 #include <climits>
 #include <cstdlib>
+#include <unordered_map>
 #include "catalog/mssql_catalog.hpp"
+#include "catalog/mssql_column_info.hpp"
 #include "connection/mssql_connection_provider.hpp"
 #include "connection/mssql_settings.hpp"
 #include "duckdb/common/exception.hpp"
@@ -16,6 +19,10 @@
 #include "mssql_storage.hpp"
 #include "query/mssql_query_executor.hpp"
 #include "query/mssql_simple_query.hpp"
+#include "table_scan/filter_encoder.hpp"
+#include "table_scan/scan_range_policy.hpp"
+#include "table_scan/table_scan.hpp"
+#include "tds/encoding/type_converter.hpp"
 #include "tds/tds_connection.hpp"
 
 // Debug logging controlled by MSSQL_DEBUG environment variable
@@ -47,6 +54,9 @@ unique_ptr<FunctionData> MSSQLScanBindData::Copy() const {
 	result->return_types = return_types;
 	result->column_names = column_names;
 	result->result_stream_id = result_stream_id;
+	result->range_queries = range_queries;
+	result->described = described;
+	result->pushed_down = pushed_down;
 	return std::move(result);
 }
 
@@ -70,8 +80,428 @@ MSSQLScanGlobalState::~MSSQLScanGlobalState() {
 }
 
 idx_t MSSQLScanGlobalState::MaxThreads() const {
-	// Single-threaded streaming
-	return 1;
+	// Single-threaded streaming, unless the scan was split into ranges - then
+	// one thread per range (up to max_streams), each on its own connection
+	if (range_queries.empty()) {
+		return 1;
+	}
+	if (max_streams > 0 && max_streams < range_queries.size()) {
+		return max_streams;
+	}
+	return range_queries.size();
+}
+
+//===----------------------------------------------------------------------===//
+// Partitioned mssql_scan
+//
+// mssql_scan(ctx, query, partition_column := 'id', partitions := 16) runs the
+// query as 16 bounded subqueries over one of its result columns, each drained
+// on its own pooled connection:
+//
+//   SELECT * FROM (<query>) AS [mssql_scan_partition] WHERE <range predicate>
+//
+// The ranges come from MIN/MAX of the column (integer columns), or verbatim from
+// partition_bounds := [...] (any type SQL Server compares in the same order).
+// The range predicates are scan_range_policy.hpp's, so the outer ranges are open
+// and NULLs land in the first one, as for the catalog scan's key ranges.
+//===----------------------------------------------------------------------===//
+
+struct MSSQLScanPartitioning {
+	string column;
+	int64_t partitions = 0;	 // 0 = one range per DuckDB thread
+	vector<Value> bounds;	 // Explicit interior bounds, strictly ascending
+};
+
+static MSSQLScanPartitioning ParseScanPartitioning(const named_parameter_map_t &named_parameters) {
+	MSSQLScanPartitioning result;
+	bool have_partitions = false;
+	for (const auto &kv : named_parameters) {
+		if (kv.second.IsNull()) {
+			throw InvalidInputException("MSSQL Error: mssql_scan parameter '%s' cannot be NULL", kv.first);
+		}
+		if (kv.first == "partition_column") {
+			result.column = kv.second.GetValue<string>();
+		} else if (kv.first == "partitions") {
+			result.partitions = kv.second.GetValue<int64_t>();
+			have_partitions = true;
+			if (result.partitions < 1) {
+				throw InvalidInputException("MSSQL Error: mssql_scan partitions must be >= 1, got %lld",
+											(long long)result.partitions);
+			}
+		} else if (kv.first == "partition_bounds") {
+			if (kv.second.type().id() != LogicalTypeId::LIST) {
+				throw InvalidInputException("MSSQL Error: mssql_scan partition_bounds must be a list, e.g. [100, 200]");
+			}
+			result.bounds = ListValue::GetChildren(kv.second);
+		}
+	}
+	if (result.column.empty()) {
+		if (have_partitions || !result.bounds.empty()) {
+			throw InvalidInputException(
+				"MSSQL Error: mssql_scan partitions / partition_bounds require partition_column");
+		}
+		return result;
+	}
+	for (idx_t i = 0; i < result.bounds.size(); i++) {
+		if (result.bounds[i].IsNull()) {
+			throw InvalidInputException("MSSQL Error: mssql_scan partition_bounds cannot contain NULL");
+		}
+		if (i > 0 && !(result.bounds[i - 1] < result.bounds[i])) {
+			throw InvalidInputException("MSSQL Error: mssql_scan partition_bounds must be strictly ascending");
+		}
+	}
+	if (have_partitions && !result.bounds.empty() &&
+		static_cast<idx_t>(result.partitions) != result.bounds.size() + 1) {
+		throw InvalidInputException(
+			"MSSQL Error: mssql_scan got %llu partition_bounds, which make %llu partitions, not %lld",
+			(unsigned long long)result.bounds.size(), (unsigned long long)result.bounds.size() + 1,
+			(long long)result.partitions);
+	}
+	return result;
+}
+
+// The query becomes a derived table, where a trailing ';' is a syntax error.
+static string StripStatementTerminators(const string &query) {
+	auto end = query.size();
+	while (end > 0 && (std::isspace(static_cast<unsigned char>(query[end - 1])) || query[end - 1] == ';')) {
+		end--;
+	}
+	return query.substr(0, end);
+}
+
+static bool IsSQLWordChar(char c) {
+	return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '@' || c == '#' || c == '$';
+}
+
+// True when the query has an ORDER BY outside any parentheses, i.e. one that
+// orders the final result. Without TOP/OFFSET it is a syntax error in a derived
+// table; with them the wrap is legal but the ranges would lose the order the
+// query asked for. Literals, quoted identifiers and comments are skipped.
+static bool HasTopLevelOrderBy(const string &query) {
+	const idx_t size = query.size();
+	idx_t depth = 0;
+	bool after_order = false;
+	idx_t i = 0;
+	while (i < size) {
+		const char c = query[i];
+		const char next = i + 1 < size ? query[i + 1] : '\0';
+		if (c == '\'' || c == '"' || c == '[') {
+			const char close = c == '[' ? ']' : c;
+			i++;
+			while (i < size) {
+				if (query[i] == close) {
+					// A doubled closing character is an escaped one
+					if (i + 1 < size && query[i + 1] == close) {
+						i += 2;
+						continue;
+					}
+					break;
+				}
+				i++;
+			}
+			i++;
+			after_order = false;
+		} else if (c == '-' && next == '-') {
+			while (i < size && query[i] != '\n') {
+				i++;
+			}
+		} else if (c == '/' && next == '*') {
+			// T-SQL block comments nest
+			idx_t nesting = 0;
+			do {
+				if (query[i] == '/' && i + 1 < size && query[i + 1] == '*') {
+					nesting++;
+					i += 2;
+				} else if (query[i] == '*' && i + 1 < size && query[i + 1] == '/') {
+					nesting--;
+					i += 2;
+				} else {
+					i++;
+				}
+			} while (i < size && nesting > 0);
+		} else if (IsSQLWordChar(c)) {
+			const idx_t start = i;
+			while (i < size && IsSQLWordChar(query[i])) {
+				i++;
+			}
+			if (depth > 0) {
+				continue;
+			}
+			const string word = StringUtil::Upper(query.substr(start, i - start));
+			if (after_order && word == "BY") {
+				return true;
+			}
+			after_order = word == "ORDER";
+		} else {
+			if (c == '(') {
+				depth++;
+			} else if (c == ')' && depth > 0) {
+				depth--;
+			}
+			if (!std::isspace(static_cast<unsigned char>(c))) {
+				after_order = false;
+			}
+			i++;
+		}
+	}
+	return false;
+}
+
+// MIN/MAX of the partitioning column over the whole query result. Returns false
+// when the result is empty (nothing to split). A non-integer column fails the
+// BIGINT cast on the server; that error names partition_bounds as the way out.
+static bool DiscoverPartitionColumnBounds(ClientContext &context, MSSQLCatalog &mssql_catalog, const string &body,
+										  const string &quoted_column, int64_t &min_key, int64_t &max_key) {
+	const string sql = "SELECT CAST(MIN(" + quoted_column + ") AS BIGINT), CAST(MAX(" + quoted_column +
+					   ") AS BIGINT) FROM (" + body + ") AS [mssql_scan_partition]";
+	auto &pool = mssql_catalog.GetConnectionPool();
+	auto connection = pool.Acquire(LoadPoolConfig(context).acquire_timeout * 1000);
+	if (!connection) {
+		throw IOException("MSSQL Error: no connection to compute the partition_column range of mssql_scan");
+	}
+	SimpleQueryResult bounds;
+	try {
+		bounds = MSSQLSimpleQuery::Execute(*connection, sql);
+	} catch (...) {
+		pool.Release(std::move(connection));
+		throw;
+	}
+	pool.Release(std::move(connection));
+	if (bounds.HasError()) {
+		throw InvalidInputException("MSSQL Error: cannot compute MIN/MAX of partition_column %s: %s (a non-integer "
+									"column needs explicit partition_bounds)",
+									quoted_column, bounds.error_message);
+	}
+	if (!bounds.HasRows() || bounds.rows[0].size() < 2 || bounds.rows[0][0].empty() || bounds.rows[0][1].empty()) {
+		return false;
+	}
+	try {
+		min_key = std::stoll(bounds.rows[0][0]);
+		max_key = std::stoll(bounds.rows[0][1]);
+	} catch (...) {
+		return false;
+	}
+	return max_key >= min_key;
+}
+
+// One query per range (empty = run the query as one stream). Runs at bind, on
+// the client thread. An explicit transaction keeps the scan on its pinned
+// connection: the other connections would not see its uncommitted writes. A
+// top-level ORDER BY also keeps the single stream (see HasTopLevelOrderBy).
+//
+// Without partition_bounds this sends the MIN/MAX probe at bind, before and
+// independently of mssql_scan_describe_bind: the range boundaries are part of
+// the bind data. Describe-bind saves the parked first range, not this query.
+static vector<string> PlanScanPartitions(ClientContext &context, const MSSQLScanBindData &bind_data,
+										 const MSSQLScanPartitioning &partitioning) {
+	vector<string> queries;
+	if (partitioning.column.empty() || partitioning.partitions == 1) {
+		return queries;
+	}
+	auto &mssql_catalog = Catalog::GetCatalog(context, Identifier(bind_data.context_name)).Cast<MSSQLCatalog>();
+	if (ConnectionProvider::IsInTransaction(context, mssql_catalog)) {
+		MSSQL_FN_DEBUG_LOG(1, "PlanScanPartitions: explicit transaction - single stream on the pinned connection");
+		return queries;
+	}
+	if (HasTopLevelOrderBy(bind_data.query)) {
+		MSSQL_FN_DEBUG_LOG(1, "PlanScanPartitions: top-level ORDER BY - single stream");
+		return queries;
+	}
+
+	const string body = StripStatementTerminators(bind_data.query);
+	const string quoted_column = "[" + mssql::FilterEncoder::EscapeBracketIdentifier(partitioning.column) + "]";
+	vector<string> bound_literals;
+	if (!partitioning.bounds.empty()) {
+		for (const auto &bound : partitioning.bounds) {
+			bound_literals.push_back(mssql::FilterEncoder::ValueToSQLLiteral(bound, bound.type()));
+		}
+	} else {
+		int64_t min_key = 0;
+		int64_t max_key = 0;
+		if (!DiscoverPartitionColumnBounds(context, mssql_catalog, body, quoted_column, min_key, max_key)) {
+			MSSQL_FN_DEBUG_LOG(1, "PlanScanPartitions: %s has no values - single stream", quoted_column.c_str());
+			return queries;
+		}
+		uint64_t ranges = static_cast<uint64_t>(partitioning.partitions);
+		if (ranges == 0) {
+			const auto thread_count = static_cast<uint64_t>(context.db->NumberOfThreads());
+			ranges = thread_count < MSSQL_MAX_SCAN_RANGES ? thread_count : MSSQL_MAX_SCAN_RANGES;
+		}
+		for (const auto bound : MSSQLSplitKeyRange(min_key, max_key, ranges)) {
+			bound_literals.push_back(std::to_string(bound));
+		}
+	}
+
+	for (const auto &predicate : MSSQLBuildRangePredicates(quoted_column, bound_literals)) {
+		queries.push_back("SELECT * FROM (" + body + ") AS [mssql_scan_partition] WHERE " + predicate);
+	}
+	if (queries.size() < 2) {
+		queries.clear();
+	}
+	MSSQL_FN_DEBUG_LOG(1, "PlanScanPartitions: %zu ranges on %s", queries.size(), quoted_column.c_str());
+	return queries;
+}
+
+//===----------------------------------------------------------------------===//
+// Metadata-only bind (mssql_scan_describe_bind)
+//
+// sp_describe_first_result_set compiles the batch without running it and
+// reports the first result set's columns, so the query is sent once, at
+// InitGlobal, instead of being started at bind and parked with its connection
+// (and whatever locks it took) until execution. Batches the server cannot
+// describe statically — temp tables created in the batch, dynamic SQL — and
+// types the result stream cannot decode fall back to the executing bind.
+//===----------------------------------------------------------------------===//
+
+// The type the result stream will report for a described column. It must be
+// the stream's own mapping (TypeConverter, keyed by the TDS type on the wire)
+// and not the catalog's: the catalog maps datetime2 by scale to TIMESTAMP_S,
+// _MS or _NS, while the stream decodes every datetime2 as TIMESTAMP, and
+// CheckDescribedShape rejects any difference at execution. False for types the
+// stream does not decode (geometry, hierarchyid, sql_variant, ...).
+static bool DescribedStreamType(const string &type_name, uint8_t precision, uint8_t scale, LogicalType &out) {
+	static const std::unordered_map<string, uint8_t> WIRE_TYPES = {
+		{"bit", tds::TDS_TYPE_BIT},
+		{"tinyint", tds::TDS_TYPE_TINYINT},
+		{"smallint", tds::TDS_TYPE_SMALLINT},
+		{"int", tds::TDS_TYPE_INT},
+		{"bigint", tds::TDS_TYPE_BIGINT},
+		{"real", tds::TDS_TYPE_REAL},
+		{"float", tds::TDS_TYPE_FLOAT},
+		{"decimal", tds::TDS_TYPE_DECIMAL},
+		{"numeric", tds::TDS_TYPE_NUMERIC},
+		{"money", tds::TDS_TYPE_MONEY},
+		{"smallmoney", tds::TDS_TYPE_SMALLMONEY},
+		{"char", tds::TDS_TYPE_BIGCHAR},
+		{"varchar", tds::TDS_TYPE_BIGVARCHAR},
+		{"nchar", tds::TDS_TYPE_NCHAR},
+		{"nvarchar", tds::TDS_TYPE_NVARCHAR},
+		{"text", tds::TDS_TYPE_TEXT},
+		{"ntext", tds::TDS_TYPE_NTEXT},
+		{"binary", tds::TDS_TYPE_BIGBINARY},
+		{"varbinary", tds::TDS_TYPE_BIGVARBINARY},
+		{"image", tds::TDS_TYPE_IMAGE},
+		{"date", tds::TDS_TYPE_DATE},
+		{"time", tds::TDS_TYPE_TIME},
+		{"datetime", tds::TDS_TYPE_DATETIME},
+		{"smalldatetime", tds::TDS_TYPE_SMALLDATETIME},
+		{"datetime2", tds::TDS_TYPE_DATETIME2},
+		{"datetimeoffset", tds::TDS_TYPE_DATETIMEOFFSET},
+		{"uniqueidentifier", tds::TDS_TYPE_UNIQUEIDENTIFIER},
+		{"xml", tds::TDS_TYPE_XML},
+	};
+	auto it = WIRE_TYPES.find(StringUtil::Lower(type_name));
+	if (it == WIRE_TYPES.end()) {
+		return false;
+	}
+	tds::ColumnMetadata column;
+	column.type_id = it->second;
+	column.max_length = 0;	// only read for the nullable INTN/FLOATN/MONEYN forms, not used here
+	column.precision = precision;
+	column.scale = scale;
+	column.collation = 0;
+	column.flags = 0;
+	out = tds::encoding::TypeConverter::GetDuckDBType(column);
+	return true;
+}
+
+static idx_t DescribeColumnIndex(const SimpleQueryResult &result, const char *name) {
+	for (idx_t i = 0; i < result.column_names.size(); i++) {
+		if (StringUtil::CIEquals(result.column_names[i], name)) {
+			return i;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+static bool DescribeScanQuery(ClientContext &context, MSSQLCatalog &mssql_catalog, const string &query,
+							  MSSQLCatalog::DescribedResult &out) {
+	if (mssql_catalog.TryGetDescribedResult(query, out)) {
+		MSSQL_FN_DEBUG_LOG(1, "DescribeScanQuery: cached shape, %zu columns", out.types.size());
+		return true;
+	}
+
+	const string sql = "EXEC sp_describe_first_result_set @tsql = N'" + StringUtil::Replace(query, "'", "''") + "'";
+	auto connection = ConnectionProvider::GetConnection(context, mssql_catalog);
+	if (!connection) {
+		return false;
+	}
+	SimpleQueryResult described;
+	try {
+		described = MSSQLSimpleQuery::Execute(*connection, sql);
+	} catch (...) {
+		ConnectionProvider::ReleaseConnection(context, mssql_catalog, std::move(connection));
+		throw;
+	}
+	ConnectionProvider::ReleaseConnection(context, mssql_catalog, std::move(connection));
+	if (described.HasError() || !described.HasRows()) {
+		MSSQL_FN_DEBUG_LOG(1, "DescribeScanQuery: not describable (%s) - executing bind",
+						   described.HasError() ? described.error_message.c_str() : "no result set");
+		return false;
+	}
+
+	const idx_t hidden_idx = DescribeColumnIndex(described, "is_hidden");
+	const idx_t name_idx = DescribeColumnIndex(described, "name");
+	const idx_t type_idx = DescribeColumnIndex(described, "system_type_name");
+	const idx_t precision_idx = DescribeColumnIndex(described, "precision");
+	const idx_t scale_idx = DescribeColumnIndex(described, "scale");
+	if (name_idx == DConstants::INVALID_INDEX || type_idx == DConstants::INVALID_INDEX ||
+		precision_idx == DConstants::INVALID_INDEX ||
+		scale_idx == DConstants::INVALID_INDEX) {
+		return false;
+	}
+
+	MSSQLCatalog::DescribedResult result;
+	try {
+		for (const auto &row : described.rows) {
+			if (row.size() < described.column_names.size()) {
+				return false;
+			}
+			if (hidden_idx != DConstants::INVALID_INDEX && row[hidden_idx] == "1") {
+				continue;  // Browse-mode key column, not part of the result
+			}
+			// system_type_name carries the length/precision suffix: nvarchar(50)
+			string type_name = row[type_idx];
+			const auto paren = type_name.find('(');
+			if (paren != string::npos) {
+				type_name = type_name.substr(0, paren);
+			}
+			LogicalType type;
+			if (!DescribedStreamType(type_name, static_cast<uint8_t>(std::stoi(row[precision_idx])),
+									 static_cast<uint8_t>(std::stoi(row[scale_idx])), type)) {
+				MSSQL_FN_DEBUG_LOG(1, "DescribeScanQuery: unmapped type '%s' - executing bind", type_name.c_str());
+				return false;
+			}
+			result.types.push_back(std::move(type));
+			result.names.push_back(row[name_idx]);
+		}
+	} catch (const std::logic_error &) {
+		return false;  // Non-numeric length/precision/scale: not a shape we can trust
+	}
+	if (result.types.empty()) {
+		return false;
+	}
+	out = result;
+	mssql_catalog.CacheDescribedResult(query, std::move(result));
+	MSSQL_FN_DEBUG_LOG(1, "DescribeScanQuery: described %zu columns", out.types.size());
+	return true;
+}
+
+// A query bound from its described shape must produce exactly that shape: the
+// DuckDB plan was built on it. The cached entry is dropped, so re-running the
+// query describes it afresh.
+static void CheckDescribedShape(MSSQLCatalog &mssql_catalog, const MSSQLScanBindData &bind_data,
+								const MSSQLResultStream &stream) {
+	if (stream.GetColumnTypes() == bind_data.return_types) {
+		return;
+	}
+	mssql_catalog.ForgetDescribedResult(bind_data.query);
+	throw InvalidInputException("MSSQL Error: mssql_scan result columns changed between bind and execution "
+								"(described %llu, got %llu, or different types). Re-run the query, or SET "
+								"mssql_scan_describe_bind = false for batches whose result shape is decided at "
+								"run time",
+								(unsigned long long)bind_data.return_types.size(),
+								(unsigned long long)stream.GetColumnTypes().size());
 }
 
 unique_ptr<FunctionData> MSSQLScanBind(ClientContext &context, TableFunctionBindInput &input,
@@ -87,6 +517,7 @@ unique_ptr<FunctionData> MSSQLScanBind(ClientContext &context, TableFunctionBind
 	auto bind_data = make_uniq<MSSQLScanBindData>();
 	bind_data->context_name = input.inputs[0].GetValue<string>();
 	bind_data->query = input.inputs[1].GetValue<string>();
+	const auto partitioning = ParseScanPartitioning(input.named_parameters);
 
 	// Validate context exists (Spec 047: per-catalog ownership via DuckDB catalog lookup)
 	try {
@@ -103,11 +534,35 @@ unique_ptr<FunctionData> MSSQLScanBind(ClientContext &context, TableFunctionBind
 			bind_data->context_name, bind_data->context_name);
 	}
 
+	auto &mssql_catalog = Catalog::GetCatalog(context, Identifier(bind_data->context_name)).Cast<MSSQLCatalog>();
+	bind_data->range_queries = PlanScanPartitions(context, *bind_data, partitioning);
+
+	MSSQLCatalog::DescribedResult described;
+	if (LoadScanDescribeBind(context) && DescribeScanQuery(context, mssql_catalog, bind_data->query, described)) {
+		bind_data->described = true;
+		bind_data->return_types = described.types;
+		bind_data->column_names = described.names;
+		return_types = described.types;
+		names.clear();
+		for (const auto &name : described.names) {
+			names.push_back(Identifier(name));
+		}
+		auto bind_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+																			 bind_start)
+						   .count();
+		MSSQL_FN_DEBUG_LOG(1, "MSSQLScanBind: END (described, total %ldms)", (long)bind_ms);
+		return std::move(bind_data);
+	}
+
+	// A partitioned scan opens range 0 here: its COLMETADATA is the schema, and
+	// its rows are the first range's
+	const string &first_query = bind_data->range_queries.empty() ? bind_data->query : bind_data->range_queries[0];
+
 	// Execute query to get schema from COLMETADATA
 	auto exec_start = std::chrono::steady_clock::now();
 	MSSQL_FN_DEBUG_LOG(1, "MSSQLScanBind: executing query for schema...");
 	MSSQLQueryExecutor executor(bind_data->context_name);
-	auto result_stream = executor.Execute(context, bind_data->query);
+	auto result_stream = executor.Execute(context, first_query);
 	auto exec_end = std::chrono::steady_clock::now();
 	auto exec_ms = std::chrono::duration_cast<std::chrono::milliseconds>(exec_end - exec_start).count();
 	MSSQL_FN_DEBUG_LOG(1, "MSSQLScanBind: query executed in %ldms", (long)exec_ms);
@@ -130,8 +585,6 @@ unique_ptr<FunctionData> MSSQLScanBind(ClientContext &context, TableFunctionBind
 	// Register the result stream for later retrieval in InitGlobal
 	// This avoids executing the query twice (which causes 30s timeout on large datasets)
 	// Spec 047 / US3: registry lives on MSSQLCatalog (previously process-wide singleton).
-	auto &catalog = Catalog::GetCatalog(context, Identifier(bind_data->context_name));
-	auto &mssql_catalog = catalog.Cast<MSSQLCatalog>();
 	bind_data->result_stream_id = mssql_catalog.RegisterStream(std::move(result_stream));
 	MSSQL_FN_DEBUG_LOG(1, "MSSQLScanBind: registered result_stream_id=%s", bind_data->result_stream_id.c_str());
 
@@ -142,6 +595,23 @@ unique_ptr<FunctionData> MSSQLScanBind(ClientContext &context, TableFunctionBind
 	return std::move(bind_data);
 }
 
+unique_ptr<MSSQLScanBindData> DescribeMSSQLScanQuery(ClientContext &context, const string &context_name,
+													 const string &query) {
+	auto &mssql_catalog = Catalog::GetCatalog(context, Identifier(context_name)).Cast<MSSQLCatalog>();
+	MSSQLCatalog::DescribedResult described;
+	if (!DescribeScanQuery(context, mssql_catalog, query, described)) {
+		return nullptr;
+	}
+	auto bind_data = make_uniq<MSSQLScanBindData>();
+	bind_data->context_name = context_name;
+	bind_data->query = query;
+	bind_data->return_types = described.types;
+	bind_data->column_names = described.names;
+	bind_data->described = true;
+	bind_data->pushed_down = true;
+	return bind_data;
+}
+
 unique_ptr<GlobalTableFunctionState> MSSQLScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto init_start = std::chrono::steady_clock::now();
 	MSSQL_FN_DEBUG_LOG(1, "MSSQLScanInitGlobal: START");
@@ -150,6 +620,39 @@ unique_ptr<GlobalTableFunctionState> MSSQLScanInitGlobal(ClientContext &context,
 	auto result = make_uniq<MSSQLScanGlobalState>();
 	result->context_name = bind_data.context_name;
 
+	// Partitioned scan: range 0 is the stream registered at bind (retrieved
+	// below, or re-opened by whichever thread claims it); the workers open the
+	// others. Only the pool's current headroom (+1 for range 0's connection) may
+	// run at once, anything beyond it would queue in Acquire().
+	if (!bind_data.range_queries.empty()) {
+		auto &mssql_catalog = Catalog::GetCatalog(context, Identifier(bind_data.context_name)).Cast<MSSQLCatalog>();
+		const auto pool_config = LoadPoolConfig(context);
+		const auto pool_stats = mssql_catalog.GetConnectionPool().GetStats();
+		const idx_t headroom = pool_config.connection_limit > pool_stats.active_connections
+								   ? pool_config.connection_limit - pool_stats.active_connections
+								   : 0;
+		result->range_queries = bind_data.range_queries;
+		result->max_streams = headroom + 1;
+		result->projected_column_count = bind_data.return_types.size();
+		result->pool_handle = mssql_catalog.GetConnectionPoolHandle();
+		result->acquire_timeout_ms = pool_config.acquire_timeout * 1000;
+		result->query_timeout_seconds = LoadQueryTimeout(context);
+		result->reset_on_release = ConnectionProvider::ShouldResetOnRelease(context);
+		result->read_ahead_packets = LoadScanReadAhead(context);
+		if (!bind_data.result_stream_id.empty()) {
+			result->result_stream = mssql_catalog.RetrieveStream(bind_data.result_stream_id);
+		} else if (bind_data.described) {
+			// Bound from the described shape: range 0 is opened here, on the
+			// client thread, so the shape is checked before any worker starts
+			MSSQLQueryExecutor executor(bind_data.context_name);
+			result->result_stream = executor.Execute(context, bind_data.range_queries[0]);
+			CheckDescribedShape(mssql_catalog, bind_data, *result->result_stream);
+		}
+		MSSQL_FN_DEBUG_LOG(1, "MSSQLScanInitGlobal: %zu ranges, up to %llu at once", result->range_queries.size(),
+						   (unsigned long long)result->MaxThreads());
+		return std::move(result);
+	}
+
 	// Try to retrieve pre-initialized result stream from registry
 	// This was created in Bind and avoids executing the query twice
 	// Spec 047 / US3: registry lives on MSSQLCatalog (previously process-wide singleton).
@@ -168,11 +671,17 @@ unique_ptr<GlobalTableFunctionState> MSSQLScanInitGlobal(ClientContext &context,
 		MSSQL_FN_DEBUG_LOG(1, "MSSQLScanInitGlobal: result stream not found in registry, re-executing query");
 	}
 
-	// Fallback: re-execute the query (this shouldn't happen normally)
+	// Execute the query: the normal path after a metadata-only bind, otherwise
+	// a re-execution (the bind's stream was already consumed, e.g. by an earlier
+	// execution of a prepared statement)
 	auto exec_start = std::chrono::steady_clock::now();
 	MSSQL_FN_DEBUG_LOG(1, "MSSQLScanInitGlobal: executing query for data...");
 	MSSQLQueryExecutor executor(bind_data.context_name);
 	result->result_stream = executor.Execute(context, bind_data.query);
+	if (bind_data.described) {
+		auto &mssql_catalog = Catalog::GetCatalog(context, Identifier(bind_data.context_name)).Cast<MSSQLCatalog>();
+		CheckDescribedShape(mssql_catalog, bind_data, *result->result_stream);
+	}
 	auto exec_end = std::chrono::steady_clock::now();
 	auto exec_ms = std::chrono::duration_cast<std::chrono::milliseconds>(exec_end - exec_start).count();
 	MSSQL_FN_DEBUG_LOG(1, "MSSQLScanInitGlobal: query executed in %ldms", (long)exec_ms);
@@ -186,11 +695,15 @@ unique_ptr<GlobalTableFunctionState> MSSQLScanInitGlobal(ClientContext &context,
 
 unique_ptr<LocalTableFunctionState> MSSQLScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
 													   GlobalTableFunctionState *global_state) {
-	return make_uniq<MSSQLScanLocalState>();
+	return make_uniq<mssql::TableScanLocalState>();
 }
 
 void MSSQLScanFunction(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
 	auto &global_state = data.global_state->Cast<MSSQLScanGlobalState>();
+	if (!global_state.range_queries.empty()) {
+		mssql::ExecuteScanRanges(context, global_state, data.local_state->Cast<mssql::TableScanLocalState>(), output);
+		return;
+	}
 
 	// Start timing on first call
 	if (!global_state.timing_started) {
@@ -257,6 +770,10 @@ unique_ptr<FunctionData> MSSQLCatalogScanBindData::Copy() const {
 	result->pk_result_indices = pk_result_indices;
 	result->pk_is_composite = pk_is_composite;
 	result->rowid_type = rowid_type;
+	// Partition-aligned scan fields
+	result->partition_info = partition_info;
+	result->partition_column_index = partition_column_index;
+	result->partition_filter = partition_filter;
 	// Spec 052 (Option D): copy the table_entry pointer. Lifetime of the
 	// underlying entry is guaranteed by MSSQLBindAnchors (per ClientContext,
 	// released at QueryEnd); the bind-data copy inherits the same anchor
@@ -469,12 +986,20 @@ void RegisterMSSQLExecFunction(ExtensionLoader &loader) {
 // Registration
 //===----------------------------------------------------------------------===//
 
-void RegisterMSSQLFunctions(ExtensionLoader &loader) {
-	// mssql_scan(context_name VARCHAR, query VARCHAR)
-	// -> dynamic return schema based on query result columns
+TableFunction GetMSSQLScanFunction() {
 	TableFunction mssql_scan("mssql_scan", {LogicalType::VARCHAR, LogicalType::VARCHAR}, MSSQLScanFunction,
 							 MSSQLScanBind, MSSQLScanInitGlobal, MSSQLScanInitLocal);
-	loader.RegisterFunction(mssql_scan);
+	mssql_scan.named_parameters["partition_column"] = LogicalType::VARCHAR;
+	mssql_scan.named_parameters["partitions"] = LogicalType::BIGINT;
+	mssql_scan.named_parameters["partition_bounds"] = LogicalType::ANY;
+	return mssql_scan;
+}
+
+void RegisterMSSQLFunctions(ExtensionLoader &loader) {
+	// mssql_scan(context_name VARCHAR, query VARCHAR
+	//            [, partition_column := VARCHAR, partitions := BIGINT, partition_bounds := LIST])
+	// -> dynamic return schema based on query result columns
+	loader.RegisterFunction(GetMSSQLScanFunction());
 }
 
 }  // namespace duckdb
@@ -1470,6 +1470,7 @@ unique_ptr<Catalog> MSSQLAttach(optional_ptr<StorageExtensionInfo> storage_info,
 	int8_t order_pushdown_option = -1;	// Spec 039: ORDER BY pushdown (-1=unset)
 	bool lazy_validation = false;		// Spec 047 (US2): opt out of eager creds check
 	string application_name_option;		// Spec 047 (US-AN): ATTACH-level program_name override
+	string catalog_snapshot_option;		// Directory for the on-disk metadata cache snapshot
 	for (auto it = options.options.begin(); it != options.options.end();) {
 		auto lower_name = StringUtil::Lower(it->first);
 		if (lower_name == "secret") {
@@ -1518,6 +1519,9 @@ unique_ptr<Catalog> MSSQLAttach(optional_ptr<StorageExtensionInfo> storage_info,
 			// established by schema_filter / table_filter (ATTACH > secret).
 			application_name_option = it->second.ToString();
 			it = options.options.erase(it);
+		} else if (lower_name == "catalog_snapshot") {
+			catalog_snapshot_option = it->second.ToString();
+			it = options.options.erase(it);
 		} else {
 			++it;
 		}
@@ -1602,6 +1606,10 @@ unique_ptr<Catalog> MSSQLAttach(optional_ptr<StorageExtensionInfo> storage_info,
 		// the 128-UTF-16-code-unit clamp + control-char strip.
 		connection_info->application_name = application_name_option;
 	}
+	if (!catalog_snapshot_option.empty()) {
+		connection_info->catalog_snapshot = catalog_snapshot_option;
+		MSSQL_STORAGE_DEBUG_LOG(1, "CATALOG_SNAPSHOT option from ATTACH: %s", catalog_snapshot_option.c_str());
+	}
 
 	// Spec 045: resolve a named instance (host\instance) to its dynamic TCP
 	// port via the SQL Server Browser. Runs here, at ATTACH, because the
@@ -1648,6 +1656,7 @@ unique_ptr<Catalog> MSSQLAttach(optional_ptr<StorageExtensionInfo> storage_info,
 		pool_config.tds_packet_size > 0 ? static_cast<size_t>(pool_config.tds_packet_size) : 0;
 	// Issue #225: ask for UTF-8 unless the user turned the request off.
 	connection_info->utf8_support = pool_config.utf8_support;
+	connection_info->tls_kernel_offload = pool_config.tls_kernel_offload;
 	auto attach_validation_timeout = LoadAttachValidationTimeout(context);
 	MSSQL_STORAGE_DEBUG_LOG(1, "ATTACH %s: lazy_validation=%s, attach_validation_timeout=%ds", name.c_str(),
 							lazy_validation ? "true" : "false", attach_validation_timeout);
@@ -49,7 +49,8 @@ void MSSQLQueryExecutor::ValidateContext(ClientContext &context) {
 	}
 }
 
-unique_ptr<MSSQLResultStream> MSSQLQueryExecutor::Execute(ClientContext &context, const std::string &sql) {
+unique_ptr<MSSQLResultStream> MSSQLQueryExecutor::Execute(ClientContext &context, const std::string &sql,
+														  const tds::ExecuteSqlParameters &parameters) {
 	MSSQL_EXEC_DEBUG_LOG(1, "Execute: START context='%s'", context_name_.c_str());
 	auto total_start = std::chrono::steady_clock::now();
 
@@ -91,6 +92,8 @@ unique_ptr<MSSQLResultStream> MSSQLQueryExecutor::Execute(ClientContext &context
 	auto result_stream =
 		make_uniq<MSSQLResultStream>(std::move(connection), sql, context_name_, mssql_catalog.GetConnectionPoolHandle(),
 									 transaction_pinned, query_timeout, reset_on_release);
+	result_stream->SetReadAhead(LoadScanReadAhead(context));
+	result_stream->SetParameters(parameters);
 
 	// Initialize the stream (sends query, waits for COLMETADATA)
 	// If Initialize() throws, result_stream destructor will release connection back to pool
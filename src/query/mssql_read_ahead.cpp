@@ -0,0 +1,152 @@
+#include "query/mssql_read_ahead.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "tds/tds_socket.hpp"
+
+// Debug logging controlled by MSSQL_DEBUG environment variable
+static int GetReadAheadDebugLevel() {
+	static const int level = []() {
+		const char *env = std::getenv("MSSQL_DEBUG");
+		return env ? std::atoi(env) : 0;
+	}();
+	return level;
+}
+
+#define MSSQL_READ_AHEAD_DEBUG(lvl, fmt, ...)                                \
+	do {                                                                     \
+		if (GetReadAheadDebugLevel() >= lvl) {                               \
+			fprintf(stderr, "[MSSQL READ_AHEAD] " fmt "\n", ##__VA_ARGS__); \
+		}                                                                    \
+	} while (0)
+
+namespace duckdb {
+
+// The reader waits on the socket in slices this long so Stop() is noticed
+// promptly; the query timeout is enforced by the consumer's wait in Next().
+static constexpr int READ_AHEAD_POLL_SLICE_MS = 50;
+
+MSSQLReadAhead::MSSQLReadAhead(tds::TdsSocket &socket, uint64_t depth) : socket_(socket) {
+	if (depth < 1) {
+		depth = 1;
+	}
+	if (depth > MSSQL_MAX_SCAN_READ_AHEAD) {
+		// Unreachable from SQL: mssql_scan_read_ahead is validated on SET
+		depth = MSSQL_MAX_SCAN_READ_AHEAD;
+	}
+	slots_.resize(depth);
+	lengths_.resize(depth, 0);
+	reader_ = std::thread([this]() { ReaderLoop(); });
+	MSSQL_READ_AHEAD_DEBUG(1, "started, depth=%llu", (unsigned long long)depth);
+}
+
+MSSQLReadAhead::~MSSQLReadAhead() {
+	Stop();
+}
+
+void MSSQLReadAhead::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	space_ready_.notify_all();
+	if (reader_.joinable()) {
+		reader_.join();
+	}
+}
+
+void MSSQLReadAhead::ReaderLoop() {
+	uint64_t packets = 0;
+	while (true) {
+		size_t slot;
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			space_ready_.wait(lock, [this]() { return stop_ || filled_ < slots_.size(); });
+			if (stop_) {
+				break;
+			}
+			slot = (head_ + filled_) % slots_.size();
+		}
+
+		// Socket I/O outside the lock: the consumer only ever touches slots that
+		// are already counted in filled_, and this one is not yet.
+		const uint8_t *payload = nullptr;
+		size_t payload_length = 0;
+		bool end_of_message = false;
+		bool received = false;
+		while (!received) {
+			received = socket_.ReceivePayloadView(payload, payload_length, READ_AHEAD_POLL_SLICE_MS, &end_of_message);
+			if (received) {
+				break;
+			}
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (stop_) {
+				break;
+			}
+			// A malformed frame leaves the connection "up" but can never be
+			// read past; anything else with the connection intact is a slice
+			// that timed out, and the reader keeps waiting.
+			if (!socket_.IsConnected() || socket_.HasFramingError()) {
+				const auto &socket_error = socket_.GetLastError();
+				error_ = socket_error.empty() ? "Connection closed unexpectedly" : socket_error;
+				break;
+			}
+		}
+		if (!received) {
+			break;
+		}
+
+		auto &buffer = slots_[slot];
+		if (buffer.size() < payload_length) {
+			buffer.resize(payload_length);
+		}
+		if (payload_length > 0) {
+			std::memcpy(buffer.data(), payload, payload_length);
+		}
+		lengths_[slot] = payload_length;
+		packets++;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			filled_++;
+		}
+		data_ready_.notify_one();
+		if (end_of_message) {
+			break;
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		finished_ = true;
+	}
+	data_ready_.notify_all();
+	MSSQL_READ_AHEAD_DEBUG(1, "reader exit after %llu packets%s%s", (unsigned long long)packets,
+						   error_.empty() ? "" : ": ", error_.c_str());
+}
+
+MSSQLReadAhead::ReadStatus MSSQLReadAhead::Next(const uint8_t *&payload, size_t &payload_length, int timeout_ms) {
+	std::unique_lock<std::mutex> lock(mutex_);
+	if (held_) {
+		head_ = (head_ + 1) % slots_.size();
+		filled_--;
+		held_ = false;
+		space_ready_.notify_one();
+	}
+	if (filled_ == 0 && !finished_) {
+		data_ready_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+							 [this]() { return filled_ > 0 || finished_; });
+	}
+	if (filled_ > 0) {
+		held_ = true;
+		payload = slots_[head_].data();
+		payload_length = lengths_[head_];
+		return ReadStatus::Data;
+	}
+	if (!finished_) {
+		return ReadStatus::Timeout;
+	}
+	return error_.empty() ? ReadStatus::Drained : ReadStatus::Failed;
+}
+
+}  // namespace duckdb
@@ -82,6 +82,8 @@ MSSQLResultStream::~MSSQLResultStream() {
 	if (state_ == MSSQLResultStreamState::Streaming) {
 		Cancel();
 	}
+	// The reader must be gone before the connection is closed or pooled.
+	read_ahead_.reset();
 
 	// Return connection to the pool.
 	//
@@ -134,10 +136,13 @@ bool MSSQLResultStream::Initialize() {
 		throw InvalidInputException("MSSQLResultStream already initialized");
 	}
 
-	// Send the SQL batch
-	if (!connection_->ExecuteBatch(sql_)) {
+	// Send the SQL batch, or the sp_executesql RPC when parameters are bound
+	if (!connection_->ExecuteSql(sql_, parameters_)) {
 		throw IOException("Failed to execute SQL batch: " + connection_->GetLastError());
 	}
+	if (read_ahead_packets_ > 0 && connection_->GetSocket()) {
+		read_ahead_ = make_uniq<MSSQLReadAhead>(*connection_->GetSocket(), read_ahead_packets_);
+	}
 
 	// Read and parse until we get COLMETADATA
 	while (state_ == MSSQLResultStreamState::Initializing) {
@@ -743,6 +748,29 @@ void MSSQLResultStream::PrintStagingCounters() {
 }
 
 bool MSSQLResultStream::ReadMoreData(int timeout_ms) {
+	if (read_ahead_) {
+		const uint8_t *payload = nullptr;
+		size_t payload_length = 0;
+		switch (read_ahead_->Next(payload, payload_length, timeout_ms)) {
+		case MSSQLReadAhead::ReadStatus::Data:
+			if (payload_length > 0) {
+				parser_.Feed(payload, payload_length);
+			}
+			return true;
+		case MSSQLReadAhead::ReadStatus::Timeout:
+			last_socket_error_ = "Socket timeout waiting for data";
+			return false;
+		case MSSQLReadAhead::ReadStatus::Failed:
+			last_socket_error_ = read_ahead_->GetError();
+			return false;
+		case MSSQLReadAhead::ReadStatus::Drained:
+			// Everything the reader took off the socket has been fed; from here
+			// on this thread reads the socket itself.
+			read_ahead_.reset();
+			break;
+		}
+	}
+
 	// Read TDS packet from connection (packet includes 8-byte header)
 	// We use the socket's ReceivePacket method to properly parse the header
 	auto *socket = connection_->GetSocket();
@@ -767,6 +795,12 @@ bool MSSQLResultStream::ReadMoreData(int timeout_ms) {
 	return true;
 }
 
+void MSSQLResultStream::StopReadAhead() {
+	if (read_ahead_) {
+		read_ahead_->Stop();
+	}
+}
+
 void MSSQLResultStream::Cancel() {
 	if (is_cancelled_.load(std::memory_order_acquire)) {
 		MSSQL_DEBUG_LOG(1, "Cancel: already cancelled, skipping");
@@ -775,6 +809,9 @@ void MSSQLResultStream::Cancel() {
 
 	is_cancelled_.store(true, std::memory_order_release);
 
+	// ATTENTION is a send on the socket the reader is receiving on
+	StopReadAhead();
+
 	// Send ATTENTION signal if we're in streaming state
 	if (state_ == MSSQLResultStreamState::Streaming) {
 		MSSQL_DEBUG_LOG(1, "Cancel: sending ATTENTION (state=Streaming, rows_read=%llu)",
@@ -863,6 +900,8 @@ void MSSQLResultStream::DrainRemainingTokens() {
 	// Drain remaining TDS tokens after detecting an error condition.
 	// Similar to DrainAfterCancel but without sending ATTENTION signal.
 	// SQL Server is already sending the remaining data — we just consume it.
+	// The reader is stopped because a timeout below closes the connection.
+	StopReadAhead();
 	parser_.SetSkipMode(true);
 
 	auto start = std::chrono::steady_clock::now();
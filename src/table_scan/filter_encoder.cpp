@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <mutex>
 #include "codec/literal_format.hpp"
 #include "codec/string_codec.hpp"
 #include "duckdb/common/exception.hpp"
@@ -25,6 +26,7 @@
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
+#include "table_scan/filter_parameters.hpp"
 #include "table_scan/function_mapping.hpp"
 
 // Debug logging controlled by MSSQL_DEBUG environment variable
@@ -140,6 +142,14 @@ std::string FilterEncoder::EscapeBracketIdentifier(const std::string &identifier
 	return result;
 }
 
+std::string FilterEncoder::QualifyColumn(const std::string &column_name, const ExpressionEncodeContext &ctx) {
+	std::string column = "[" + EscapeBracketIdentifier(column_name) + "]";
+	if (ctx.table_alias) {
+		return "[" + EscapeBracketIdentifier(*ctx.table_alias) + "]." + column;
+	}
+	return column;
+}
+
 std::string FilterEncoder::EscapeLikePattern(const std::string &pattern) {
 	std::string result;
 	result.reserve(pattern.size() + 10);
@@ -218,7 +228,8 @@ std::string FilterEncoder::ValueToSQLLiteral(const Value &value, const LogicalTy
 
 FilterEncoderResult FilterEncoder::Encode(const TableFilterSet *filters, const std::vector<column_t> &column_ids,
 										  const std::vector<std::string> &column_names,
-										  const std::vector<LogicalType> &column_types) {
+										  const std::vector<LogicalType> &column_types, FilterParameters *parameters,
+										  const std::string *table_alias, idx_t join_filter_max_in) {
 	FilterEncoderResult result;
 	result.needs_duckdb_filter = false;
 
@@ -230,6 +241,9 @@ FilterEncoderResult FilterEncoder::Encode(const TableFilterSet *filters, const s
 	MSSQL_FILTER_DEBUG_LOG(1, "Encode: encoding %zu filter(s)", static_cast<size_t>(filters->FilterCount()));
 
 	ExpressionEncodeContext ctx(column_ids, column_names, column_types);
+	ctx.parameters = parameters;
+	ctx.table_alias = table_alias;
+	ctx.join_filter_max_in = join_filter_max_in;
 	std::vector<std::string> where_conditions;
 
 	// Virtual/special column identifiers start at 2^63
@@ -275,7 +289,7 @@ FilterEncoderResult FilterEncoder::Encode(const TableFilterSet *filters, const s
 
 		const std::string &col_name = column_names[table_col_idx];
 		const LogicalType &col_type = column_types[table_col_idx];
-		std::string escaped_col = "[" + EscapeBracketIdentifier(col_name) + "]";
+		std::string escaped_col = QualifyColumn(col_name, ctx);
 
 		MSSQL_FILTER_DEBUG_LOG(2, "  encoding filter for column: projected_idx=%llu -> table_idx=%llu -> %s",
 							   (unsigned long long)projected_col_idx, (unsigned long long)table_col_idx,
@@ -318,7 +332,7 @@ ExpressionEncodeResult FilterEncoder::EncodeFilter(const TableFilter &filter, co
 												   const LogicalType &column_type, const ExpressionEncodeContext &ctx) {
 	switch (filter.filter_type) {
 	case TableFilterType::LEGACY_CONSTANT_COMPARISON:
-		return EncodeConstantComparison(filter.Cast<LegacyConstantFilter>(), column_name, column_type);
+		return EncodeConstantComparison(filter.Cast<LegacyConstantFilter>(), column_name, column_type, ctx);
 
 	case TableFilterType::LEGACY_IS_NULL:
 		return EncodeIsNull(column_name);
@@ -327,7 +341,7 @@ ExpressionEncodeResult FilterEncoder::EncodeFilter(const TableFilter &filter, co
 		return EncodeIsNotNull(column_name);
 
 	case TableFilterType::LEGACY_IN_FILTER:
-		return EncodeInFilter(filter.Cast<LegacyInFilter>(), column_name, column_type);
+		return EncodeInFilter(filter.Cast<LegacyInFilter>(), column_name, column_type, ctx);
 
 	case TableFilterType::LEGACY_CONJUNCTION_OR:
 		return EncodeConjunctionOr(filter.Cast<LegacyConjunctionOrFilter>(), column_name, column_type, ctx);
@@ -346,8 +360,12 @@ ExpressionEncodeResult FilterEncoder::EncodeFilter(const TableFilter &filter, co
 	}
 
 	case TableFilterType::LEGACY_OPTIONAL_FILTER:
-	case TableFilterType::LEGACY_STRUCT_EXTRACT:
+		return EncodeOptionalFilter(filter.Cast<LegacyOptionalFilter>(), column_name, column_type, ctx);
+
 	case TableFilterType::LEGACY_DYNAMIC_FILTER:
+		return EncodeDynamicFilter(filter.Cast<LegacyDynamicFilter>(), column_name, column_type, ctx);
+
+	case TableFilterType::LEGACY_STRUCT_EXTRACT:
 	default:
 		// These filter types cannot be pushed down to SQL Server
 		MSSQL_FILTER_DEBUG_LOG(1, "Filter type %d cannot be pushed down", (int)filter.filter_type);
@@ -357,13 +375,14 @@ ExpressionEncodeResult FilterEncoder::EncodeFilter(const TableFilter &filter, co
 
 ExpressionEncodeResult FilterEncoder::EncodeConstantComparison(const LegacyConstantFilter &filter,
 															   const std::string &column_name,
-															   const LogicalType &column_type) {
+															   const LogicalType &column_type,
+															   const ExpressionEncodeContext &ctx) {
 	std::string op;
 	if (!GetComparisonOperator(filter.comparison_type, op)) {
 		return {"", false};
 	}
 
-	std::string sql = column_name + op + ValueToSQLLiteral(filter.constant, column_type);
+	std::string sql = column_name + op + EncodeComparisonConstant(filter.constant, column_type, ctx);
 	return {sql, true};
 }
 
@@ -376,18 +395,88 @@ ExpressionEncodeResult FilterEncoder::EncodeIsNotNull(const std::string &column_
 }
 
 ExpressionEncodeResult FilterEncoder::EncodeInFilter(const LegacyInFilter &filter, const std::string &column_name,
-													 const LogicalType &column_type) {
+													 const LogicalType &column_type,
+													 const ExpressionEncodeContext &ctx) {
 	std::string sql = column_name + " IN (";
 	for (idx_t i = 0; i < filter.values.size(); i++) {
 		if (i > 0) {
 			sql += ", ";
 		}
-		sql += ValueToSQLLiteral(filter.values[i], column_type);
+		sql += EncodeComparisonConstant(filter.values[i], column_type, ctx);
 	}
 	sql += ")";
 	return {sql, true};
 }
 
+// A hash join pushes its build side's key set into the probe scan as an
+// optional IN filter once the build has finished, which is before the probe
+// pipeline creates the scan's global state and sends the query. Optional means
+// the join re-checks every row anyway: a filter the server cannot take, or an
+// IN set over the limit, is dropped instead of run client-side.
+ExpressionEncodeResult FilterEncoder::EncodeOptionalFilter(const LegacyOptionalFilter &filter,
+														   const std::string &column_name,
+														   const LogicalType &column_type,
+														   const ExpressionEncodeContext &ctx) {
+	if (!filter.child_filter) {
+		return {"", true};
+	}
+	const auto &child = *filter.child_filter;
+	if (child.filter_type == TableFilterType::LEGACY_IN_FILTER &&
+		child.Cast<LegacyInFilter>().values.size() > ctx.join_filter_max_in) {
+		MSSQL_FILTER_DEBUG_LOG(1, "EncodeOptionalFilter: IN set of %zu values over the limit, dropped",
+							   child.Cast<LegacyInFilter>().values.size());
+		return {"", true};
+	}
+	auto result = EncodeFilter(child, column_name, column_type, ctx);
+	if (!result.supported) {
+		MSSQL_FILTER_DEBUG_LOG(1, "EncodeOptionalFilter: child filter type %d not encodable, dropped",
+							   (int)child.filter_type);
+		return {"", true};
+	}
+	return result;
+}
+
+// A Top-N boundary only tightens while the Top-N fills, so whatever value it
+// holds when the query is built excludes no row the Top-N would keep.
+ExpressionEncodeResult FilterEncoder::EncodeDynamicFilter(const LegacyDynamicFilter &filter,
+														  const std::string &column_name,
+														  const LogicalType &column_type,
+														  const ExpressionEncodeContext &ctx) {
+	if (!filter.filter_data) {
+		return {"", true};
+	}
+	std::lock_guard<std::mutex> guard(filter.filter_data->lock);
+	if (!filter.filter_data->initialized || !filter.filter_data->filter) {
+		return {"", true};
+	}
+	auto result = EncodeConstantComparison(*filter.filter_data->filter, column_name, column_type, ctx);
+	return {result.supported ? result.sql : "", true};
+}
+
+std::string FilterEncoder::EncodeComparisonConstant(const Value &value, const LogicalType &type,
+													const ExpressionEncodeContext &ctx) {
+	if (ctx.parameters) {
+		auto placeholder = ctx.parameters->Bind(value, type);
+		if (!placeholder.empty()) {
+			return placeholder;
+		}
+	}
+	return ValueToSQLLiteral(value, type);
+}
+
+ExpressionEncodeResult FilterEncoder::EncodeComparisonOperand(const Expression &expr,
+															  const ExpressionEncodeContext &ctx) {
+	if (ctx.parameters && expr.GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+		auto &constant = expr.Cast<BoundConstantExpression>();
+		auto placeholder = ctx.parameters->Bind(constant.GetValue(), constant.GetReturnType());
+		if (!placeholder.empty()) {
+			return {placeholder, true};
+		}
+	}
+	// Not a constant, or one that stays a literal: EncodeConstant decides
+	return EncodeExpression(expr, ctx);
+}
+
 ExpressionEncodeResult FilterEncoder::EncodeConjunctionAnd(const LegacyConjunctionAndFilter &filter,
 														   const std::string &column_name,
 														   const LogicalType &column_type,
@@ -510,11 +599,16 @@ ExpressionEncodeResult FilterEncoder::EncodeExpression(const Expression &expr, c
 		// Only inside an EXPRESSION_FILTER, where the combiner replaced the
 		// filter column's reference with BoundReference(0) — the combiner
 		// rejects multi-column expressions before pushing, so index 0 is the
-		// filter's own column and anything else is unencodable.
+		// filter's own column and anything else is unencodable. The one other
+		// place is an expression planned after binding resolution, where the
+		// context says references are projected columns.
 		auto &ref = expr.Cast<BoundReferenceExpression>();
 		if (ctx.filter_column && ref.Index() == 0) {
 			return {*ctx.filter_column, true};
 		}
+		if (ctx.bound_refs_are_columns) {
+			return EncodeProjectedColumn(ref.Index(), ctx);
+		}
 		MSSQL_FILTER_DEBUG_LOG(1, "EncodeExpression: BOUND_REF outside a filter context, not pushed");
 		return {"", false};
 	}
@@ -699,13 +793,13 @@ ExpressionEncodeResult FilterEncoder::EncodeComparisonExpression(const BoundFunc
 
 	// Encode left and right sides
 	auto child_ctx = ctx.child();
-	auto left_result = EncodeExpression(left, child_ctx);
+	auto left_result = EncodeComparisonOperand(left, child_ctx);
 	if (!left_result.supported) {
 		MSSQL_FILTER_DEBUG_LOG(1, "EncodeComparisonExpression: left side encoding failed");
 		return {"", false};
 	}
 
-	auto right_result = EncodeExpression(right, child_ctx);
+	auto right_result = EncodeComparisonOperand(right, child_ctx);
 	if (!right_result.supported) {
 		MSSQL_FILTER_DEBUG_LOG(1, "EncodeComparisonExpression: right side encoding failed");
 		return {"", false};
@@ -823,14 +917,14 @@ ExpressionEncodeResult FilterEncoder::EncodeBetweenExpression(const BoundFunctio
 	}
 
 	// Encode the lower bound
-	auto lower_result = EncodeExpression(BoundBetweenExpression::LowerBound(expr), child_ctx);
+	auto lower_result = EncodeComparisonOperand(BoundBetweenExpression::LowerBound(expr), child_ctx);
 	if (!lower_result.supported) {
 		MSSQL_FILTER_DEBUG_LOG(1, "EncodeBetweenExpression: lower bound encoding failed");
 		return {"", false};
 	}
 
 	// Encode the upper bound
-	auto upper_result = EncodeExpression(BoundBetweenExpression::UpperBound(expr), child_ctx);
+	auto upper_result = EncodeComparisonOperand(BoundBetweenExpression::UpperBound(expr), child_ctx);
 	if (!upper_result.supported) {
 		MSSQL_FILTER_DEBUG_LOG(1, "EncodeBetweenExpression: upper bound encoding failed");
 		return {"", false};
@@ -859,14 +953,16 @@ ExpressionEncodeResult FilterEncoder::EncodeColumnRef(const BoundColumnRefExpres
 	const auto &binding = expr.Binding();
 	MSSQL_FILTER_DEBUG_LOG(2, "EncodeColumnRef: table_idx=%llu, column_idx=%llu",
 						   (unsigned long long)binding.table_index.index, (unsigned long long)binding.column_index);
+	return EncodeProjectedColumn(binding.column_index, ctx);
+}
 
+ExpressionEncodeResult FilterEncoder::EncodeProjectedColumn(column_t projected_idx,
+															const ExpressionEncodeContext &ctx) {
 	// Virtual/special column identifiers start at 2^63
 	constexpr column_t VIRTUAL_COL_START = UINT64_C(9223372036854775808);
 
 	// The column_index from binding refers to the projected column index
 	// We need to map it through column_ids to get the actual table column index
-	column_t projected_idx = binding.column_index;
-
 	column_t table_col_idx;
 	if (ctx.column_ids.empty()) {
 		// No projection - use binding index directly
@@ -884,7 +980,7 @@ ExpressionEncodeResult FilterEncoder::EncodeColumnRef(const BoundColumnRefExpres
 	if (table_col_idx == COLUMN_IDENTIFIER_ROW_ID) {
 		// Only scalar PK can be used in arbitrary expressions
 		if (ctx.HasPKInfo() && !ctx.pk_is_composite) {
-			std::string sql = "[" + EscapeBracketIdentifier((*ctx.pk_column_names)[0]) + "]";
+			std::string sql = QualifyColumn((*ctx.pk_column_names)[0], ctx);
 			MSSQL_FILTER_DEBUG_LOG(2, "EncodeColumnRef: rowid (scalar PK) -> %s", sql.c_str());
 			return {sql, true};
 		}
@@ -907,7 +1003,7 @@ ExpressionEncodeResult FilterEncoder::EncodeColumnRef(const BoundColumnRefExpres
 	}
 
 	const std::string &col_name = ctx.column_names[table_col_idx];
-	std::string sql = "[" + EscapeBracketIdentifier(col_name) + "]";
+	std::string sql = QualifyColumn(col_name, ctx);
 	MSSQL_FILTER_DEBUG_LOG(2, "EncodeColumnRef: encoded -> %s", sql.c_str());
 	return {sql, true};
 }
@@ -1099,7 +1195,7 @@ ExpressionEncodeResult FilterEncoder::EncodeRowidEquality(const Expression &valu
 			if (i > 0) {
 				sql += " AND ";
 			}
-			sql += "[" + EscapeBracketIdentifier((*ctx.pk_column_names)[i]) + "]";
+			sql += QualifyColumn((*ctx.pk_column_names)[i], ctx);
 			sql += " = ";
 			sql += ValueToSQLLiteral(children[i], (*ctx.pk_column_types)[i]);
 		}
@@ -1108,7 +1204,7 @@ ExpressionEncodeResult FilterEncoder::EncodeRowidEquality(const Expression &valu
 		return {sql, true};
 	} else {
 		// Scalar PK: rowid = value
-		std::string sql = "[" + EscapeBracketIdentifier((*ctx.pk_column_names)[0]) + "]";
+		std::string sql = QualifyColumn((*ctx.pk_column_names)[0], ctx);
 		sql += " = ";
 		sql += ValueToSQLLiteral(const_expr.GetValue(), (*ctx.pk_column_types)[0]);
 		MSSQL_FILTER_DEBUG_LOG(2, "EncodeRowidEquality: scalar PK -> %s", sql.c_str());
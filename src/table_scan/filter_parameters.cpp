@@ -0,0 +1,18 @@
+// Filter Parameters Implementation
+// Pushed-down filter constants as typed sp_executesql parameters.
+
+#include "table_scan/filter_parameters.hpp"
+#include "tds/encoding/rpc_parameter_encoder.hpp"
+
+namespace duckdb {
+namespace mssql {
+
+std::string FilterParameters::Bind(const Value &value, const LogicalType &type) {
+	if (Count() >= MAX_PARAMETERS) {
+		return "";
+	}
+	return tds::encoding::RpcParameterEncoder::Bind(value, type, parameters_);
+}
+
+}  // namespace mssql
+}  // namespace duckdb
@@ -0,0 +1,277 @@
+// MSSQL Optimizer Extension - GROUP BY / Aggregate Pushdown
+//
+// Detects LogicalAggregate directly above an MSSQL relation (a catalog scan,
+// or a join already pushed down; see mssql_remote_relation.hpp) and replaces
+// it with an mssql_scan of a T-SQL query that returns the aggregated rows, so
+// SQL Server reads the table and only one row per group crosses the wire.
+//
+// The rewrite is all-or-nothing: one group, aggregate or pushed-down filter
+// without an exact T-SQL equivalent leaves the plan as DuckDB built it.
+// "Exact" rules out a few things that would encode:
+//   - string keys are grouped by their bytes (VARBINARY), not by collation,
+//     which would merge 'a', 'A' and 'a ' into one group
+//   - MIN/MAX only over types whose ordering SQL Server shares (no strings)
+//   - integer SUM runs over DECIMAL(38,0), where SQL Server's own SUM(int)
+//     would overflow at the input type and DuckDB's HUGEINT sum does not
+
+#include "table_scan/mssql_aggregate_pushdown.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include "connection/mssql_settings.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "mssql_functions.hpp"
+#include "table_scan/mssql_remote_relation.hpp"
+
+// Debug logging controlled by MSSQL_DEBUG environment variable
+static int GetAggregatePushdownDebugLevel() {
+	static const int level = []() {
+		const char *env = std::getenv("MSSQL_DEBUG");
+		return env ? std::atoi(env) : 0;
+	}();
+	return level;
+}
+
+#define MSSQL_AGG_DEBUG(lvl, fmt, ...)                                              \
+	do {                                                                            \
+		if (GetAggregatePushdownDebugLevel() >= lvl) {                              \
+			fprintf(stderr, "[MSSQL AGGREGATE PUSHDOWN] " fmt "\n", ##__VA_ARGS__); \
+		}                                                                           \
+	} while (0)
+
+namespace duckdb {
+
+using mssql::ExpressionEncodeContext;
+using mssql::FilterEncoder;
+
+//------------------------------------------------------------------------------
+// Type classes
+//------------------------------------------------------------------------------
+
+static bool IsIntegerType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsNumericType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return IsIntegerType(type);
+	}
+}
+
+// Types SQL Server orders the way DuckDB does (MIN/MAX)
+static bool IsOrderedType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_SEC:
+		return true;
+	default:
+		return IsNumericType(type);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Encoding
+//------------------------------------------------------------------------------
+
+// One group key of the remote query
+struct RemoteGroup {
+	string select_sql;
+	string group_sql;
+};
+
+static bool EncodeGroup(const Expression &expr, const MSSQLRemoteRelation &relation,
+						const ExpressionEncodeContext &ctx, RemoteGroup &out) {
+	const auto &type = expr.GetReturnType();
+	if (type.id() == LogicalTypeId::VARCHAR) {
+		// Group a character column by its bytes and return each group's (single)
+		// value, so the groups are DuckDB's and not the collation's
+		column_t column;
+		if (!relation.table || !relation.ResolveColumn(expr, column) ||
+			column >= relation.table->mssql_columns.size()) {
+			return false;
+		}
+		const auto &info = relation.table->mssql_columns[column];
+		const auto sql_type = StringUtil::Lower(info.sql_type_name);
+		if ((sql_type != "char" && sql_type != "varchar" && sql_type != "nchar" && sql_type != "nvarchar") ||
+			info.max_length <= 0) {
+			return false;
+		}
+		const int chars = info.is_unicode ? info.max_length / 2 : info.max_length;
+		const string name = FilterEncoder::QualifyColumn((*relation.column_names)[column], ctx);
+		out.select_sql =
+			"CAST(MAX(" + name + ") AS NVARCHAR(" + (chars > 4000 ? "MAX" : std::to_string(chars)) + "))";
+		out.group_sql = "CAST(" + name + " AS VARBINARY(" + std::to_string(info.max_length) + "))";
+		return true;
+	}
+	if (type.InternalType() == PhysicalType::VARCHAR || IsRemotePredicate(expr)) {
+		return false;
+	}
+	auto encoded = FilterEncoder::EncodeExpression(expr, ctx);
+	if (!encoded.supported || encoded.sql.empty()) {
+		return false;
+	}
+	out.select_sql = encoded.sql;
+	out.group_sql = encoded.sql;
+	return true;
+}
+
+static bool EncodeAggregate(const BoundAggregateExpression &aggr, const ExpressionEncodeContext &ctx, string &out) {
+	if (aggr.filter || aggr.order_bys) {
+		return false;
+	}
+	const auto name = aggr.Function().GetName().GetIdentifierName();
+	const bool distinct = aggr.IsDistinct();
+	if (name == "count_star") {
+		out = "COUNT_BIG(*)";
+		return true;
+	}
+	if (aggr.GetChildren().size() != 1) {
+		return false;
+	}
+	const auto &input = *aggr.GetChildren()[0];
+	const auto &type = input.GetReturnType();
+	if (IsRemotePredicate(input)) {
+		return false;
+	}
+	auto encoded = FilterEncoder::EncodeExpression(input, ctx);
+	if (!encoded.supported || encoded.sql.empty()) {
+		return false;
+	}
+	const string argument = (distinct ? "DISTINCT " : "") + encoded.sql;
+
+	if (name == "count") {
+		// DISTINCT strings would be told apart by collation
+		if (distinct && type.InternalType() == PhysicalType::VARCHAR) {
+			return false;
+		}
+		out = "COUNT_BIG(" + argument + ")";
+		return true;
+	}
+	if (name == "min" || name == "max") {
+		if (!IsOrderedType(type)) {
+			return false;
+		}
+		out = StringUtil::Upper(name) + "(" + encoded.sql + ")";
+		return true;
+	}
+	if (!IsNumericType(type)) {
+		return false;
+	}
+	const string sum_input = IsIntegerType(type) ? "CAST(" + encoded.sql + " AS DECIMAL(38,0))" : encoded.sql;
+	const string sum = string("SUM(") + (distinct ? "DISTINCT " : "") + sum_input + ")";
+	if (name == "sum" || name == "sum_no_overflow") {
+		out = sum;
+		return true;
+	}
+	if (name == "avg" && aggr.GetReturnType().id() == LogicalTypeId::DOUBLE) {
+		// SUM / COUNT in float: an empty group has a NULL sum, and NULLIF keeps
+		// the division from raising on it
+		out = "CAST(" + sum + " AS FLOAT) / NULLIF(COUNT_BIG(" + argument + "), 0)";
+		return true;
+	}
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Rewrite
+//------------------------------------------------------------------------------
+
+bool TryPushAggregate(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+					  unique_ptr<LogicalOperator> &plan) {
+	if (plan->type != LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY || plan->children.size() != 1) {
+		return false;
+	}
+	auto &aggr = plan->Cast<LogicalAggregate>();
+	if (aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		return false;
+	}
+	MSSQLRemoteRelation relation;
+	if (!MSSQLRemoteRelation::Find(*aggr.children[0], relation) || !LoadAggregatePushdown(input.context)) {
+		return false;
+	}
+	MSSQL_AGG_DEBUG(1, "Detected LogicalAggregate -> %sLogicalGet over %s", relation.projection ? "Projection -> " : "",
+					relation.table ? relation.from_sql.c_str() : "a pushed-down query");
+	auto ctx = relation.EncodeContext(nullptr);
+
+	// Output columns: the groups, then the aggregates, in the aggregate's order
+	vector<string> select_list;
+	vector<string> group_list;
+	vector<ColumnBinding> bindings;
+	vector<LogicalType> types;
+	for (idx_t i = 0; i < aggr.groups.size(); i++) {
+		auto group = aggr.groups[i]->Copy();
+		RemoteGroup remote;
+		if (!relation.InlineProjection(group) || !EncodeGroup(*group, relation, ctx, remote)) {
+			MSSQL_AGG_DEBUG(1, "  group %llu: no exact encoding, keeping local aggregate", (unsigned long long)i);
+			return false;
+		}
+		select_list.push_back(remote.select_sql + " AS [g" + std::to_string(i) + "]");
+		group_list.push_back(remote.group_sql);
+		bindings.emplace_back(aggr.group_index, i);
+		types.push_back(aggr.groups[i]->GetReturnType());
+	}
+	for (idx_t i = 0; i < aggr.expressions.size(); i++) {
+		if (aggr.expressions[i]->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+			return false;
+		}
+		auto expression = aggr.expressions[i]->Copy();
+		string sql;
+		if (!relation.InlineProjection(expression) ||
+			!EncodeAggregate(expression->Cast<BoundAggregateExpression>(), ctx, sql)) {
+			MSSQL_AGG_DEBUG(1, "  aggregate %s: no exact encoding, keeping local aggregate",
+							aggr.expressions[i]->ToString().c_str());
+			return false;
+		}
+		select_list.push_back(sql + " AS [a" + std::to_string(i) + "]");
+		bindings.emplace_back(aggr.aggregate_index, i);
+		types.push_back(aggr.expressions[i]->GetReturnType());
+	}
+	if (select_list.empty()) {
+		return false;
+	}
+
+	string where_clause;
+	if (!relation.EncodeFilters(nullptr, where_clause)) {
+		MSSQL_AGG_DEBUG(1, "  filters not fully pushable, keeping local aggregate");
+		return false;
+	}
+
+	string query = "SELECT " + StringUtil::Join(select_list, ", ") + " FROM " + relation.FromItem(nullptr);
+	if (!where_clause.empty()) {
+		query += " WHERE " + where_clause;
+	}
+	if (!group_list.empty()) {
+		query += " GROUP BY " + StringUtil::Join(group_list, ", ");
+	}
+	MSSQL_AGG_DEBUG(1, "  remote query: %s", query.c_str());
+
+	const auto group_count = aggr.groups.size();
+	if (!ReplaceWithRemoteQuery(input, root, plan, relation.context_name, query, bindings, types)) {
+		MSSQL_AGG_DEBUG(1, "  query not describable, keeping local aggregate");
+		return false;
+	}
+	MSSQL_AGG_DEBUG(1, "  pushed %llu group(s), %llu aggregate(s)", (unsigned long long)group_count,
+					(unsigned long long)(types.size() - group_count));
+	return true;
+}
+
+}  // namespace duckdb
@@ -0,0 +1,249 @@
+// MSSQL Optimizer Extension - JOIN Pushdown
+//
+// Detects an INNER or LEFT comparison join whose two inputs are relations of
+// the same attached database and replaces it with an mssql_scan of one
+// T-SQL SELECT ... JOIN, so SQL Server joins with its indexes and only the
+// joined rows cross the wire. The optimizer visits joins bottom-up, so a join
+// of joins (a star schema) nests into one query, and an aggregate above it
+// can then fold the whole thing (mssql_aggregate_pushdown.cpp).
+//
+// Like the aggregate pushdown the rewrite is all-or-nothing. Exactness rules:
+//   - string equality also compares the bytes: a collation would match 'a'
+//     with 'A' and 'a ', DuckDB does not; string ordering conditions stay local
+//   - filters DuckDB would re-check, and complex filter clauses (encoded for
+//     the table alone, unqualified), stay local
+//   - output columns the table scan converts (geometry, CAST-required types)
+//     stay local
+
+#include "table_scan/mssql_join_pushdown.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include "connection/mssql_settings.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "mssql_functions.hpp"
+#include "table_scan/mssql_remote_relation.hpp"
+
+// Debug logging controlled by MSSQL_DEBUG environment variable
+static int GetJoinPushdownDebugLevel() {
+	static const int level = []() {
+		const char *env = std::getenv("MSSQL_DEBUG");
+		return env ? std::atoi(env) : 0;
+	}();
+	return level;
+}
+
+#define MSSQL_JOIN_DEBUG(lvl, fmt, ...)                                        \
+	do {                                                                       \
+		if (GetJoinPushdownDebugLevel() >= lvl) {                              \
+			fprintf(stderr, "[MSSQL JOIN PUSHDOWN] " fmt "\n", ##__VA_ARGS__); \
+		}                                                                      \
+	} while (0)
+
+namespace duckdb {
+
+using mssql::ExpressionEncodeContext;
+using mssql::FilterEncoder;
+
+// One input of the join with the alias it has in the remote query
+struct JoinSide {
+	MSSQLRemoteRelation relation;
+	string alias;
+
+	ExpressionEncodeContext EncodeContext() const {
+		return relation.EncodeContext(&alias);
+	}
+
+	bool Produces(const ColumnBinding &binding) const {
+		return binding.table_index == relation.get->table_index ||
+			   (relation.projection && binding.table_index == relation.projection->table_index);
+	}
+};
+
+static const MSSQLColumnInfo *TableColumnInfo(const JoinSide &side, const Expression &expr) {
+	column_t column;
+	auto table = side.relation.table;
+	if (!table || !side.relation.ResolveColumn(expr, column) || column >= table->mssql_columns.size()) {
+		return nullptr;
+	}
+	return &table->mssql_columns[column];
+}
+
+static bool IsCharacterColumn(const MSSQLColumnInfo &info) {
+	const auto sql_type = StringUtil::Lower(info.sql_type_name);
+	return sql_type == "char" || sql_type == "varchar" || sql_type == "nchar" || sql_type == "nvarchar";
+}
+
+//------------------------------------------------------------------------------
+// Encoding
+//------------------------------------------------------------------------------
+
+static bool EncodeCondition(const JoinCondition &condition, const JoinSide &left, const JoinSide &right,
+							string &out) {
+	auto left_expr = condition.left->Copy();
+	auto right_expr = condition.right->Copy();
+	if (!left.relation.InlineProjection(left_expr) || !right.relation.InlineProjection(right_expr) ||
+		IsRemotePredicate(*left_expr) || IsRemotePredicate(*right_expr)) {
+		return false;
+	}
+	string op;
+	if (!FilterEncoder::GetComparisonOperator(condition.comparison, op)) {
+		return false;
+	}
+	auto left_sql = FilterEncoder::EncodeExpression(*left_expr, left.EncodeContext());
+	auto right_sql = FilterEncoder::EncodeExpression(*right_expr, right.EncodeContext());
+	if (!left_sql.supported || !right_sql.supported || left_sql.sql.empty() || right_sql.sql.empty()) {
+		return false;
+	}
+
+	if (left_expr->GetReturnType().InternalType() != PhysicalType::VARCHAR &&
+		right_expr->GetReturnType().InternalType() != PhysicalType::VARCHAR) {
+		out = left_sql.sql + op + right_sql.sql;
+		return true;
+	}
+	// Strings: only equality of two character columns stored alike, with the
+	// collation's match narrowed to identical bytes. The plain comparison
+	// stays first so the server can still seek on it.
+	auto left_info = TableColumnInfo(left, *left_expr);
+	auto right_info = TableColumnInfo(right, *right_expr);
+	if (condition.comparison != ExpressionType::COMPARE_EQUAL || !left_info || !right_info ||
+		!IsCharacterColumn(*left_info) || !IsCharacterColumn(*right_info) ||
+		left_info->is_unicode != right_info->is_unicode || left_info->collation_name != right_info->collation_name) {
+		return false;
+	}
+	out = "(" + left_sql.sql + " = " + right_sql.sql + " AND CAST(" + left_sql.sql +
+		  " AS VARBINARY(MAX)) = CAST(" + right_sql.sql + " AS VARBINARY(MAX)))";
+	return true;
+}
+
+// `column_only`: the null-extended side of a LEFT join. An expression its
+// projection computed (COALESCE(x, 0), a constant) would be evaluated after
+// the join on the server and turn the NULLs of unmatched rows into values.
+static bool EncodeOutput(const ColumnBinding &binding, const JoinSide &side, bool column_only, string &out_sql,
+						 LogicalType &out_type) {
+	const auto &relation = side.relation;
+	if (relation.projection && binding.table_index == relation.projection->table_index) {
+		if (binding.column_index >= relation.projection->expressions.size()) {
+			return false;
+		}
+		out_type = relation.projection->expressions[binding.column_index]->GetReturnType();
+	} else {
+		if (binding.column_index >= relation.column_ids.size()) {
+			return false;
+		}
+		const auto column = relation.column_ids[binding.column_index];
+		if (column == COLUMN_IDENTIFIER_ROW_ID || column >= relation.column_types->size()) {
+			return false;
+		}
+		out_type = (*relation.column_types)[column];
+	}
+	unique_ptr<Expression> expr = make_uniq<BoundColumnRefExpression>(out_type, binding);
+	return relation.EncodeSelectItem(expr, &side.alias, out_sql) &&
+		   (!column_only || expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF);
+}
+
+//------------------------------------------------------------------------------
+// Rewrite
+//------------------------------------------------------------------------------
+
+bool TryPushJoin(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+				 unique_ptr<LogicalOperator> &plan) {
+	if (plan->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN || plan->children.size() != 2) {
+		return false;
+	}
+	auto &join = plan->Cast<LogicalComparisonJoin>();
+	if ((join.join_type != JoinType::INNER && join.join_type != JoinType::LEFT) || join.predicate ||
+		!join.duplicate_eliminated_columns.empty() || join.conditions.empty()) {
+		return false;
+	}
+	JoinSide left;
+	JoinSide right;
+	left.alias = "l";
+	right.alias = "r";
+	if (!MSSQLRemoteRelation::Find(*join.children[0], left.relation) ||
+		!MSSQLRemoteRelation::Find(*join.children[1], right.relation) ||
+		left.relation.context_name != right.relation.context_name || !LoadJoinPushdown(input.context)) {
+		return false;
+	}
+	MSSQL_JOIN_DEBUG(1, "Detected %s join of %s and %s", JoinTypeToString(join.join_type).c_str(),
+					 left.relation.from_sql.c_str(), right.relation.from_sql.c_str());
+
+	// ON: the join conditions, at least one of them an equality
+	vector<string> on_list;
+	bool has_equality = false;
+	for (const auto &condition : join.conditions) {
+		string sql;
+		if (!EncodeCondition(condition, left, right, sql)) {
+			MSSQL_JOIN_DEBUG(1, "  condition %s: no exact encoding, keeping local join",
+							 ExpressionTypeToString(condition.comparison).c_str());
+			return false;
+		}
+		has_equality = has_equality || condition.comparison == ExpressionType::COMPARE_EQUAL;
+		on_list.push_back(sql);
+	}
+	if (!has_equality) {
+		return false;
+	}
+
+	// The right side's filters restrict it before a LEFT join, so they go into ON
+	string left_filters;
+	string right_filters;
+	if (!left.relation.EncodeFilters(&left.alias, left_filters) ||
+		!right.relation.EncodeFilters(&right.alias, right_filters)) {
+		MSSQL_JOIN_DEBUG(1, "  filters not fully pushable, keeping local join");
+		return false;
+	}
+	vector<string> where_list;
+	if (!left_filters.empty()) {
+		where_list.push_back(left_filters);
+	}
+	if (!right_filters.empty()) {
+		(join.join_type == JoinType::LEFT ? on_list : where_list).push_back(right_filters);
+	}
+
+	// Output columns, in the join's binding order
+	auto bindings = join.GetColumnBindings();
+	vector<string> select_list;
+	vector<LogicalType> types;
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		const auto &binding = bindings[i];
+		const JoinSide *side = left.Produces(binding) ? &left : right.Produces(binding) ? &right : nullptr;
+		string sql;
+		LogicalType type;
+		const bool column_only = side == &right && join.join_type == JoinType::LEFT;
+		if (!side || !EncodeOutput(binding, *side, column_only, sql, type)) {
+			MSSQL_JOIN_DEBUG(1, "  output column %llu: no exact encoding, keeping local join", (unsigned long long)i);
+			return false;
+		}
+		select_list.push_back(sql + " AS [c" + std::to_string(i) + "]");
+		types.push_back(type);
+	}
+	if (select_list.empty()) {
+		// Nothing above reads a column (COUNT(*) over the join): one the
+		// remote query needs all the same, under a binding nobody references
+		select_list.push_back("1 AS [c0]");
+		bindings.emplace_back(input.optimizer.binder.GenerateTableIndex(), 0);
+		types.push_back(LogicalType::INTEGER);
+	}
+
+	string query = "SELECT " + StringUtil::Join(select_list, ", ") + " FROM " + left.relation.FromItem(&left.alias) +
+				   (join.join_type == JoinType::LEFT ? " LEFT JOIN " : " INNER JOIN ") +
+				   right.relation.FromItem(&right.alias) + " ON " + StringUtil::Join(on_list, " AND ");
+	if (!where_list.empty()) {
+		query += " WHERE " + StringUtil::Join(where_list, " AND ");
+	}
+	MSSQL_JOIN_DEBUG(1, "  remote query: %s", query.c_str());
+
+	if (!ReplaceWithRemoteQuery(input, root, plan, left.relation.context_name, query, bindings, types)) {
+		MSSQL_JOIN_DEBUG(1, "  query not describable, keeping local join");
+		return false;
+	}
+	return true;
+}
+
+}  // namespace duckdb
@@ -27,6 +27,8 @@
 #include "mssql_storage.hpp"
 #include "table_scan/filter_encoder.hpp"
 #include "table_scan/function_mapping.hpp"
+#include "table_scan/mssql_aggregate_pushdown.hpp"
+#include "table_scan/mssql_join_pushdown.hpp"
 
 // Debug logging controlled by MSSQL_DEBUG environment variable
 static int GetOptimizerDebugLevel() {
@@ -645,16 +647,28 @@ static void TryPushTopN(ClientContext &context, unique_ptr<LogicalOperator> &pla
 //------------------------------------------------------------------------------
 // Main optimizer entry point
 //------------------------------------------------------------------------------
-void MSSQLOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
-	// Try each pattern on the current node
+static void OptimizeNode(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+						 unique_ptr<LogicalOperator> &plan) {
+	// Try each ORDER BY pattern on the current node
 	TryPushTopN(input.context, plan);
 	TryPushLimitOrderBy(input.context, plan);
 	TryPushOrderBy(input.context, plan);
 
 	// Recurse into children
 	for (auto &child : plan->children) {
-		Optimize(input, child);
+		OptimizeNode(input, root, child);
+	}
+
+	// Joins and aggregates fold bottom-up, so a join of joins, or an aggregate
+	// over one, becomes a single remote query. Both rebind the operators above
+	// them, which is why they are handed the root.
+	if (!TryPushJoin(input, root, plan)) {
+		TryPushAggregate(input, root, plan);
 	}
 }
 
+void MSSQLOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	OptimizeNode(input, plan, plan);
+}
+
 }  // namespace duckdb
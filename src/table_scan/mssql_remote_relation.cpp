@@ -0,0 +1,461 @@
+// MSSQL Optimizer Extension - relations foldable into a remote query
+//
+// The aggregate and join pushdowns both take a subtree that reads one attached
+// table (or a query an earlier pushdown built) and turn it into T-SQL. This
+// file holds the matching, filter encoding and plan replacement they share,
+// and the encoding of a whole source query that CTAS runs on the server.
+
+#include "table_scan/mssql_remote_relation.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "mssql_functions.hpp"
+
+namespace duckdb {
+
+using mssql::ExpressionEncodeContext;
+using mssql::FilterEncoder;
+
+//------------------------------------------------------------------------------
+// MSSQLRemoteRelation
+//------------------------------------------------------------------------------
+
+static bool ReadsOnlyScan(const Expression &expr, const LogicalGet &get) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		return expr.Cast<BoundColumnRefExpression>().Binding().table_index == get.table_index;
+	}
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		return false;
+	}
+	bool reads_scan = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		reads_scan = reads_scan && ReadsOnlyScan(child, get);
+	});
+	return reads_scan;
+}
+
+bool MSSQLRemoteRelation::Find(const LogicalOperator &op, MSSQLRemoteRelation &out) {
+	const LogicalOperator *node = &op;
+	out.projection = nullptr;
+	if (node->type == LogicalOperatorType::LOGICAL_PROJECTION && node->children.size() == 1) {
+		out.projection = &node->Cast<LogicalProjection>();
+		node = node->children[0].get();
+	}
+	if (node->type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = node->Cast<LogicalGet>();
+	if (!get.bind_data) {
+		return false;
+	}
+	if (get.function.name == "mssql_catalog_scan") {
+		auto &table = get.bind_data->Cast<MSSQLCatalogScanBindData>();
+		if (table.top_n > 0) {
+			return false;
+		}
+		out.context_name = table.context_name;
+		out.from_sql = "[" + FilterEncoder::EscapeBracketIdentifier(table.schema_name) + "].[" +
+					   FilterEncoder::EscapeBracketIdentifier(table.table_name) + "]";
+		out.table = &table;
+		out.column_names = &table.all_column_names;
+		out.column_types = &table.all_types;
+	} else if (get.function.name == "mssql_scan") {
+		// Only queries a pushdown built: a user's query may not be valid as a derived table
+		auto &scan = get.bind_data->Cast<MSSQLScanBindData>();
+		if (!scan.pushed_down || !scan.range_queries.empty()) {
+			return false;
+		}
+		out.context_name = scan.context_name;
+		out.from_sql = "(" + scan.query + ")";
+		out.table = nullptr;
+		out.column_names = &scan.column_names;
+		out.column_types = &scan.return_types;
+	} else {
+		return false;
+	}
+	out.get = &get;
+	out.column_ids.clear();
+	for (const auto &col_idx : get.GetColumnIds()) {
+		out.column_ids.push_back(col_idx.IsVirtualColumn() ? COLUMN_IDENTIFIER_ROW_ID : col_idx.GetPrimaryIndex());
+	}
+	return true;
+}
+
+string MSSQLRemoteRelation::FromItem(const string *alias) const {
+	if (alias) {
+		return from_sql + " AS [" + FilterEncoder::EscapeBracketIdentifier(*alias) + "]";
+	}
+	return table ? from_sql : from_sql + " AS [t]";
+}
+
+ExpressionEncodeContext MSSQLRemoteRelation::EncodeContext(const string *alias) const {
+	ExpressionEncodeContext ctx(column_ids, *column_names, *column_types);
+	if (table && !table->pk_column_names.empty()) {
+		ctx.SetPKInfo(&table->pk_column_names, &table->pk_column_types, table->pk_is_composite);
+	}
+	ctx.table_alias = alias;
+	return ctx;
+}
+
+bool MSSQLRemoteRelation::InlineProjection(unique_ptr<Expression> &expr) const {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		const auto &binding = expr->Cast<BoundColumnRefExpression>().Binding();
+		if (binding.table_index == get->table_index) {
+			return true;
+		}
+		if (!projection || binding.table_index != projection->table_index ||
+			binding.column_index >= projection->expressions.size()) {
+			return false;
+		}
+		expr = projection->expressions[binding.column_index]->Copy();
+		// A projection only reads the scan below it
+		return ReadsOnlyScan(*expr, *get);
+	}
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		return false;
+	}
+	bool resolved = true;
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		if (resolved) {
+			resolved = InlineProjection(child);
+		}
+	});
+	return resolved;
+}
+
+bool MSSQLRemoteRelation::ResolveColumn(const Expression &expr, column_t &out_column) const {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return false;
+	}
+	const auto &binding = expr.Cast<BoundColumnRefExpression>().Binding();
+	if (binding.table_index != get->table_index || binding.column_index >= column_ids.size()) {
+		return false;
+	}
+	const auto column = column_ids[binding.column_index];
+	if (column == COLUMN_IDENTIFIER_ROW_ID || column >= column_names->size()) {
+		return false;
+	}
+	out_column = column;
+	return true;
+}
+
+bool MSSQLRemoteRelation::EncodeSelectItem(unique_ptr<Expression> &expr, const string *alias,
+										   string &out_sql) const {
+	if (!InlineProjection(expr) || IsRemotePredicate(*expr)) {
+		return false;
+	}
+	// The table scan converts these in its own SELECT list
+	column_t column;
+	if (table && ResolveColumn(*expr, column) && column < table->mssql_columns.size()) {
+		const auto &info = table->mssql_columns[column];
+		if (info.is_geometry || info.is_cast_required) {
+			return false;
+		}
+	}
+	auto encoded = FilterEncoder::EncodeExpression(*expr, EncodeContext(alias));
+	if (!encoded.supported || encoded.sql.empty()) {
+		return false;
+	}
+	out_sql = encoded.sql;
+	return true;
+}
+
+bool MSSQLRemoteRelation::EncodeFilters(const string *alias, string &out_condition) const {
+	auto encoded =
+		FilterEncoder::Encode(&get->table_filters, column_ids, *column_names, *column_types, nullptr, alias);
+	if (encoded.needs_duckdb_filter || !encoded.unhandled.empty()) {
+		return false;
+	}
+	out_condition = encoded.where_clause;
+	// The complex filter clause was encoded unqualified, for the table alone
+	if (table && !table->complex_filter_where_clause.empty()) {
+		if (alias) {
+			return false;
+		}
+		if (!out_condition.empty()) {
+			out_condition += " AND ";
+		}
+		out_condition += table->complex_filter_where_clause;
+	}
+	return true;
+}
+
+bool IsRemotePredicate(const Expression &expr) {
+	auto expression_class = expr.GetExpressionClass();
+	return expr.GetReturnType().id() == LogicalTypeId::BOOLEAN &&
+		   expression_class != ExpressionClass::BOUND_COLUMN_REF && expression_class != ExpressionClass::BOUND_REF;
+}
+
+//------------------------------------------------------------------------------
+// Whole source queries
+//------------------------------------------------------------------------------
+
+bool InlineResolvedProjections(unique_ptr<Expression> &expr, const vector<const LogicalProjection *> &projections,
+							   idx_t level) {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		return false;
+	}
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		if (level == projections.size()) {
+			return true;
+		}
+		auto index = expr->Cast<BoundReferenceExpression>().Index();
+		auto &expressions = projections[level]->expressions;
+		if (index >= expressions.size()) {
+			return false;
+		}
+		expr = expressions[index]->Copy();
+		return InlineResolvedProjections(expr, projections, level + 1);
+	}
+	bool supported = true;
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		if (supported) {
+			supported = InlineResolvedProjections(child, projections, level);
+		}
+	});
+	return supported;
+}
+
+// Signed integer types by width, 0 for any other
+static int SignedIntegerRank(LogicalTypeId id) {
+	switch (id) {
+	case LogicalTypeId::TINYINT:
+		return 1;
+	case LogicalTypeId::SMALLINT:
+		return 2;
+	case LogicalTypeId::INTEGER:
+		return 3;
+	case LogicalTypeId::BIGINT:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+// Decimal digits an integer type needs, 0 for any other
+static uint8_t IntegerDigits(LogicalTypeId id) {
+	switch (id) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::UTINYINT:
+		return 3;
+	case LogicalTypeId::SMALLINT:
+		return 5;
+	case LogicalTypeId::INTEGER:
+		return 10;
+	case LogicalTypeId::BIGINT:
+		return 19;
+	default:
+		return 0;
+	}
+}
+
+// Every value of `from` converts to `to` exactly, so SQL Server's implicit
+// conversion into a `to` column gives what DuckDB's cast would
+static bool IsLosslessWidening(const LogicalType &from, const LogicalType &to) {
+	const auto source = from.id();
+	switch (to.id()) {
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		if (source == LogicalTypeId::UTINYINT) {
+			return true;
+		}
+		return SignedIntegerRank(source) > 0 && SignedIntegerRank(source) <= SignedIntegerRank(to.id());
+	case LogicalTypeId::DOUBLE:
+		return source == LogicalTypeId::FLOAT || source == LogicalTypeId::UTINYINT ||
+			   (SignedIntegerRank(source) > 0 && SignedIntegerRank(source) <= 3);
+	case LogicalTypeId::DECIMAL: {
+		const int to_integral = DecimalType::GetWidth(to) - DecimalType::GetScale(to);
+		if (source == LogicalTypeId::DECIMAL) {
+			return to_integral >= DecimalType::GetWidth(from) - DecimalType::GetScale(from) &&
+				   DecimalType::GetScale(to) >= DecimalType::GetScale(from);
+		}
+		const auto digits = IntegerDigits(source);
+		return digits > 0 && to_integral >= digits;
+	}
+	case LogicalTypeId::TIMESTAMP:
+		return source == LogicalTypeId::DATE;
+	default:
+		return false;
+	}
+}
+
+bool EncodeRemoteSelect(const LogicalOperator &op, const vector<idx_t> *columns, const string *database,
+						string &out_context_name, string &out_query) {
+	vector<const LogicalProjection *> projections;
+	const LogicalOperator *node = &op;
+	while (node->type == LogicalOperatorType::LOGICAL_PROJECTION && node->children.size() == 1) {
+		projections.push_back(&node->Cast<LogicalProjection>());
+		node = node->children[0].get();
+	}
+	MSSQLRemoteRelation relation;
+	if (!MSSQLRemoteRelation::Find(*node, relation) || (database && !relation.table)) {
+		return false;
+	}
+
+	// FROM-item column behind each output of the scan (column_ids through projection_ids)
+	const auto &get = *relation.get;
+	vector<column_t> output_columns;
+	if (get.projection_ids.empty()) {
+		output_columns = relation.column_ids;
+	} else {
+		for (auto projection_id : get.projection_ids) {
+			output_columns.push_back(projection_id < relation.column_ids.size() ? relation.column_ids[projection_id]
+																				: COLUMN_IDENTIFIER_ROW_ID);
+		}
+	}
+	for (auto column : output_columns) {
+		if (column == COLUMN_IDENTIFIER_ROW_ID || column >= relation.column_names->size()) {
+			return false;
+		}
+		// The table scan converts these in its own SELECT list
+		if (relation.table && column < relation.table->mssql_columns.size()) {
+			const auto &info = relation.table->mssql_columns[column];
+			if (info.is_geometry || info.is_cast_required) {
+				return false;
+			}
+		}
+	}
+
+	const idx_t width = projections.empty() ? output_columns.size() : projections[0]->expressions.size();
+	vector<idx_t> picked;
+	if (columns) {
+		picked = *columns;
+	} else {
+		for (idx_t i = 0; i < width; i++) {
+			picked.push_back(i);
+		}
+	}
+	if (picked.empty()) {
+		return false;
+	}
+
+	ExpressionEncodeContext ctx(output_columns, *relation.column_names, *relation.column_types);
+	if (relation.table && !relation.table->pk_column_names.empty()) {
+		ctx.SetPKInfo(&relation.table->pk_column_names, &relation.table->pk_column_types,
+					  relation.table->pk_is_composite);
+	}
+	ctx.bound_refs_are_columns = true;
+
+	vector<string> select_list;
+	for (auto index : picked) {
+		if (index >= width) {
+			return false;
+		}
+		unique_ptr<Expression> expr;
+		if (projections.empty()) {
+			expr = make_uniq<BoundReferenceExpression>((*relation.column_types)[output_columns[index]], index);
+		} else {
+			expr = projections[0]->expressions[index]->Copy();
+			if (!InlineResolvedProjections(expr, projections, 1)) {
+				return false;
+			}
+		}
+		while (BoundCastExpression::IsCast(*expr)) {
+			const auto &child = BoundCastExpression::Child(*expr);
+			if (!IsLosslessWidening(child.GetReturnType(), BoundCastExpression::TargetType(*expr))) {
+				break;
+			}
+			expr = child.Copy();
+		}
+		if (IsRemotePredicate(*expr)) {
+			return false;
+		}
+		auto encoded = FilterEncoder::EncodeExpression(*expr, ctx);
+		if (!encoded.supported || encoded.sql.empty()) {
+			return false;
+		}
+		select_list.push_back(encoded.sql);
+	}
+	string where;
+	if (!relation.EncodeFilters(nullptr, where)) {
+		return false;
+	}
+	out_context_name = relation.context_name;
+	string from_item = relation.FromItem(nullptr);
+	if (database) {
+		from_item = "[" + FilterEncoder::EscapeBracketIdentifier(*database) + "]." + from_item;
+	}
+	out_query = "SELECT " + StringUtil::Join(select_list, ", ") + " FROM " + from_item;
+	if (!where.empty()) {
+		out_query += " WHERE " + where;
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Plan replacement
+//------------------------------------------------------------------------------
+
+bool ReplaceWithRemoteQuery(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+							unique_ptr<LogicalOperator> &plan, const string &context_name, const string &query,
+							const vector<ColumnBinding> &bindings, const vector<LogicalType> &types) {
+	auto &context = input.context;
+
+	// The remote column types come from the server's description of the query
+	unique_ptr<MSSQLScanBindData> scan_data;
+	try {
+		scan_data = DescribeMSSQLScanQuery(context, context_name, query);
+	} catch (const std::exception &) {
+		return false;
+	}
+	if (!scan_data || scan_data->return_types.size() != types.size()) {
+		return false;
+	}
+	// The remote scan decodes every datetime2 as µs TIMESTAMP (the result
+	// stream's wire mapping). A datetime2(7) column the replaced operator
+	// produced as TIMESTAMP_NS would lose its 100-ns digit, so such an output
+	// stays local; every other type casts back without loss.
+	for (idx_t i = 0; i < types.size(); i++) {
+		if (types[i].id() == LogicalTypeId::TIMESTAMP_NS &&
+			scan_data->return_types[i].id() != LogicalTypeId::TIMESTAMP_NS) {
+			return false;
+		}
+	}
+
+	auto &binder = input.optimizer.binder;
+	const auto remote_types = scan_data->return_types;
+	vector<Identifier> remote_names;
+	for (const auto &name : scan_data->column_names) {
+		remote_names.emplace_back(name);
+	}
+	const auto get_index = binder.GenerateTableIndex();
+	auto remote_get = make_uniq<LogicalGet>(get_index, GetMSSQLScanFunction(), std::move(scan_data), remote_types,
+											std::move(remote_names));
+	for (idx_t i = 0; i < remote_types.size(); i++) {
+		remote_get->AddColumnId(i);
+	}
+
+	// Cast each remote column to the type the replaced operator produced
+	vector<unique_ptr<Expression>> outputs;
+	for (idx_t i = 0; i < remote_types.size(); i++) {
+		auto column = make_uniq<BoundColumnRefExpression>(remote_types[i], ColumnBinding(get_index, i));
+		outputs.push_back(BoundCastExpression::AddCastToType(context, std::move(column), types[i]));
+	}
+	const auto projection_index = binder.GenerateTableIndex();
+	auto result = make_uniq<LogicalProjection>(projection_index, std::move(outputs));
+	if (plan->has_estimated_cardinality) {
+		remote_get->SetEstimatedCardinality(plan->estimated_cardinality);
+		result->SetEstimatedCardinality(plan->estimated_cardinality);
+	}
+	result->children.push_back(std::move(remote_get));
+
+	// Everything above read the replaced operator's bindings
+	ColumnBindingReplacer replacer;
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		replacer.replacement_bindings.emplace_back(bindings[i], ColumnBinding(projection_index, i));
+	}
+	plan = std::move(result);
+	replacer.stop_operator = plan.get();
+	replacer.VisitOperator(*root);
+	return true;
+}
+
+}  // namespace duckdb
@@ -6,21 +6,36 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include "catalog/mssql_catalog.hpp"
 #include "catalog/mssql_table_entry.hpp"
+#include "connection/mssql_connection_provider.hpp"
 #include "connection/mssql_settings.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/common.hpp"	 // For COLUMN_IDENTIFIER_ROW_ID
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/common/table_column.hpp"  // For TableColumn, virtual_column_map_t
 #include "duckdb/common/vector/flat_vector.hpp"
 #include "duckdb/common/vector/struct_vector.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "mssql_functions.hpp"	// For backward compatibility with MSSQLCatalogScanBindData
 #include "query/mssql_query_executor.hpp"
+#include "query/mssql_simple_query.hpp"
 #include "table_scan/filter_encoder.hpp"
+#include "table_scan/filter_parameters.hpp"
+#include "table_scan/partition_scan_policy.hpp"
+#include "table_scan/scan_range_policy.hpp"
 #include "table_scan/table_scan_bind.hpp"
 #include "table_scan/table_scan_state.hpp"
 
@@ -214,6 +229,419 @@ static unique_ptr<FunctionData> TableScanBind(ClientContext &context, TableFunct
 	throw InternalException("TableScanBind should not be called directly");
 }
 
+//------------------------------------------------------------------------------
+// Parallel Key-Range Scan
+//------------------------------------------------------------------------------
+
+// Leading key column of the table's clustered ROWSTORE index, when it is an
+// integer (by system type, so an alias type over int qualifies too).
+//
+// Only the clustered key will do. A range predicate on it is a seek over one
+// contiguous slice of the table; on any other column — a non-clustered identity
+// on a heap, say — each range's plan scans the whole table with a residual
+// predicate, and N ranges read it N times over N connections. A heap or a
+// clustered columnstore (index_id 1, type 5) therefore stays on one stream.
+static const char *RANGE_KEY_SQL_TEMPLATE = R"(
+SELECT TOP 1 c.name
+FROM sys.indexes i
+INNER JOIN sys.index_columns ic ON ic.object_id = i.object_id AND ic.index_id = i.index_id
+INNER JOIN sys.columns c ON c.object_id = ic.object_id AND c.column_id = ic.column_id
+WHERE i.object_id = OBJECT_ID(N'%s')
+  AND i.index_id = 1
+  AND i.type = 1
+  AND ic.key_ordinal = 1
+  AND c.system_type_id IN (48, 52, 56, 127)
+)";
+
+struct RangeKeyBounds {
+	string column;
+	int64_t min_key = 0;
+	int64_t max_key = 0;
+};
+
+// Find the range key and its current MIN/MAX. Returns false when the table has
+// no usable key or is empty; the caller then scans on one stream. Both lookups
+// are O(1) on the clustered index — MIN/MAX of a leading key is two seeks.
+static bool DiscoverRangeKey(tds::TdsConnection &connection, const string &full_table_name, RangeKeyBounds &out) {
+	const string object_literal = StringUtil::Replace(full_table_name, "'", "''");
+	char sql_buffer[1024];
+	snprintf(sql_buffer, sizeof(sql_buffer), RANGE_KEY_SQL_TEMPLATE, object_literal.c_str());
+	auto key_result = MSSQLSimpleQuery::Execute(connection, sql_buffer);
+	if (key_result.HasError() || !key_result.HasRows() || key_result.rows[0].empty() ||
+		key_result.rows[0][0].empty()) {
+		return false;
+	}
+	out.column = key_result.rows[0][0];
+
+	const string quoted_key = "[" + FilterEncoder::EscapeBracketIdentifier(out.column) + "]";
+	const string bounds_sql = "SELECT CAST(MIN(" + quoted_key + ") AS BIGINT), CAST(MAX(" + quoted_key +
+							  ") AS BIGINT) FROM " + full_table_name;
+	auto bounds_result = MSSQLSimpleQuery::Execute(connection, bounds_sql);
+	if (bounds_result.HasError() || !bounds_result.HasRows() || bounds_result.rows[0].size() < 2) {
+		return false;
+	}
+	const auto &row = bounds_result.rows[0];
+	if (row[0].empty() || row[1].empty()) {
+		return false;  // Empty table (MIN/MAX are NULL)
+	}
+	try {
+		out.min_key = std::stoll(row[0]);
+		out.max_key = std::stoll(row[1]);
+	} catch (...) {
+		return false;
+	}
+	return out.max_key >= out.min_key;
+}
+
+// May this scan run as several streams (key ranges or partition groups)? Only
+// the plain scan shape qualifies:
+//   - no rowid: the DML paths that project it expect one ordered pass, and the
+//     rowid column mapping is set up on a single stream;
+//   - no TOP / ORDER BY pushdown: both are whole-result properties;
+//   - no client-side filters: their ExpressionExecutors are not thread-safe;
+//   - no explicit transaction: the pinned connection is the only one that sees
+//     the transaction's own writes, and there is exactly one of it.
+// `mssql_scan_parallel_ranges = 1` turns every split off.
+static bool ScanMaySplit(ClientContext &context, const MSSQLCatalogScanBindData &bind_data, bool rowid_requested,
+						 const MSSQLScanGlobalState &state, MSSQLCatalog &mssql_catalog) {
+	if (rowid_requested || bind_data.top_n > 0 || !bind_data.order_by_clause.empty() ||
+		!state.client_filters.empty()) {
+		return false;
+	}
+	if (LoadScanParallelRanges(context) == 1) {
+		return false;
+	}
+	if (ConnectionProvider::IsInTransaction(context, mssql_catalog)) {
+		MSSQL_SCAN_DEBUG_LOG(1, "ScanMaySplit: explicit transaction - single stream on the pinned connection");
+		return false;
+	}
+	return true;
+}
+
+// Connections the pool can still hand out before Acquire() starts blocking.
+static uint64_t PoolHeadroom(ClientContext &context, MSSQLCatalog &mssql_catalog) {
+	const auto pool_config = LoadPoolConfig(context);
+	const auto pool_stats = mssql_catalog.GetConnectionPool().GetStats();
+	return pool_config.connection_limit > pool_stats.active_connections
+			   ? pool_config.connection_limit - pool_stats.active_connections
+			   : 0;
+}
+
+// Resolve, on the client thread, what the worker threads need to open streams.
+static void PrepareSplitScan(ClientContext &context, MSSQLCatalog &mssql_catalog, MSSQLScanGlobalState &state) {
+	state.pool_handle = mssql_catalog.GetConnectionPoolHandle();
+	state.query_timeout_seconds = LoadQueryTimeout(context);
+	state.reset_on_release = ConnectionProvider::ShouldResetOnRelease(context);
+	state.read_ahead_packets = LoadScanReadAhead(context);
+}
+
+// Decide whether this scan runs as N key ranges and, if so, return one T-SQL
+// predicate per range (empty = single stream). Everything the ranges need
+// later is resolved here, on the client thread.
+static vector<string> PlanKeyRanges(ClientContext &context, const MSSQLCatalogScanBindData &bind_data,
+									const string &full_table_name, bool rowid_requested,
+									MSSQLScanGlobalState &state) {
+	vector<string> predicates;
+	auto &mssql_catalog = Catalog::GetCatalog(context, Identifier(bind_data.context_name)).Cast<MSSQLCatalog>();
+	if (!ScanMaySplit(context, bind_data, rowid_requested, state, mssql_catalog)) {
+		return predicates;
+	}
+	const int64_t configured = LoadScanParallelRanges(context);
+
+	auto &pool = mssql_catalog.GetConnectionPool();
+	const uint64_t headroom = PoolHeadroom(context, mssql_catalog);
+	const uint64_t thread_count = static_cast<uint64_t>(context.db->NumberOfThreads());
+	const uint64_t min_rows = static_cast<uint64_t>(LoadScanParallelMinRows(context));
+
+	// Cheap ceiling first: without the statistics cache we would pay for a
+	// connection before learning the table is too small to split.
+	auto &stats_provider = mssql_catalog.GetStatisticsProvider();
+	idx_t row_count = 0;
+	const bool have_cached_count =
+		stats_provider.TryGetCachedRowCount(bind_data.schema_name, bind_data.table_name, row_count);
+	if (have_cached_count &&
+		MSSQLResolveScanRangeCount(configured, thread_count, headroom, row_count, min_rows, UINT64_MAX) < 2) {
+		return predicates;
+	}
+
+	auto connection = pool.Acquire(state.acquire_timeout_ms);
+	if (!connection) {
+		return predicates;	// Pool exhausted: splitting would only queue behind it
+	}
+	RangeKeyBounds key;
+	bool have_key = false;
+	try {
+		if (!have_cached_count) {
+			row_count = stats_provider.GetRowCount(*connection, bind_data.schema_name, bind_data.table_name);
+		}
+		have_key = DiscoverRangeKey(*connection, full_table_name, key);
+	} catch (...) {
+		pool.Release(std::move(connection));
+		throw;
+	}
+	pool.Release(std::move(connection));
+	if (!have_key) {
+		MSSQL_SCAN_DEBUG_LOG(1, "PlanKeyRanges: no integer clustered key - single stream");
+		return predicates;
+	}
+
+	const uint64_t span = static_cast<uint64_t>(key.max_key) - static_cast<uint64_t>(key.min_key);
+	const uint64_t key_span = span == UINT64_MAX ? UINT64_MAX : span + 1;
+	const uint64_t ranges =
+		MSSQLResolveScanRangeCount(configured, thread_count, headroom, row_count, min_rows, key_span);
+	const auto bounds = MSSQLSplitKeyRange(key.min_key, key.max_key, ranges);
+	const string quoted_key = "[" + FilterEncoder::EscapeBracketIdentifier(key.column) + "]";
+	predicates = MSSQLBuildKeyRangePredicates(quoted_key, bounds);
+	if (predicates.size() < 2) {
+		predicates.clear();
+		return predicates;
+	}
+
+	PrepareSplitScan(context, mssql_catalog, state);
+	MSSQL_SCAN_DEBUG_LOG(1, "PlanKeyRanges: %zu ranges on [%s] in [%lld, %lld] (rows~%llu, headroom=%llu)",
+						 predicates.size(), key.column.c_str(), (long long)key.min_key, (long long)key.max_key,
+						 (unsigned long long)row_count, (unsigned long long)headroom);
+	return predicates;
+}
+
+//------------------------------------------------------------------------------
+// Partition-Aligned Scan
+//------------------------------------------------------------------------------
+
+// Narrow `interval` by one comparison `<partition column> <op> constant`. The
+// constant is cast to the partitioning column's type; against a bare column
+// reference the binder has already done that, so a failed cast is a shape we
+// do not read rather than an error.
+static void NarrowPartitionInterval(MSSQLPartitionKeyInterval<Value> &interval, ExpressionType op, Value constant,
+									const LogicalType &column_type) {
+	if (constant.IsNull() || !constant.DefaultTryCastAs(column_type, true)) {
+		return;
+	}
+	switch (op) {
+	case ExpressionType::COMPARE_EQUAL:
+		interval.NarrowLower(constant, true);
+		interval.NarrowUpper(constant, true);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		interval.NarrowLower(constant, false);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		interval.NarrowLower(constant, true);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		interval.NarrowUpper(constant, false);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		interval.NarrowUpper(constant, true);
+		break;
+	default:
+		break;
+	}
+}
+
+// Table column index of projected column `projected`, mapped through the
+// LogicalGet's column ids the same way EncodeColumnRef maps it.
+static idx_t TableColumnIndex(idx_t projected, const vector<column_t> &column_ids) {
+	if (column_ids.empty()) {
+		return projected;
+	}
+	return projected < column_ids.size() ? column_ids[projected] : DConstants::INVALID_INDEX;
+}
+
+static bool IsPartitionColumnRef(const Expression &expr, const vector<column_t> &column_ids,
+								 const MSSQLCatalogScanBindData &bind_data) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return false;
+	}
+	const idx_t projected = expr.Cast<BoundColumnRefExpression>().Binding().column_index;
+	return TableColumnIndex(projected, column_ids) == bind_data.partition_column_index;
+}
+
+static bool IsConstant(const Expression &expr) {
+	return expr.GetExpressionClass() == ExpressionClass::BOUND_CONSTANT;
+}
+
+// Fold one filter conjunct into the partition interval. Only what certainly
+// restricts the partitioning column counts — a comparison with a constant,
+// BETWEEN, and AND of those. Anything else (OR, a cast or function over the
+// column) leaves the interval as it was, which can only keep partitions.
+static void CollectPartitionBounds(const Expression &expr, const vector<column_t> &column_ids,
+								   const MSSQLCatalogScanBindData &bind_data,
+								   MSSQLPartitionKeyInterval<Value> &interval) {
+	const auto &column_type = bind_data.partition_info.column_type;
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_CONJUNCTION) {
+		if (expr.GetExpressionType() == ExpressionType::CONJUNCTION_AND) {
+			for (const auto &child : expr.Cast<BoundConjunctionExpression>().GetChildren()) {
+				CollectPartitionBounds(*child, column_ids, bind_data, interval);
+			}
+		}
+		return;
+	}
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return;
+	}
+	const auto &func_expr = expr.Cast<BoundFunctionExpression>();
+	if (BoundComparisonExpression::IsComparison(expr)) {
+		const auto &left = BoundComparisonExpression::Left(func_expr);
+		const auto &right = BoundComparisonExpression::Right(func_expr);
+		if (IsPartitionColumnRef(left, column_ids, bind_data) && IsConstant(right)) {
+			NarrowPartitionInterval(interval, expr.GetExpressionType(),
+									right.Cast<BoundConstantExpression>().GetValue(), column_type);
+		} else if (IsPartitionColumnRef(right, column_ids, bind_data) && IsConstant(left)) {
+			NarrowPartitionInterval(interval, FlipComparisonExpression(expr.GetExpressionType()),
+									left.Cast<BoundConstantExpression>().GetValue(), column_type);
+		}
+		return;
+	}
+	if (expr.GetExpressionType() == ExpressionType::COMPARE_BETWEEN) {
+		const auto &input = BoundBetweenExpression::Input(func_expr);
+		const auto &lower = BoundBetweenExpression::LowerBound(func_expr);
+		const auto &upper = BoundBetweenExpression::UpperBound(func_expr);
+		if (!IsPartitionColumnRef(input, column_ids, bind_data) || !IsConstant(lower) || !IsConstant(upper)) {
+			return;
+		}
+		NarrowPartitionInterval(interval,
+								BoundBetweenExpression::LowerInclusive(func_expr)
+									? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+									: ExpressionType::COMPARE_GREATERTHAN,
+								lower.Cast<BoundConstantExpression>().GetValue(), column_type);
+		NarrowPartitionInterval(interval,
+								BoundBetweenExpression::UpperInclusive(func_expr)
+									? ExpressionType::COMPARE_LESSTHANOREQUALTO
+									: ExpressionType::COMPARE_LESSTHAN,
+								upper.Cast<BoundConstantExpression>().GetValue(), column_type);
+	}
+}
+
+// The same for the TableFilterSet DuckDB hands InitGlobal: constant
+// comparisons on the partitioning column narrow the interval too.
+static void CollectPartitionTableFilters(const TableFilterSet *filters, const vector<column_t> &column_ids,
+										 const MSSQLCatalogScanBindData &bind_data,
+										 MSSQLPartitionKeyInterval<Value> &interval) {
+	if (!filters) {
+		return;
+	}
+	for (const auto &filter_entry : *filters) {
+		if (TableColumnIndex(filter_entry.GetIndex(), column_ids) != bind_data.partition_column_index) {
+			continue;
+		}
+		const auto &filter = filter_entry.Filter();
+		if (filter.filter_type == TableFilterType::LEGACY_CONSTANT_COMPARISON) {
+			const auto &constant_filter = filter.Cast<LegacyConstantFilter>();
+			NarrowPartitionInterval(interval, constant_filter.comparison_type, constant_filter.constant,
+									bind_data.partition_info.column_type);
+		}
+	}
+}
+
+// Partition-aligned plan for a table on a partition scheme. Returns
+//   - two or more predicates: one per partition group, each drained on its own
+//     connection exactly like a key range;
+//   - one predicate: the scan stays on one stream, restricted to the
+//     partitions the filters left;
+//   - none: not partitioned, disabled, or nothing pruned and nothing to split.
+// Pruning costs no round trip: the boundaries were cached on the table entry
+// when it was first bound.
+static vector<string> PlanPartitionRanges(ClientContext &context, const MSSQLCatalogScanBindData &bind_data,
+										  const TableFilterSet *filters, const vector<column_t> &column_ids,
+										  bool rowid_requested, MSSQLScanGlobalState &state) {
+	vector<string> predicates;
+	const auto &info = bind_data.partition_info;
+	if (!info.exists || bind_data.partition_column_index == DConstants::INVALID_INDEX ||
+		!LoadScanPartitionAligned(context)) {
+		return predicates;
+	}
+
+	vector<uint64_t> partitions;
+	if (info.CanPrune()) {
+		auto interval = bind_data.partition_filter;
+		CollectPartitionTableFilters(filters, column_ids, bind_data, interval);
+		partitions = MSSQLPrunePartitions<Value>(info.partition_count, info.boundaries, info.range_right, interval);
+	} else {
+		for (uint64_t k = 1; k <= info.partition_count; k++) {
+			partitions.push_back(k);
+		}
+	}
+	if (partitions.empty()) {
+		// Contradictory filters: the server answers that without reading a page
+		return predicates;
+	}
+	const bool pruned = partitions.size() < info.partition_count;
+
+	auto &mssql_catalog = Catalog::GetCatalog(context, Identifier(bind_data.context_name)).Cast<MSSQLCatalog>();
+	uint64_t streams = 1;
+	if (ScanMaySplit(context, bind_data, rowid_requested, state, mssql_catalog)) {
+		// Up to every connection the pool can still hand out; an explicit
+		// mssql_scan_parallel_ranges caps it lower.
+		streams = PoolHeadroom(context, mssql_catalog);
+		const int64_t configured = LoadScanParallelRanges(context);
+		if (configured > 0 && static_cast<uint64_t>(configured) < streams) {
+			streams = static_cast<uint64_t>(configured);
+		}
+		// Size floor, on the surviving partitions' share of the cached count.
+		// No count cached means no cap: learning it would cost the round trip
+		// partition pruning exists to avoid.
+		idx_t row_count = 0;
+		if (mssql_catalog.GetStatisticsProvider().TryGetCachedRowCount(bind_data.schema_name, bind_data.table_name,
+																		row_count)) {
+			const uint64_t min_rows = static_cast<uint64_t>(LoadScanParallelMinRows(context));
+			const uint64_t surviving_rows = row_count / info.partition_count * partitions.size();
+			if (streams > surviving_rows / min_rows) {
+				streams = surviving_rows / min_rows;
+			}
+		}
+	}
+
+	const string partition_expr = "$PARTITION.[" + FilterEncoder::EscapeBracketIdentifier(info.function_name) +
+								  "]([" + FilterEncoder::EscapeBracketIdentifier(info.column_name) + "])";
+	const auto groups = MSSQLGroupPartitions(partitions, streams);
+	if (groups.size() < 2) {
+		if (pruned) {
+			predicates.push_back(MSSQLBuildPartitionPredicate(partition_expr, partitions));
+			MSSQL_SCAN_DEBUG_LOG(1, "PlanPartitionRanges: single stream over %zu of %llu partitions",
+								 partitions.size(), (unsigned long long)info.partition_count);
+		}
+		return predicates;
+	}
+	for (const auto &group : groups) {
+		predicates.push_back(MSSQLBuildPartitionPredicate(partition_expr, group));
+	}
+
+	PrepareSplitScan(context, mssql_catalog, state);
+	MSSQL_SCAN_DEBUG_LOG(1, "PlanPartitionRanges: %zu of %llu partitions on %zu streams by %s", partitions.size(),
+						 (unsigned long long)info.partition_count, predicates.size(), partition_expr.c_str());
+	return predicates;
+}
+
+// Open the stream for one key range or partition group on its own pooled
+// connection. Runs on a worker thread, so it uses only what the planner
+// resolved on the client thread.
+static unique_ptr<MSSQLResultStream> OpenRangeStream(MSSQLScanGlobalState &state, idx_t range) {
+	auto pool = state.pool_handle.lock();
+	if (!pool) {
+		throw IOException("MSSQL scan: context '%s' was detached during a parallel scan", state.context_name);
+	}
+	auto connection = pool->Acquire(state.acquire_timeout_ms);
+	if (!connection) {
+		throw IOException("MSSQL scan: no connection for range %llu of a parallel scan within %d ms "
+						  "(lower mssql_scan_parallel_ranges or raise mssql_connection_limit)",
+						  (unsigned long long)range, state.acquire_timeout_ms);
+	}
+	// If Initialize() throws, the stream destructor returns the connection.
+	auto stream = make_uniq<MSSQLResultStream>(std::move(connection), state.range_queries[range], state.context_name,
+											   state.pool_handle, false, state.query_timeout_seconds,
+											   state.reset_on_release);
+	stream->SetReadAhead(state.read_ahead_packets);
+	stream->SetParameters(state.filter_parameters);
+	if (!stream->Initialize()) {
+		throw IOException("MSSQL scan: failed to initialize the stream for range %llu", (unsigned long long)range);
+	}
+	stream->SetColumnsToFill(state.projected_column_count);
+	MSSQL_SCAN_DEBUG_LOG(1, "OpenRangeStream: range %llu -> %s", (unsigned long long)range,
+						 state.range_queries[range].c_str());
+	return stream;
+}
+
 //------------------------------------------------------------------------------
 // Init Functions
 //------------------------------------------------------------------------------
@@ -427,14 +855,20 @@ static unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &c
 	// Combine: simple filters (from FilterEncoder::Encode) + complex filters (from pushdown_complex_filter)
 	std::vector<std::string> where_conditions;
 	bool needs_duckdb_filter = false;
+	FilterParameters filter_params;
 
-	// 1. Encode simple filters (TableFilterSet from filter_pushdown)
+	// 1. Encode simple filters (TableFilterSet from filter_pushdown). On the
+	// probe side of a hash join this runs when the probe pipeline is scheduled,
+	// after the build finished, so the set includes the join's runtime filters
+	// (min/max and, for a small build, an optional IN set).
 	if (input.filters && input.filters->HasFilters()) {
 		MSSQL_SCAN_DEBUG_LOG(1, "TableScanInitGlobal: simple filter pushdown with %zu filter(s)",
 							 static_cast<size_t>(input.filters->FilterCount()));
 
 		auto encode_result =
-			FilterEncoder::Encode(input.filters.get(), column_ids, bind_data.all_column_names, bind_data.all_types);
+			FilterEncoder::Encode(input.filters.get(), column_ids, bind_data.all_column_names, bind_data.all_types,
+								  LoadScanParameterizeFilters(context) ? &filter_params : nullptr, nullptr,
+								  LoadJoinFilterMaxIn(context));
 
 		if (!encode_result.where_clause.empty()) {
 			where_conditions.push_back(encode_result.where_clause);
@@ -490,17 +924,52 @@ static unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &c
 	}
 
 	// 3. Combine all conditions with AND
+	std::string combined_where;
 	if (!where_conditions.empty()) {
-		std::string combined_where;
 		for (idx_t i = 0; i < where_conditions.size(); i++) {
 			if (i > 0) {
 				combined_where += " AND ";
 			}
 			combined_where += where_conditions[i];
 		}
-		query += " WHERE " + combined_where;
 		MSSQL_SCAN_DEBUG_LOG(1, "TableScanInitGlobal: final WHERE clause: %s", combined_where.c_str());
 	}
+	if (filter_params.Count() > 0) {
+		result->filter_parameters = filter_params.Get();
+		MSSQL_SCAN_DEBUG_LOG(1, "TableScanInitGlobal: %llu filter parameter(s): %s",
+							 (unsigned long long)filter_params.Count(), filter_params.Get().declarations.c_str());
+	}
+
+	// 4. Partition-aligned scan: a single predicate restricts this stream to
+	// the partitions the filters left; several become the parallel ranges.
+	auto range_predicates =
+		PlanPartitionRanges(context, bind_data, input.filters.get(), column_ids, rowid_requested, *result);
+	if (range_predicates.size() == 1) {
+		combined_where =
+			combined_where.empty() ? range_predicates[0] : "(" + combined_where + ") AND " + range_predicates[0];
+		range_predicates.clear();
+	}
+
+	// 5. Parallel scan: one query per key range or partition group, each ANDing
+	// its predicate onto the pushed-down WHERE. The ranges are claimed by DuckDB
+	// threads at Execute time; no stream is opened here.
+	if (range_predicates.empty()) {
+		range_predicates = PlanKeyRanges(context, bind_data, full_table_name, rowid_requested, *result);
+	}
+	if (!range_predicates.empty()) {
+		result->projected_column_count = valid_column_ids.size();
+		for (const auto &predicate : range_predicates) {
+			string range_where = combined_where.empty() ? predicate : "(" + combined_where + ") AND " + predicate;
+			result->range_queries.push_back(query + " WHERE " + range_where);
+		}
+		MSSQL_SCAN_DEBUG_LOG(1, "TableScanInitGlobal: parallel scan over %zu ranges",
+							 result->range_queries.size());
+		return std::move(result);
+	}
+
+	if (!combined_where.empty()) {
+		query += " WHERE " + combined_where;
+	}
 
 	MSSQL_SCAN_DEBUG_LOG(1, "TableScanInitGlobal: needs_duckdb_filter=%s", needs_duckdb_filter ? "true" : "false");
 
@@ -514,7 +983,7 @@ static unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &c
 
 	// Execute the query
 	MSSQLQueryExecutor executor(bind_data.context_name);
-	result->result_stream = executor.Execute(context, query);
+	result->result_stream = executor.Execute(context, query, result->filter_parameters);
 
 	// Set the number of columns to actually fill in the output chunk
 	// When valid_column_ids is empty (e.g., COUNT(*)), we don't fill any columns
@@ -725,8 +1194,51 @@ static void PopulateRowIdVector(MSSQLScanGlobalState &state, DataChunk &output,
 	}
 }
 
+// Parallel scan (key ranges or partition groups): drain the claimed range, then
+// claim the next, until none is left. Each range's stream (and its connection)
+// is released before the next is opened, so a thread never holds more than one
+// connection.
+void ExecuteScanRanges(ClientContext &context, MSSQLScanGlobalState &global_state, TableScanLocalState &local_state,
+					   DataChunk &output) {
+	while (!local_state.done) {
+		if (context.IsInterrupted()) {
+			if (local_state.range_stream) {
+				local_state.range_stream->Cancel();
+			}
+			local_state.done = true;
+			break;
+		}
+		if (!local_state.range_stream) {
+			const idx_t range = global_state.next_range.fetch_add(1);
+			if (range >= global_state.range_queries.size()) {
+				local_state.done = true;
+				break;
+			}
+			local_state.range_index = range;
+			if (range == 0 && global_state.result_stream) {
+				// mssql_scan opened range 0 at bind to learn the schema
+				local_state.range_stream = std::move(global_state.result_stream);
+			} else {
+				local_state.range_stream = OpenRangeStream(global_state, range);
+			}
+		}
+		idx_t rows = local_state.range_stream->FillChunk(output);
+		if (rows > 0) {
+			return;
+		}
+		MSSQL_SCAN_DEBUG_LOG(1, "Execute: range %llu complete", (unsigned long long)local_state.range_index);
+		local_state.range_stream->SurfaceWarnings(context);
+		local_state.range_stream.reset();
+	}
+	output.SetChildCardinality(0);
+}
+
 static void TableScanExecute(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
 	auto &global_state = data.global_state->Cast<MSSQLScanGlobalState>();
+	if (!global_state.range_queries.empty()) {
+		ExecuteScanRanges(context, global_state, data.local_state->Cast<TableScanLocalState>(), output);
+		return;
+	}
 
 	// Start timing on first call
 	if (!global_state.timing_started) {
@@ -919,6 +1431,16 @@ static void ComplexFilterPushdown(ClientContext &context, LogicalGet &get, Funct
 	vector<column_t> column_ids;
 	ExpressionEncodeContext ctx = BuildEncodeContext(get, bind_data, column_ids);
 
+	// Partition pruning reads every conjunct, pushed or not: a row the scan
+	// skips is one DuckDB's own filter would have dropped anyway. Rebuilt per
+	// call, like complex_filter_where_clause.
+	bind_data.partition_filter = MSSQLPartitionKeyInterval<Value>();
+	if (bind_data.partition_info.CanPrune()) {
+		for (const auto &filter : filters) {
+			CollectPartitionBounds(*filter, column_ids, bind_data, bind_data.partition_filter);
+		}
+	}
+
 	std::vector<std::string> encoded_conditions;
 	std::vector<idx_t> expressions_to_remove;
 
@@ -1015,6 +1537,20 @@ static BindInfo GetBindInfo(const optional_ptr<FunctionData> bind_data_p) {
 	return BindInfo(ScanType::EXTERNAL);
 }
 
+// Column statistics for the optimizer come from the table entry, which reads
+// SQL Server's histograms when mssql_statistics_level asks for them
+static unique_ptr<BaseStatistics> CatalogScanStatistics(ClientContext &context, const FunctionData *bind_data_p,
+														column_t column_index) {
+	if (!bind_data_p || IsVirtualColumn(column_index)) {
+		return nullptr;
+	}
+	auto &bind_data = bind_data_p->Cast<MSSQLCatalogScanBindData>();
+	if (!bind_data.table_entry) {
+		return nullptr;
+	}
+	return const_cast<TableCatalogEntry &>(*bind_data.table_entry).GetStatistics(context, column_index);
+}
+
 //------------------------------------------------------------------------------
 // Serialization
 //------------------------------------------------------------------------------
@@ -1145,6 +1681,9 @@ TableFunction GetCatalogScanFunction() {
 	// virtual columns like rowid from the table entry's GetVirtualColumns()
 	func.get_bind_info = GetBindInfo;
 
+	// Column statistics (NOT NULL, distinct count) for join estimates
+	func.statistics = CatalogScanStatistics;
+
 	// Note: We don't set filter_prune = true because that can cause issues with
 	// the DataChunk column count when filter-only columns are excluded
 
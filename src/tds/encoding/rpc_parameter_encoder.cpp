@@ -0,0 +1,246 @@
+#include "tds/encoding/rpc_parameter_encoder.hpp"
+#include <limits>
+#include "codec/datetime_codec.hpp"
+#include "codec/vector_format.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "tds/encoding/bcp_row_encoder.hpp"
+#include "tds/tds_types.hpp"
+
+namespace duckdb {
+namespace tds {
+namespace encoding {
+
+// DATE / DATETIME2 cover 0001-01-01 through 9999-12-31, as days since 0001-01-01
+static constexpr int64_t DAYS_FROM_0001_TO_EPOCH = 719162;
+static constexpr uint32_t MAX_DATE_DAYS = 3652058;
+
+// Fixed-length nullable types: TYPE_INFO is the type byte and the value width
+static void SetFixedTypeInfo(RpcParameter &param, uint8_t type, uint8_t width) {
+	param.type_info = {type, width};
+}
+
+std::string RpcParameterEncoder::Encode(const Value &value, const LogicalType &type, RpcParameter &param) {
+	vector<uint8_t> buffer;
+	std::string declaration;
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		SetFixedTypeInfo(param, TDS_TYPE_BITN, 1);
+		BCPRowEncoder::EncodeBit(buffer, BooleanValue::Get(value));
+		declaration = "bit";
+		break;
+	case LogicalTypeId::TINYINT:
+		// Signed: SQL Server's tinyint is 0..255
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 2);
+		BCPRowEncoder::EncodeInt16(buffer, TinyIntValue::Get(value));
+		declaration = "smallint";
+		break;
+	case LogicalTypeId::SMALLINT:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 2);
+		BCPRowEncoder::EncodeInt16(buffer, SmallIntValue::Get(value));
+		declaration = "smallint";
+		break;
+	case LogicalTypeId::INTEGER:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 4);
+		BCPRowEncoder::EncodeInt32(buffer, IntegerValue::Get(value));
+		declaration = "int";
+		break;
+	case LogicalTypeId::BIGINT:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 8);
+		BCPRowEncoder::EncodeInt64(buffer, BigIntValue::Get(value));
+		declaration = "bigint";
+		break;
+	case LogicalTypeId::UTINYINT:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 1);
+		BCPRowEncoder::EncodeUInt8(buffer, UTinyIntValue::Get(value));
+		declaration = "tinyint";
+		break;
+	case LogicalTypeId::USMALLINT:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 4);
+		BCPRowEncoder::EncodeInt32(buffer, USmallIntValue::Get(value));
+		declaration = "int";
+		break;
+	case LogicalTypeId::UINTEGER:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 8);
+		BCPRowEncoder::EncodeInt64(buffer, UIntegerValue::Get(value));
+		declaration = "bigint";
+		break;
+	case LogicalTypeId::UBIGINT: {
+		// Above INT64_MAX the literal path's DECIMAL(20,0) cast stays
+		const uint64_t uval = UBigIntValue::Get(value);
+		if (uval > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+			return "";
+		}
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 8);
+		BCPRowEncoder::EncodeInt64(buffer, static_cast<int64_t>(uval));
+		declaration = "bigint";
+		break;
+	}
+	case LogicalTypeId::FLOAT:
+		SetFixedTypeInfo(param, TDS_TYPE_FLOATN, 4);
+		BCPRowEncoder::EncodeFloat(buffer, FloatValue::Get(value));
+		declaration = "real";
+		break;
+	case LogicalTypeId::DOUBLE:
+		SetFixedTypeInfo(param, TDS_TYPE_FLOATN, 8);
+		BCPRowEncoder::EncodeDouble(buffer, DoubleValue::Get(value));
+		declaration = "float";
+		break;
+	case LogicalTypeId::DECIMAL: {
+		const uint8_t width = DecimalType::GetWidth(type);
+		const uint8_t scale = DecimalType::GetScale(type);
+		hugeint_t unscaled;
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			unscaled = hugeint_t(value.GetValueUnsafe<int16_t>());
+			break;
+		case PhysicalType::INT32:
+			unscaled = hugeint_t(value.GetValueUnsafe<int32_t>());
+			break;
+		case PhysicalType::INT64:
+			unscaled = hugeint_t(value.GetValueUnsafe<int64_t>());
+			break;
+		case PhysicalType::INT128:
+			unscaled = value.GetValueUnsafe<hugeint_t>();
+			break;
+		default:
+			return "";
+		}
+		// TYPE_INFO: DECIMALN, max value width, precision, scale
+		param.type_info = {TDS_TYPE_DECIMAL, BCPRowEncoder::GetDecimalByteSize(width), width, scale};
+		BCPRowEncoder::EncodeDecimal(buffer, unscaled, width, scale);
+		declaration = StringUtil::Format("decimal(%d,%d)", width, scale);
+		break;
+	}
+	case LogicalTypeId::DATE: {
+		const auto date = DateValue::Get(value);
+		if (!Date::IsFinite(date)) {
+			return "";
+		}
+		const int64_t days = static_cast<int64_t>(date.days) + DAYS_FROM_0001_TO_EPOCH;
+		if (days < 0 || days > MAX_DATE_DAYS) {
+			return "";
+		}
+		param.type_info = {TDS_TYPE_DATE};
+		BCPRowEncoder::EncodeDate(buffer, date);
+		declaration = "date";
+		break;
+	}
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_SEC: {
+		// DATETIME2(7), matching the literal path's CAST(... AS DATETIME2(7))
+		const auto ts = TimestampValue::Get(value);
+		if (!Timestamp::IsFinite(ts)) {
+			return "";
+		}
+		uint64_t time_value;
+		uint32_t date_value;
+		mssql::codec::datetime::ComputeDatetime2Components(ts.value, type.id(), 7, time_value, date_value);
+		if (date_value > MAX_DATE_DAYS) {
+			return "";
+		}
+		param.type_info = {TDS_TYPE_DATETIME2, 7};
+		BCPRowEncoder::EncodeDatetime2Raw(buffer, time_value, date_value, 7);
+		declaration = "datetime2(7)";
+		break;
+	}
+	case LogicalTypeId::VARCHAR: {
+		// N'' on the literal path, so nvarchar here
+		auto text_param = TdsProtocol::MakeNVarCharParameter(param.name, StringValue::Get(value));
+		const bool is_max = text_param.type_info[1] == 0xFF && text_param.type_info[2] == 0xFF;
+		param = std::move(text_param);
+		return is_max ? "nvarchar(max)" : "nvarchar(4000)";
+	}
+	default:
+		return "";
+	}
+	param.value.assign(buffer.begin(), buffer.end());
+	return declaration;
+}
+
+std::string RpcParameterEncoder::Bind(const Value &value, const LogicalType &type, ExecuteSqlParameters &parameters) {
+	if (value.IsNull()) {
+		return "";
+	}
+	Value typed = value;
+	if (typed.type() != type && !typed.DefaultTryCastAs(type, true)) {
+		return "";
+	}
+
+	RpcParameter param;
+	param.name = "@p" + std::to_string(parameters.values.size());
+	const auto declaration = Encode(typed, type, param);
+	if (declaration.empty()) {
+		return "";
+	}
+	return AppendParameter(std::move(param), declaration, parameters);
+}
+
+std::string RpcParameterEncoder::BindFromFormat(Vector &input, const UnifiedVectorFormat &fmt, idx_t row,
+												const LogicalType &type, ExecuteSqlParameters &parameters) {
+	using mssql::codec::FormatIsNull;
+	using mssql::codec::FormatValue;
+
+	if (FormatIsNull(fmt, row)) {
+		return "";
+	}
+	if (input.GetType() != type) {
+		return Bind(input.GetValue(row), type, parameters);
+	}
+
+	// The common key and SET column types, encoded as Encode does but without
+	// boxing the cell into a Value
+	RpcParameter param;
+	param.name = "@p" + std::to_string(parameters.values.size());
+	vector<uint8_t> buffer;
+	std::string declaration;
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		SetFixedTypeInfo(param, TDS_TYPE_BITN, 1);
+		BCPRowEncoder::EncodeBit(buffer, FormatValue<bool>(fmt, row));
+		declaration = "bit";
+		break;
+	case LogicalTypeId::SMALLINT:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 2);
+		BCPRowEncoder::EncodeInt16(buffer, FormatValue<int16_t>(fmt, row));
+		declaration = "smallint";
+		break;
+	case LogicalTypeId::INTEGER:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 4);
+		BCPRowEncoder::EncodeInt32(buffer, FormatValue<int32_t>(fmt, row));
+		declaration = "int";
+		break;
+	case LogicalTypeId::BIGINT:
+		SetFixedTypeInfo(param, TDS_TYPE_INTN, 8);
+		BCPRowEncoder::EncodeInt64(buffer, FormatValue<int64_t>(fmt, row));
+		declaration = "bigint";
+		break;
+	case LogicalTypeId::VARCHAR: {
+		auto text_param = TdsProtocol::MakeNVarCharParameter(param.name, FormatValue<string_t>(fmt, row).GetString());
+		const bool is_max = text_param.type_info[1] == 0xFF && text_param.type_info[2] == 0xFF;
+		return AppendParameter(std::move(text_param), is_max ? "nvarchar(max)" : "nvarchar(4000)", parameters);
+	}
+	default:
+		return Bind(input.GetValue(row), type, parameters);
+	}
+	param.value.assign(buffer.begin(), buffer.end());
+	return AppendParameter(std::move(param), declaration, parameters);
+}
+
+std::string RpcParameterEncoder::AppendParameter(RpcParameter param, const std::string &declaration,
+												 ExecuteSqlParameters &parameters) {
+	if (!parameters.declarations.empty()) {
+		parameters.declarations += ", ";
+	}
+	parameters.declarations += param.name + " " + declaration;
+	auto placeholder = param.name;
+	parameters.values.push_back(std::move(param));
+	return placeholder;
+}
+
+}  // namespace encoding
+}  // namespace tds
+}  // namespace duckdb
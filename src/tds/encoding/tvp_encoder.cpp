@@ -0,0 +1,257 @@
+#include "tds/encoding/tvp_encoder.hpp"
+#include "codec/vector_format.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "tds/encoding/bcp_row_encoder.hpp"
+#include "tds/encoding/rpc_parameter_encoder.hpp"
+#include "tds/encoding/utf16.hpp"
+#include "tds/tds_types.hpp"
+
+namespace duckdb {
+namespace tds {
+namespace encoding {
+
+static constexpr uint8_t TVP_END_TOKEN = 0x00;
+static constexpr uint8_t TVP_ROW_TOKEN = 0x01;
+static constexpr uint64_t PLP_NULL = 0xFFFFFFFFFFFFFFFFULL;
+
+static void AppendUInt16LE(std::vector<uint8_t> &out, uint16_t value) {
+	out.push_back(value & 0xFF);
+	out.push_back((value >> 8) & 0xFF);
+}
+
+static void AppendUInt32LE(std::vector<uint8_t> &out, uint32_t value) {
+	for (int i = 0; i < 4; i++) {
+		out.push_back((value >> (8 * i)) & 0xFF);
+	}
+}
+
+static void AppendUInt64LE(std::vector<uint8_t> &out, uint64_t value) {
+	for (int i = 0; i < 8; i++) {
+		out.push_back((value >> (8 * i)) & 0xFF);
+	}
+}
+
+// B_VARCHAR: character count, then UTF-16LE
+static void AppendBVarchar(std::vector<uint8_t> &out, const std::string &utf8) {
+	auto encoded = Utf16LEEncode(utf8);
+	out.push_back(static_cast<uint8_t>(encoded.size() / 2));
+	out.insert(out.end(), encoded.begin(), encoded.end());
+}
+
+// TYPE_INFO and declaration of a TVP column. The fixed-width types match what
+// RpcParameterEncoder::Encode emits for a single value, so its value bytes are
+// reused as-is; VARCHAR is nvarchar(max) (PLP) whatever the value length.
+static bool ColumnTypeInfo(const LogicalType &type, std::vector<uint8_t> &type_info, std::string &declaration) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		type_info = {TDS_TYPE_BITN, 1};
+		declaration = "bit";
+		return true;
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+		type_info = {TDS_TYPE_INTN, 2};
+		declaration = "smallint";
+		return true;
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::USMALLINT:
+		type_info = {TDS_TYPE_INTN, 4};
+		declaration = "int";
+		return true;
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+		type_info = {TDS_TYPE_INTN, 8};
+		declaration = "bigint";
+		return true;
+	case LogicalTypeId::UTINYINT:
+		type_info = {TDS_TYPE_INTN, 1};
+		declaration = "tinyint";
+		return true;
+	case LogicalTypeId::FLOAT:
+		type_info = {TDS_TYPE_FLOATN, 4};
+		declaration = "real";
+		return true;
+	case LogicalTypeId::DOUBLE:
+		type_info = {TDS_TYPE_FLOATN, 8};
+		declaration = "float";
+		return true;
+	case LogicalTypeId::DECIMAL: {
+		const uint8_t width = DecimalType::GetWidth(type);
+		const uint8_t scale = DecimalType::GetScale(type);
+		type_info = {TDS_TYPE_DECIMAL, BCPRowEncoder::GetDecimalByteSize(width), width, scale};
+		declaration = StringUtil::Format("decimal(%d,%d)", width, scale);
+		return true;
+	}
+	case LogicalTypeId::DATE:
+		type_info = {TDS_TYPE_DATE};
+		declaration = "date";
+		return true;
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_SEC:
+		type_info = {TDS_TYPE_DATETIME2, 7};
+		declaration = "datetime2(7)";
+		return true;
+	case LogicalTypeId::VARCHAR:
+		// NVARCHARTYPE, USHORT 0xFFFF (max), 5-byte collation
+		type_info = {TDS_TYPE_NVARCHAR, 0xFF, 0xFF, 0, 0, 0, 0, 0};
+		declaration = "nvarchar(max)";
+		return true;
+	default:
+		return false;
+	}
+}
+
+std::string TvpEncoder::ColumnDeclaration(const LogicalType &type) {
+	std::vector<uint8_t> type_info;
+	std::string declaration;
+	if (!ColumnTypeInfo(type, type_info, declaration)) {
+		return "";
+	}
+	return declaration;
+}
+
+std::string TvpEncoder::TypeName(const vector<std::string> &declarations) {
+	// FNV-1a: stable across processes and builds, unlike std::hash, so every
+	// client names the same column list the same way
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (auto &declaration : declarations) {
+		for (char c : declaration + ",") {
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 0x100000001b3ULL;
+		}
+	}
+	return StringUtil::Format("duckdb_tvp_%016llx", static_cast<unsigned long long>(hash));
+}
+
+TvpEncoder::TvpEncoder(vector<LogicalType> types) : types_(std::move(types)) {
+}
+
+void TvpEncoder::BeginRow() {
+	D_ASSERT(row_count_ == 0 || column_ == types_.size());
+	rows_.push_back(TVP_ROW_TOKEN);
+	column_ = 0;
+	row_count_++;
+}
+
+bool TvpEncoder::Append(const Value &value) {
+	D_ASSERT(column_ < types_.size());
+	const auto &type = types_[column_++];
+
+	if (value.IsNull()) {
+		AppendNull(type);
+		return true;
+	}
+	Value typed = value;
+	if (typed.type() != type && !typed.DefaultTryCastAs(type, true)) {
+		return false;
+	}
+
+	if (type.id() == LogicalTypeId::VARCHAR) {
+		AppendPlpString(StringValue::Get(typed));
+		return true;
+	}
+
+	RpcParameter param;
+	if (RpcParameterEncoder::Encode(typed, type, param).empty()) {
+		return false;
+	}
+	rows_.insert(rows_.end(), param.value.begin(), param.value.end());
+	return true;
+}
+
+bool TvpEncoder::AppendFromFormat(Vector &input, const UnifiedVectorFormat &fmt, idx_t row) {
+	using mssql::codec::FormatIsNull;
+	using mssql::codec::FormatValue;
+
+	D_ASSERT(column_ < types_.size());
+	const auto &type = types_[column_];
+	if (FormatIsNull(fmt, row)) {
+		column_++;
+		AppendNull(type);
+		return true;
+	}
+	if (input.GetType() != type) {
+		return Append(input.GetValue(row));
+	}
+	// Same bytes as Append: INTN/BITN values are a length byte and the value
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		rows_.push_back(1);
+		rows_.push_back(FormatValue<bool>(fmt, row) ? 1 : 0);
+		break;
+	case LogicalTypeId::SMALLINT:
+		rows_.push_back(2);
+		AppendUInt16LE(rows_, static_cast<uint16_t>(FormatValue<int16_t>(fmt, row)));
+		break;
+	case LogicalTypeId::INTEGER:
+		rows_.push_back(4);
+		AppendUInt32LE(rows_, static_cast<uint32_t>(FormatValue<int32_t>(fmt, row)));
+		break;
+	case LogicalTypeId::BIGINT:
+		rows_.push_back(8);
+		AppendUInt64LE(rows_, static_cast<uint64_t>(FormatValue<int64_t>(fmt, row)));
+		break;
+	case LogicalTypeId::VARCHAR:
+		AppendPlpString(FormatValue<string_t>(fmt, row).GetString());
+		break;
+	default:
+		return Append(input.GetValue(row));
+	}
+	column_++;
+	return true;
+}
+
+void TvpEncoder::AppendNull(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::VARCHAR) {
+		AppendUInt64LE(rows_, PLP_NULL);
+	} else {
+		rows_.push_back(0);
+	}
+}
+
+void TvpEncoder::AppendPlpString(const std::string &utf8) {
+	// PLP: ULONGLONG total length, one chunk, zero-length terminator
+	auto encoded = Utf16LEEncode(utf8);
+	AppendUInt64LE(rows_, encoded.size());
+	if (!encoded.empty()) {
+		AppendUInt32LE(rows_, static_cast<uint32_t>(encoded.size()));
+		rows_.insert(rows_.end(), encoded.begin(), encoded.end());
+	}
+	AppendUInt32LE(rows_, 0);
+}
+
+RpcParameter TvpEncoder::Finish(const std::string &name, const std::string &schema, const std::string &type_name) {
+	RpcParameter param;
+	param.name = name;
+
+	// TVP_TYPE_INFO: TVPTYPE, DbName (current database), OwningSchema, TypeName
+	param.type_info.push_back(TDS_TYPE_TVP);
+	AppendBVarchar(param.type_info, "");
+	AppendBVarchar(param.type_info, schema);
+	AppendBVarchar(param.type_info, type_name);
+
+	// TVP_COLMETADATA: per column UserType, Flags (nullable), TYPE_INFO, empty ColName
+	auto &value = param.value;
+	AppendUInt16LE(value, static_cast<uint16_t>(types_.size()));
+	for (auto &type : types_) {
+		std::vector<uint8_t> type_info;
+		std::string declaration;
+		ColumnTypeInfo(type, type_info, declaration);
+		AppendUInt32LE(value, 0);
+		AppendUInt16LE(value, COL_FLAG_NULLABLE);
+		value.insert(value.end(), type_info.begin(), type_info.end());
+		value.push_back(0);
+	}
+	value.push_back(TVP_END_TOKEN);
+
+	value.reserve(value.size() + rows_.size() + 1);
+	value.insert(value.end(), rows_.begin(), rows_.end());
+	value.push_back(TVP_END_TOKEN);
+	return param;
+}
+
+}  // namespace encoding
+}  // namespace tds
+}  // namespace duckdb
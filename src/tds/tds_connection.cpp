@@ -2,6 +2,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include "tds/tds_token_parser.hpp"
 
 #if defined(_WIN32)
 #ifndef WIN32_LEAN_AND_MEAN
@@ -247,6 +248,11 @@ bool TdsConnection::DoPrelogin(bool use_encrypt) {
 			return false;
 		}
 		tls_enabled_ = true;
+		// Before LOGIN7: the kernel must take over while both record sequence
+		// numbers are still where the handshake left them
+		if (kernel_tls_) {
+			socket_->EnableKernelTls();
+		}
 	} else {
 		// We did not request encryption
 		// Accept if server doesn't require it
@@ -533,6 +539,9 @@ bool TdsConnection::DoPreloginWithFedAuth(bool use_encrypt, const std::string &s
 			return false;
 		}
 		tls_enabled_ = true;
+		if (kernel_tls_) {
+			socket_->EnableKernelTls();	 // before LOGIN7, as in DoPrelogin
+		}
 		MSSQL_CONN_DEBUG_LOG(1, "DoPreloginWithFedAuth: TLS enabled%s", sni_hostname.empty() ? "" : " (SNI override)");
 	} else {
 		if (prelogin_response.encryption == EncryptionOption::ENCRYPT_REQ) {
@@ -1144,6 +1153,10 @@ void TdsConnection::Close() {
 
 	state_.store(ConnectionState::Disconnected);
 	spid_ = 0;
+	// Prepared handles died with the session
+	prepared_cache_.Clear();
+	pending_unprepare_.clear();
+	pending_prepare_key_.clear();
 	// This connection is no longer logged in anywhere, so it is no longer "in"
 	// a database either -- same reason spid_ is zeroed here.
 	//
@@ -1274,13 +1287,109 @@ bool TdsConnection::ExecuteBatch(const std::string &sql) {
 
 	MSSQL_CONN_DEBUG_LOG(1, "ExecuteBatch: sql_size=%zu, packet_count=%zu", sql.size(), packets.size());
 
+	return SendRequest(packets);
+}
+
+bool TdsConnection::ExecuteSql(const std::string &sql, const ExecuteSqlParameters &parameters) {
+	if (parameters.Empty()) {
+		return ExecuteBatch(sql);
+	}
+	MSSQL_CONN_DEBUG_LOG(1, "ExecuteSql: starting, state=%d, parameters=%zu", static_cast<int>(state_.load()),
+						 parameters.values.size());
+
+	ConnectionState expected = ConnectionState::Idle;
+	if (!state_.compare_exchange_strong(expected, ConnectionState::Executing)) {
+		last_error_ =
+			"Cannot execute: connection not in Idle state (current: " + std::string(ConnectionStateToString(expected)) +
+			")";
+		MSSQL_CONN_DEBUG_LOG(1, "ExecuteSql: FAILED - wrong state: %d", static_cast<int>(expected));
+		return false;
+	}
+
+	const uint8_t *txn_desc = has_transaction_descriptor_ ? transaction_descriptor_ : nullptr;
+	std::vector<TdsPacket> packets =
+		TdsProtocol::BuildExecuteSqlMultiPacket(sql, parameters, negotiated_packet_size_, txn_desc);
+	MSSQL_CONN_DEBUG_LOG(1, "ExecuteSql: sql_size=%zu, packet_count=%zu", sql.size(), packets.size());
+	return SendRequest(packets);
+}
+
+bool TdsConnection::ExecutePrepared(const std::string &sql, const ExecuteSqlParameters &parameters) {
+	if (parameters.Empty() || prepared_cache_.Capacity() == 0) {
+		return ExecuteSql(sql, parameters);
+	}
+
+	ConnectionState expected = ConnectionState::Idle;
+	if (!state_.compare_exchange_strong(expected, ConnectionState::Executing)) {
+		last_error_ =
+			"Cannot execute: connection not in Idle state (current: " + std::string(ConnectionStateToString(expected)) +
+			")";
+		MSSQL_CONN_DEBUG_LOG(1, "ExecutePrepared: FAILED - wrong state: %d", static_cast<int>(expected));
+		return false;
+	}
+
+	// The RESET_CONNECTION this request will carry frees every handle of the
+	// session on the server, so none of them can be executed or unprepared.
+	if (needs_reset_) {
+		prepared_cache_.Clear();
+		pending_unprepare_.clear();
+	}
+
+	const uint8_t *txn_desc = has_transaction_descriptor_ ? transaction_descriptor_ : nullptr;
+	const auto key = PreparedStatementCache::MakeKey(parameters.declarations, sql);
+	std::vector<int32_t> unprepare;
+	unprepare.swap(pending_unprepare_);
+	pending_prepare_key_.clear();
+
+	std::vector<TdsPacket> packets;
+	int32_t handle;
+	if (prepared_cache_.Lookup(key, handle)) {
+		packets =
+			TdsProtocol::BuildExecuteMultiPacket(handle, parameters, unprepare, negotiated_packet_size_, txn_desc);
+		MSSQL_CONN_DEBUG_LOG(1, "ExecutePrepared: sp_execute handle=%d, unprepare=%zu", handle, unprepare.size());
+	} else {
+		pending_prepare_key_ = key;
+		packets = TdsProtocol::BuildPrepExecMultiPacket(sql, parameters, unprepare, negotiated_packet_size_, txn_desc);
+		MSSQL_CONN_DEBUG_LOG(1, "ExecutePrepared: sp_prepexec sql_size=%zu, unprepare=%zu", sql.size(),
+							 unprepare.size());
+	}
+	return SendRequest(packets);
+}
+
+bool TdsConnection::OnReturnValue(const ReturnValueToken &value) {
+	if (pending_prepare_key_.empty()) {
+		return true;
+	}
+	if (!value.decoded) {
+		MSSQL_CONN_DEBUG_LOG(1, "OnReturnValue: prepared handle came back as TDS type 0x%02X", value.type_id);
+		pending_prepare_key_.clear();
+		return false;
+	}
+	if (value.is_null) {
+		return true;
+	}
+	prepared_cache_.Insert(pending_prepare_key_, static_cast<int32_t>(value.int_value), pending_unprepare_);
+	MSSQL_CONN_DEBUG_LOG(1, "OnReturnValue: prepared handle=%lld cached (%zu cached, %zu to unprepare)",
+						 (long long)value.int_value, prepared_cache_.Size(), pending_unprepare_.size());
+	pending_prepare_key_.clear();
+	return true;
+}
+
+void TdsConnection::SetPreparedCacheCapacity(size_t capacity) {
+	prepared_cache_.SetCapacity(capacity, pending_unprepare_);
+}
+
+bool TdsConnection::SendRequest(std::vector<TdsPacket> &packets) {
 	// If connection needs reset, set RESET_CONNECTION flag on the first packet
 	if (needs_reset_ && !packets.empty()) {
 		auto &first = packets[0];
 		auto status = static_cast<uint8_t>(first.GetStatus()) | static_cast<uint8_t>(PacketStatus::RESET_CONNECTION);
 		first.SetStatus(static_cast<PacketStatus>(status));
 		needs_reset_ = false;
-		MSSQL_CONN_DEBUG_LOG(1, "ExecuteBatch: RESET_CONNECTION flag set on first packet");
+		// The reset frees the session's prepared handles (ExecutePrepared has
+		// already dropped them before choosing sp_execute vs sp_prepexec)
+		prepared_cache_.Clear();
+		pending_unprepare_.clear();
+		MSSQL_CONN_DEBUG_LOG(1, "SendRequest: RESET_CONNECTION flag set on first packet");
 	}
 
 	// For multi-packet messages:
@@ -1298,7 +1407,7 @@ bool TdsConnection::ExecuteBatch(const std::string &sql) {
 				auto &packet = packets[i];
 				packet.SetPacketId(pkt_id++);
 				MSSQL_CONN_DEBUG_LOG(2,
-									 "ExecuteBatch: preparing packet %zu/%zu, type=0x%02x, status=0x%02x, length=%u, "
+									 "SendRequest: preparing packet %zu/%zu, type=0x%02x, status=0x%02x, length=%u, "
 									 "payload_size=%zu, eom=%d, pkt_id=%u",
 									 i + 1, packets.size(), static_cast<unsigned>(packet.GetType()),
 									 static_cast<unsigned>(packet.GetStatus()), packet.GetLength(),
@@ -1307,9 +1416,9 @@ bool TdsConnection::ExecuteBatch(const std::string &sql) {
 				combined.insert(combined.end(), serialized.begin(), serialized.end());
 				total_size += serialized.size();
 			}
-			MSSQL_CONN_DEBUG_LOG(2, "ExecuteBatch: sending %zu combined bytes", total_size);
+			MSSQL_CONN_DEBUG_LOG(2, "SendRequest: sending %zu combined bytes", total_size);
 			if (!socket_->Send(combined)) {
-				last_error_ = "Failed to send multi-packet SQL_BATCH: " + socket_->GetLastError();
+				last_error_ = "Failed to send multi-packet request: " + socket_->GetLastError();
 				state_.store(ConnectionState::Disconnected);
 				return false;
 			}
@@ -1319,7 +1428,7 @@ bool TdsConnection::ExecuteBatch(const std::string &sql) {
 				auto &packet = packets[i];
 				packet.SetPacketId(pkt_id++);
 				MSSQL_CONN_DEBUG_LOG(2,
-									 "ExecuteBatch: sending TLS packet %zu/%zu, type=0x%02x, status=0x%02x, length=%u, "
+									 "SendRequest: sending TLS packet %zu/%zu, type=0x%02x, status=0x%02x, length=%u, "
 									 "payload_size=%zu, eom=%d, pkt_id=%u",
 									 i + 1, packets.size(), static_cast<unsigned>(packet.GetType()),
 									 static_cast<unsigned>(packet.GetStatus()), packet.GetLength(),
@@ -1338,7 +1447,7 @@ bool TdsConnection::ExecuteBatch(const std::string &sql) {
 			auto &packet = packets[i];
 			packet.SetPacketId(next_packet_id_++);
 			MSSQL_CONN_DEBUG_LOG(2,
-								 "ExecuteBatch: sending packet %zu/%zu, type=0x%02x, status=0x%02x, length=%u, "
+								 "SendRequest: sending packet %zu/%zu, type=0x%02x, status=0x%02x, length=%u, "
 								 "payload_size=%zu, eom=%d, pkt_id=%u",
 								 i + 1, packets.size(), static_cast<unsigned>(packet.GetType()),
 								 static_cast<unsigned>(packet.GetStatus()), packet.GetLength(),
@@ -1360,19 +1469,19 @@ bool TdsConnection::ExecuteBatch(const std::string &sql) {
 					hex_dump += buf;
 				}
 				MSSQL_CONN_DEBUG_LOG(3,
-									 "ExecuteBatch: packet framing (TDS hdr + ALL_HEADERS, first %zu bytes): %s "
+									 "SendRequest: packet framing (TDS hdr + ALL_HEADERS, first %zu bytes): %s "
 									 "(SQL text deliberately omitted)",
 									 kHeaderFramingBytes, hex_dump.c_str());
 			}
 			if (!socket_->SendPacket(packet)) {
-				last_error_ = "Failed to send SQL_BATCH: " + socket_->GetLastError();
+				last_error_ = "Failed to send request: " + socket_->GetLastError();
 				state_.store(ConnectionState::Disconnected);
 				return false;
 			}
 		}
 	}
 
-	MSSQL_CONN_DEBUG_LOG(1, "ExecuteBatch: all packets sent");
+	MSSQL_CONN_DEBUG_LOG(1, "SendRequest: all packets sent");
 
 	// Connection is now in Executing state, ready to receive response
 	return true;
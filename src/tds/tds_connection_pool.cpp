@@ -2,7 +2,10 @@
 
 #include "duckdb/common/assert.hpp"
 
+#include <algorithm>
 #include <cstdlib>
+#include <system_error>
+#include <vector>
 
 namespace duckdb {
 namespace tds {
@@ -22,12 +25,18 @@ static int GetPoolDebugLevel() {
 			fprintf(stderr, "[MSSQL POOL] " fmt "\n", ##__VA_ARGS__); \
 	} while (0)
 
+// How long the cleanup thread waits before pre-warming again after a pre-warm
+// login failed, so an unreachable server is not hammered every second
+static constexpr std::chrono::seconds WARM_RETRY_INTERVAL(10);
+
 ConnectionPool::ConnectionPool(const std::string &context_name, PoolConfiguration config, ConnectionFactory factory)
 	: context_name_(context_name),
 	  config_(std::move(config)),
 	  factory_(std::move(factory)),
 	  next_connection_id_(1),
 	  shutdown_flag_(false) {
+	warm_handoff_ = std::make_shared<WarmHandoff>();
+	warm_handoff_->pool = this;
 	// Start background cleanup thread
 	cleanup_thread_ = std::thread(&ConnectionPool::CleanupThreadFunc, this);
 }
@@ -93,18 +102,24 @@ void ConnectionPool::Shutdown() {
 		cleanup_thread_.join();
 	}
 
+	// Cut off pre-warm logins still in flight. Blocks only while one of them
+	// is handing its connection over, never for a login itself.
+	{
+		std::lock_guard<std::mutex> handoff_lock(warm_handoff_->mutex);
+		warm_handoff_->pool = nullptr;
+	}
+
 	// Close all connections
 	std::lock_guard<std::mutex> lock(pool_mutex_);
 
 	// Close idle connections
-	while (!idle_connections_.empty()) {
-		auto &meta = idle_connections_.front();
+	for (auto &meta : idle_connections_) {
 		if (meta.connection) {
 			meta.connection->Close();
 		}
-		idle_connections_.pop();
 		stats_.connections_closed++;
 	}
+	idle_connections_.clear();
 
 	// Close active connections.
 	// Spec 052 PR #127: dump per-connection diagnostics for every leaked
@@ -112,11 +127,12 @@ void ConnectionPool::Shutdown() {
 	// tells us WHERE the leak originated — without it the leak warning
 	// only says "1 connection" with no clue which call path stranded it.
 	for (auto &pair : active_connections_) {
-		if (pair.second) {
+		auto &conn = pair.second.connection;
+		if (conn) {
 			fprintf(stderr, "[MSSQL POOL] LEAKED active conn id=%llu spid=%u state=%d use_count=%ld pool='%s'\n",
-					(unsigned long long)pair.first, (unsigned)pair.second->GetSpid(), (int)pair.second->GetState(),
-					(long)pair.second.use_count(), context_name_.c_str());
-			pair.second->Close();
+					(unsigned long long)pair.second.connection_id, (unsigned)conn->GetSpid(), (int)conn->GetState(),
+					(long)conn.use_count(), context_name_.c_str());
+			conn->Close();
 		}
 		stats_.connections_closed++;
 	}
@@ -159,27 +175,62 @@ std::shared_ptr<TdsConnection> ConnectionPool::Acquire(int timeout_ms) {
 	stats_.acquire_count++;
 
 	while (true) {
-		// Try to get an idle connection
-		auto conn = TryAcquireIdle();
-		if (conn) {
-			auto elapsed =
-				std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
-			stats_.acquire_wait_total_ms += elapsed;
-			return conn;
+		// Try to get an idle connection: the most recently released one (LIFO)
+		if (!idle_connections_.empty()) {
+			auto meta = std::move(idle_connections_.back());
+			idle_connections_.pop_back();
+			stats_.idle_connections--;
+
+			// Checked out BEFORE validating: the long-idle ping is a server round
+			// trip and runs with the mutex released, while the connection still
+			// counts against total_connections
+			auto conn = meta.connection;
+			active_connections_[conn.get()] = std::move(meta);
+			stats_.active_connections++;
+
+			lock.unlock();
+			bool valid = ValidateConnection(conn);
+			if (valid) {
+				conn->UpdateLastUsed();
+			} else {
+				conn->Close();
+			}
+			lock.lock();
+
+			if (shutdown_flag_.load()) {
+				return nullptr;	 // Shutdown() already closed and forgot it
+			}
+			if (valid) {
+				auto elapsed =
+					std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
+						.count();
+				stats_.acquire_wait_total_ms += elapsed;
+				return conn;
+			}
+
+			// Connection is dead: forget it and try the next one
+			active_connections_.erase(conn.get());
+			stats_.active_connections--;
+			stats_.connections_closed++;
+			stats_.total_connections--;
+			continue;
 		}
 
-		// Try to create a new connection if under limit
-		if (stats_.total_connections < config_.connection_limit) {
+		// Try to create a new connection if under limit (pre-warm logins in
+		// flight already hold their slot)
+		if (stats_.total_connections + pending_connections_ < config_.connection_limit) {
 			lock.unlock();
-			conn = CreateNewConnection();
+			auto conn = CreateNewConnection();
 			lock.lock();
 
 			if (conn) {
-				uint64_t id = next_connection_id_++;
-				active_connections_[id] = conn;
+				ConnectionMetadata meta;
+				meta.connection = conn;
+				meta.connection_id = next_connection_id_++;
+				active_connections_[conn.get()] = std::move(meta);
 				stats_.total_connections++;
 				stats_.active_connections++;
-				stats_.connections_created++;
+				CountNewConnection(*conn);
 
 				auto elapsed =
 					std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
@@ -223,7 +274,7 @@ void ConnectionPool::Release(std::shared_ptr<TdsConnection> conn) {
 		return;
 	}
 
-	std::lock_guard<std::mutex> lock(pool_mutex_);
+	std::unique_lock<std::mutex> lock(pool_mutex_);
 
 	// Re-check under the mutex: if a shutdown raced past the unlocked check
 	// above, close instead of enqueueing into a quiesced pool.
@@ -234,33 +285,28 @@ void ConnectionPool::Release(std::shared_ptr<TdsConnection> conn) {
 
 	// Find and remove from active connections
 	uint64_t found_id = 0;
-	for (auto it = active_connections_.begin(); it != active_connections_.end(); ++it) {
-		if (it->second.get() == conn.get()) {
-			found_id = it->first;
-			active_connections_.erase(it);
-			stats_.active_connections--;
-			break;
-		}
+	auto it = active_connections_.find(conn.get());
+	if (it != active_connections_.end()) {
+		found_id = it->second.connection_id;
+		active_connections_.erase(it);
+		stats_.active_connections--;
 	}
 
 	// T010: Validate connection state before returning to pool (FR-002)
-	// Connections must be in Idle state to be safely reused
-	if (conn->GetState() != ConnectionState::Idle) {
-		MSSQL_POOL_DEBUG_LOG(1, "Closing connection in non-Idle state: %d (pool '%s')",
-							 static_cast<int>(conn->GetState()), context_name_.c_str());
-		conn->Close();
+	// Connections must be in Idle state to be safely reused.
+	// If caching disabled or connection is dead, close it too.
+	bool not_idle = conn->GetState() != ConnectionState::Idle;
+	if (not_idle || !config_.connection_cache || !conn->IsAlive()) {
+		if (not_idle) {
+			MSSQL_POOL_DEBUG_LOG(1, "Closing connection in non-Idle state: %d (pool '%s')",
+								 static_cast<int>(conn->GetState()), context_name_.c_str());
+		}
 		stats_.connections_closed++;
 		stats_.total_connections--;
+		lock.unlock();
 		available_cv_.notify_one();
-		return;
-	}
-
-	// If caching disabled or connection is dead, close it
-	if (!config_.connection_cache || !conn->IsAlive()) {
+		// No longer tracked by the pool, so the (TLS) close can run unlocked
 		conn->Close();
-		stats_.connections_closed++;
-		stats_.total_connections--;
-		available_cv_.notify_one();
 		return;
 	}
 
@@ -270,7 +316,7 @@ void ConnectionPool::Release(std::shared_ptr<TdsConnection> conn) {
 	meta.connection_id = found_id ? found_id : next_connection_id_++;
 	meta.last_released = std::chrono::steady_clock::now();
 
-	idle_connections_.push(std::move(meta));
+	idle_connections_.push_back(std::move(meta));
 	stats_.idle_connections++;
 
 	available_cv_.notify_one();
@@ -295,36 +341,29 @@ int64_t ConnectionPool::GetPinnedCount() const noexcept {
 	return pinned_count_.load(std::memory_order_relaxed);
 }
 
-std::shared_ptr<TdsConnection> ConnectionPool::TryAcquireIdle() {
-	// pool_mutex_ must be held
-
-	while (!idle_connections_.empty()) {
-		auto meta = std::move(idle_connections_.front());
-		idle_connections_.pop();
-		stats_.idle_connections--;
-
-		if (ValidateConnection(meta.connection)) {
-			uint64_t id = meta.connection_id;
-			active_connections_[id] = meta.connection;
-			stats_.active_connections++;
-			meta.connection->UpdateLastUsed();
-			return meta.connection;
-		}
-
-		// Connection is dead, close it
-		meta.connection->Close();
-		stats_.connections_closed++;
-		stats_.total_connections--;
-	}
-
-	return nullptr;
-}
-
 std::shared_ptr<TdsConnection> ConnectionPool::CreateNewConnection() {
 	// pool_mutex_ must NOT be held (blocking I/O)
 	return factory_();
 }
 
+void ConnectionPool::CountNewConnection(const TdsConnection &conn) {
+	// pool_mutex_ must be held
+	stats_.connections_created++;
+	if (conn.IsTlsEnabled()) {
+		if (conn.IsTlsSessionReused()) {
+			stats_.tls_session_hits++;
+		} else {
+			stats_.tls_session_misses++;
+		}
+		if (conn.IsKernelTlsRx()) {
+			stats_.kernel_tls_rx++;
+		}
+		if (conn.IsKernelTlsTx()) {
+			stats_.kernel_tls_tx++;
+		}
+	}
+}
+
 bool ConnectionPool::ValidateConnection(std::shared_ptr<TdsConnection> &conn) {
 	if (!conn || !conn->IsAlive()) {
 		return false;
@@ -339,6 +378,10 @@ bool ConnectionPool::ValidateConnection(std::shared_ptr<TdsConnection> &conn) {
 }
 
 void ConnectionPool::CleanupThreadFunc() {
+	// Pre-warm first, so min_connections are logging in while ATTACH returns
+	// and the first parallel query finds them idle
+	WarmUp();
+
 	while (!shutdown_flag_.load()) {
 		// Wait up to 1 second between cleanup cycles. Waits on cleanup_cv_
 		// (which Shutdown() notifies) instead of a blind sleep: ~ConnectionPool
@@ -356,39 +399,147 @@ void ConnectionPool::CleanupThreadFunc() {
 			break;
 		}
 
-		std::lock_guard<std::mutex> lock(pool_mutex_);
-
-		if (config_.idle_timeout <= 0) {
-			continue;  // No idle timeout configured
+		if (config_.idle_timeout > 0) {
+			ReapIdleConnections();
 		}
 
+		// Top back up to min_connections: connections the server dropped and
+		// dead ones discarded by Acquire() leave the pool short too
+		WarmUp();
+	}
+}
+
+void ConnectionPool::ReapIdleConnections() {
+	std::vector<std::shared_ptr<TdsConnection>> expired;
+	{
+		std::lock_guard<std::mutex> lock(pool_mutex_);
+
 		auto now = std::chrono::steady_clock::now();
 		size_t to_keep = config_.min_connections > stats_.active_connections
 							 ? config_.min_connections - stats_.active_connections
 							 : 0;
 
-		// Check each idle connection
-		std::queue<ConnectionMetadata> remaining;
+		// Check each idle connection, newest (back) first, so the ones kept
+		// for min_connections are the warmest
+		std::deque<ConnectionMetadata> remaining;
 		while (!idle_connections_.empty()) {
-			auto meta = std::move(idle_connections_.front());
-			idle_connections_.pop();
+			auto meta = std::move(idle_connections_.back());
+			idle_connections_.pop_back();
 
 			auto idle_duration = std::chrono::duration_cast<std::chrono::seconds>(now - meta.last_released).count();
 
 			bool should_close = idle_duration > config_.idle_timeout && remaining.size() >= to_keep;
 
 			if (should_close) {
-				meta.connection->Close();
+				expired.push_back(std::move(meta.connection));
 				stats_.connections_closed++;
 				stats_.total_connections--;
 				stats_.idle_connections--;
 			} else {
-				remaining.push(std::move(meta));
+				remaining.push_front(std::move(meta));
 			}
 		}
 
 		idle_connections_ = std::move(remaining);
 	}
+
+	// Out of the pool already; close without holding up Acquire/Release
+	for (auto &conn : expired) {
+		conn->Close();
+	}
+}
+
+void ConnectionPool::WarmUp() {
+	if (!config_.connection_cache || config_.min_connections == 0) {
+		return;	 // nothing would be kept anyway
+	}
+	size_t missing;
+	{
+		std::lock_guard<std::mutex> lock(pool_mutex_);
+		if (shutdown_flag_.load() || std::chrono::steady_clock::now() < warm_retry_after_) {
+			return;
+		}
+		size_t target = std::min(config_.min_connections, config_.connection_limit);
+		size_t have = stats_.total_connections + pending_connections_;
+		if (have >= target) {
+			return;
+		}
+		missing = target - have;
+		pending_connections_ += missing;
+	}
+
+	// One detached thread per login, so N handshakes (TCP, PRELOGIN, TLS,
+	// LOGIN7 and any Kerberos / FedAuth round trips) overlap instead of
+	// queueing behind each other, and DETACH right after ATTACH does not wait
+	// for any of them. Each thread owns a copy of the factory (its captures
+	// are by value) and reaches the pool only through warm_handoff_.
+	MSSQL_POOL_DEBUG_LOG(1, "Pre-warming %zu connection(s) for pool '%s'", missing, context_name_.c_str());
+	for (size_t i = 0; i < missing; i++) {
+		auto handoff = warm_handoff_;
+		auto factory = factory_;
+		auto context_name = context_name_;
+		try {
+			std::thread([handoff, factory, context_name] { WarmOne(handoff, factory, context_name); }).detach();
+		} catch (const std::system_error &) {
+			// Out of threads: log in on this one instead
+			WarmOne(handoff, factory, context_name);
+		}
+	}
+}
+
+void ConnectionPool::WarmOne(const std::shared_ptr<WarmHandoff> &handoff, const ConnectionFactory &factory,
+							 const std::string &context_name) {
+	std::shared_ptr<TdsConnection> conn;
+	try {
+		conn = factory();
+	} catch (const std::exception &e) {
+		// Nobody waits on a pre-warm login; the next Acquire() reports the error
+		MSSQL_POOL_DEBUG_LOG(1, "Pre-warm login failed for pool '%s': %s", context_name.c_str(), e.what());
+	} catch (...) {
+		MSSQL_POOL_DEBUG_LOG(1, "Pre-warm login failed for pool '%s'", context_name.c_str());
+	}
+
+	std::shared_ptr<TdsConnection> rejected;
+	{
+		std::lock_guard<std::mutex> handoff_lock(handoff->mutex);
+		if (handoff->pool) {
+			rejected = handoff->pool->AdoptWarmConnection(std::move(conn));
+		} else {
+			rejected = std::move(conn);	 // the pool is gone
+		}
+	}
+	if (rejected) {
+		rejected->Close();
+	}
+}
+
+std::shared_ptr<TdsConnection> ConnectionPool::AdoptWarmConnection(std::shared_ptr<TdsConnection> conn) {
+	// Called with warm_handoff_->mutex held, so the pool is still alive
+	std::unique_lock<std::mutex> lock(pool_mutex_);
+	pending_connections_--;
+	if (!conn || shutdown_flag_.load()) {
+		if (!conn) {
+			warm_retry_after_ = std::chrono::steady_clock::now() + WARM_RETRY_INTERVAL;
+		}
+		lock.unlock();
+		// The slot is free again: a waiter blocked at the limit can log in itself
+		available_cv_.notify_one();
+		return conn;
+	}
+
+	ConnectionMetadata meta;
+	meta.connection = std::move(conn);
+	meta.connection_id = next_connection_id_++;
+	meta.last_released = std::chrono::steady_clock::now();
+	auto &warm = *meta.connection;
+	idle_connections_.push_back(std::move(meta));
+	stats_.total_connections++;
+	stats_.idle_connections++;
+	CountNewConnection(warm);
+	lock.unlock();
+
+	available_cv_.notify_one();
+	return nullptr;
 }
 
 }  // namespace tds
@@ -1302,6 +1302,183 @@ std::vector<TdsPacket> TdsProtocol::SplitIntoPackets(const TdsPacket &message, s
 	return packets;
 }
 
+//===----------------------------------------------------------------------===//
+// RPC requests (sp_executesql, sp_prepexec, sp_execute, sp_unprepare)
+//===----------------------------------------------------------------------===//
+
+// Well-known stored procedure IDs ([MS-TDS] 2.2.6.6 ProcIDs)
+static constexpr uint16_t RPC_PROC_ID_SWITCH = 0xFFFF;
+static constexpr uint16_t RPC_PROC_ID_EXECUTESQL = 10;
+static constexpr uint16_t RPC_PROC_ID_EXECUTE = 12;
+static constexpr uint16_t RPC_PROC_ID_PREPEXEC = 13;
+static constexpr uint16_t RPC_PROC_ID_UNPREPARE = 15;
+
+// Separates the calls of one RPC request (TDS 7.2+ BatchFlag)
+static constexpr uint8_t RPC_BATCH_FLAG = 0xFF;
+
+// ParamMetaData StatusFlags: fByRefValue marks an OUTPUT parameter
+static constexpr uint8_t RPC_PARAM_BY_REF = 0x01;
+
+// nvarchar(n) carries at most 8000 bytes; longer text must be nvarchar(max)
+static constexpr size_t RPC_NVARCHAR_MAX_BYTES = 8000;
+
+static void AppendUInt16LE(std::vector<uint8_t> &out, uint16_t value) {
+	out.push_back(value & 0xFF);
+	out.push_back((value >> 8) & 0xFF);
+}
+
+static void AppendUInt32LE(std::vector<uint8_t> &out, uint32_t value) {
+	for (int i = 0; i < 4; i++) {
+		out.push_back((value >> (8 * i)) & 0xFF);
+	}
+}
+
+RpcParameter TdsProtocol::MakeNVarCharParameter(const std::string &name, const std::string &utf8) {
+	RpcParameter param;
+	param.name = name;
+	std::vector<uint8_t> encoded = encoding::Utf16LEEncode(utf8);
+	const bool plp = encoded.size() > RPC_NVARCHAR_MAX_BYTES;
+
+	// TYPE_INFO: NVARCHARTYPE, USHORT max length (0xFFFF = max), 5-byte collation
+	param.type_info.push_back(TDS_TYPE_NVARCHAR);
+	AppendUInt16LE(param.type_info, plp ? 0xFFFF : static_cast<uint16_t>(RPC_NVARCHAR_MAX_BYTES));
+	param.type_info.insert(param.type_info.end(), 5, 0x00);
+
+	if (!plp) {
+		param.value.reserve(2 + encoded.size());
+		AppendUInt16LE(param.value, static_cast<uint16_t>(encoded.size()));
+		param.value.insert(param.value.end(), encoded.begin(), encoded.end());
+		return param;
+	}
+	// PLP: ULONGLONG total length, one chunk, zero-length terminator
+	param.value.reserve(8 + 4 + encoded.size() + 4);
+	const uint64_t total = encoded.size();
+	for (int i = 0; i < 8; i++) {
+		param.value.push_back((total >> (8 * i)) & 0xFF);
+	}
+	AppendUInt32LE(param.value, static_cast<uint32_t>(encoded.size()));
+	param.value.insert(param.value.end(), encoded.begin(), encoded.end());
+	AppendUInt32LE(param.value, 0);
+	return param;
+}
+
+// INTN(4) parameter: a prepared handle, or NULL for sp_prepexec's OUTPUT handle
+static RpcParameter MakeHandleParameter(const int32_t *handle) {
+	RpcParameter param;
+	param.type_info = {TDS_TYPE_INTN, 4};
+	if (!handle) {
+		param.value = {0};
+		return param;
+	}
+	param.value.push_back(4);
+	AppendUInt32LE(param.value, static_cast<uint32_t>(*handle));
+	return param;
+}
+
+static void AppendRpcParameter(std::vector<uint8_t> &out, const RpcParameter &param, bool by_name = true,
+							   uint8_t status = 0x00) {
+	// ParamMetaData: B_VARCHAR name, StatusFlags, TYPE_INFO
+	std::vector<uint8_t> name = encoding::Utf16LEEncode(by_name ? param.name : std::string());
+	out.push_back(static_cast<uint8_t>(name.size() / 2));
+	out.insert(out.end(), name.begin(), name.end());
+	out.push_back(status);
+	out.insert(out.end(), param.type_info.begin(), param.type_info.end());
+	out.insert(out.end(), param.value.begin(), param.value.end());
+}
+
+// ALL_HEADERS: same Transaction Descriptor header as SQL_BATCH
+static void AppendRpcAllHeaders(std::vector<uint8_t> &payload, const uint8_t *transaction_descriptor) {
+	AppendUInt32LE(payload, 22);
+	AppendUInt32LE(payload, 18);
+	AppendUInt16LE(payload, 0x0002);
+	for (int i = 0; i < 8; i++) {
+		payload.push_back(transaction_descriptor ? transaction_descriptor[i] : 0x00);
+	}
+	AppendUInt32LE(payload, 1);
+}
+
+// RPCReqBatch header: procedure by ID, no option flags
+static void AppendRpcProcId(std::vector<uint8_t> &payload, uint16_t proc_id) {
+	AppendUInt16LE(payload, RPC_PROC_ID_SWITCH);
+	AppendUInt16LE(payload, proc_id);
+	AppendUInt16LE(payload, 0x0000);
+}
+
+// One sp_unprepare call per handle, each followed by the BatchFlag, ahead of
+// the request's own call
+static void AppendUnprepareCalls(std::vector<uint8_t> &payload, const std::vector<int32_t> &unprepare_handles) {
+	for (auto handle : unprepare_handles) {
+		AppendRpcProcId(payload, RPC_PROC_ID_UNPREPARE);
+		AppendRpcParameter(payload, MakeHandleParameter(&handle));
+		payload.push_back(RPC_BATCH_FLAG);
+	}
+}
+
+std::vector<TdsPacket> TdsProtocol::BuildExecuteSqlMultiPacket(const std::string &sql,
+															   const ExecuteSqlParameters &parameters,
+															   size_t max_packet_size,
+															   const uint8_t *transaction_descriptor) {
+	TdsPacket message(PacketType::RPC);
+	std::vector<uint8_t> payload;
+	AppendRpcAllHeaders(payload, transaction_descriptor);
+	AppendRpcProcId(payload, RPC_PROC_ID_EXECUTESQL);
+
+	// @stmt and @params are positional; the typed values are named
+	AppendRpcParameter(payload, MakeNVarCharParameter("", sql));
+	if (!parameters.Empty()) {
+		AppendRpcParameter(payload, MakeNVarCharParameter("", parameters.declarations));
+		for (const auto &param : parameters.values) {
+			AppendRpcParameter(payload, param);
+		}
+	}
+
+	message.AppendPayload(payload);
+	return SplitIntoPackets(message, max_packet_size);
+}
+
+std::vector<TdsPacket> TdsProtocol::BuildPrepExecMultiPacket(const std::string &sql,
+															 const ExecuteSqlParameters &parameters,
+															 const std::vector<int32_t> &unprepare_handles,
+															 size_t max_packet_size,
+															 const uint8_t *transaction_descriptor) {
+	TdsPacket message(PacketType::RPC);
+	std::vector<uint8_t> payload;
+	AppendRpcAllHeaders(payload, transaction_descriptor);
+	AppendUnprepareCalls(payload, unprepare_handles);
+	AppendRpcProcId(payload, RPC_PROC_ID_PREPEXEC);
+
+	// sp_prepexec @handle OUTPUT, @params, @stmt, then the values positionally
+	AppendRpcParameter(payload, MakeHandleParameter(nullptr), true, RPC_PARAM_BY_REF);
+	AppendRpcParameter(payload, MakeNVarCharParameter("", parameters.declarations));
+	AppendRpcParameter(payload, MakeNVarCharParameter("", sql));
+	for (const auto &param : parameters.values) {
+		AppendRpcParameter(payload, param, false);
+	}
+
+	message.AppendPayload(payload);
+	return SplitIntoPackets(message, max_packet_size);
+}
+
+std::vector<TdsPacket> TdsProtocol::BuildExecuteMultiPacket(int32_t handle, const ExecuteSqlParameters &parameters,
+															const std::vector<int32_t> &unprepare_handles,
+															size_t max_packet_size,
+															const uint8_t *transaction_descriptor) {
+	TdsPacket message(PacketType::RPC);
+	std::vector<uint8_t> payload;
+	AppendRpcAllHeaders(payload, transaction_descriptor);
+	AppendUnprepareCalls(payload, unprepare_handles);
+	AppendRpcProcId(payload, RPC_PROC_ID_EXECUTE);
+
+	// sp_execute @handle, then the values positionally
+	AppendRpcParameter(payload, MakeHandleParameter(&handle));
+	for (const auto &param : parameters.values) {
+		AppendRpcParameter(payload, param, false);
+	}
+
+	message.AppendPayload(payload);
+	return SplitIntoPackets(message, max_packet_size);
+}
+
 TdsPacket TdsProtocol::BuildAttention() {
 	TdsPacket packet(PacketType::ATTENTION);
 	// Single byte payload with 0xFF marker
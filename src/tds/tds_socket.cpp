@@ -102,15 +102,12 @@ TdsSocket::TdsSocket(TdsSocket &&other) noexcept
 	  port_(other.port_),
 	  connected_(other.connected_),
 	  last_error_(std::move(other.last_error_)),
+	  framing_error_(other.framing_error_),
 	  tls_context_(std::move(other.tls_context_)),
 	  receive_buffer_(std::move(other.receive_buffer_)),
-	  receive_len_(other.receive_len_),
-	  receive_pos_(other.receive_pos_),
 	  recv_read_size_(other.recv_read_size_) {
 	other.fd_ = -1;
 	other.connected_ = false;
-	other.receive_len_ = 0;
-	other.receive_pos_ = 0;
 }
 
 TdsSocket &TdsSocket::operator=(TdsSocket &&other) noexcept {
@@ -121,15 +118,12 @@ TdsSocket &TdsSocket::operator=(TdsSocket &&other) noexcept {
 		port_ = other.port_;
 		connected_ = other.connected_;
 		last_error_ = std::move(other.last_error_);
+		framing_error_ = other.framing_error_;
 		tls_context_ = std::move(other.tls_context_);
 		receive_buffer_ = std::move(other.receive_buffer_);
-		receive_len_ = other.receive_len_;
-		receive_pos_ = other.receive_pos_;
 		recv_read_size_ = other.recv_read_size_;
 		other.fd_ = -1;
 		other.connected_ = false;
-		other.receive_len_ = 0;
-		other.receive_pos_ = 0;
 	}
 	return *this;
 }
@@ -144,6 +138,7 @@ bool TdsSocket::Connect(const std::string &host, uint16_t port, int timeout_seco
 	host_ = host;
 	port_ = port;
 	last_error_.clear();
+	framing_error_ = false;
 
 #ifdef _WIN32
 	MSSQL_SOCKET_DEBUG_LOG(2, "Connect: initializing Winsock");
@@ -279,8 +274,7 @@ void TdsSocket::Close() {
 		fd_ = -1;
 	}
 	connected_ = false;
-	receive_len_ = 0;
-	receive_pos_ = 0;
+	receive_buffer_.Clear();
 }
 
 bool TdsSocket::IsConnected() const {
@@ -296,12 +290,11 @@ bool TdsSocket::EnableTls(uint8_t &packet_id, int timeout_ms, const std::string
 	MSSQL_SOCKET_DEBUG_LOG(1, "EnableTls: starting (timeout=%dms, fd=%d, packet_id=%d)", timeout_ms, fd_, packet_id);
 
 	// Clear any leftover data in receive buffer before TLS
-	if (receive_len_ > receive_pos_) {
+	if (!receive_buffer_.Empty()) {
 		MSSQL_SOCKET_DEBUG_LOG(1, "EnableTls: WARNING - clearing %zu leftover bytes in receive buffer",
-							   receive_len_ - receive_pos_);
+							   receive_buffer_.Size());
 	}
-	receive_len_ = 0;
-	receive_pos_ = 0;
+	receive_buffer_.Clear();
 
 	if (!IsConnected()) {
 		last_error_ = "Cannot enable TLS: not connected";
@@ -340,6 +333,11 @@ bool TdsSocket::EnableTls(uint8_t &packet_id, int timeout_ms, const std::string
 		return false;
 	}
 
+	// Resume the session of an earlier connection to the same endpoint. The SNI
+	// name is part of the key: behind an Azure gateway one host:port serves
+	// many servers, told apart by SNI only.
+	tls_context_->SetSessionCacheKey(host_ + ":" + std::to_string(port_) + "/" + effective_hostname);
+
 	// Set up TDS-wrapped I/O callbacks for the TLS handshake
 	// The TLS data must be sent inside TDS PRELOGIN packets (type 0x12)
 	MSSQL_SOCKET_DEBUG_LOG(1, "EnableTls: setting up TDS-wrapped TLS I/O...");
@@ -570,8 +568,9 @@ bool TdsSocket::EnableTls(uint8_t &packet_id, int timeout_ms, const std::string
 	// (the TLS layer is now established, further TDS packets go through it)
 	tls_context_->ClearBioCallbacks();
 
-	MSSQL_SOCKET_DEBUG_LOG(1, "EnableTls: SUCCESS - cipher=%s, version=%s", tls_context_->GetCipherSuite().c_str(),
-						   tls_context_->GetTlsVersion().c_str());
+	MSSQL_SOCKET_DEBUG_LOG(1, "EnableTls: SUCCESS - cipher=%s, version=%s, resumed=%s",
+						   tls_context_->GetCipherSuite().c_str(), tls_context_->GetTlsVersion().c_str(),
+						   tls_context_->IsSessionReused() ? "yes" : "no");
 	return true;
 }
 
@@ -593,14 +592,39 @@ std::string TdsSocket::GetTlsVersion() const {
 	return tls_context_->GetTlsVersion();
 }
 
+bool TdsSocket::IsTlsSessionReused() const {
+	return tls_context_ && tls_context_->IsSessionReused();
+}
+
+bool TdsSocket::IsKernelTlsRx() const {
+	return tls_context_ && tls_context_->IsKernelTlsRx();
+}
+
+bool TdsSocket::IsKernelTlsTx() const {
+	return tls_context_ && tls_context_->IsKernelTlsTx();
+}
+
+bool TdsSocket::EnableKernelTls() {
+	if (!tls_context_) {
+		last_error_ = "TLS is not enabled";
+		return false;
+	}
+	if (!tls_context_->EnableKernelTls()) {
+		last_error_ = "Kernel TLS not enabled: " + tls_context_->GetLastError();
+		MSSQL_SOCKET_DEBUG_LOG(1, "EnableKernelTls: %s", last_error_.c_str());
+		return false;
+	}
+	return true;
+}
+
 bool TdsSocket::Send(const uint8_t *data, size_t length) {
 	if (!IsConnected()) {
 		last_error_ = "Not connected";
 		return false;
 	}
 
-	// Route through TLS if enabled
-	if (tls_context_) {
+	// Route through TLS if enabled, unless the kernel encrypts for us
+	if (tls_context_ && !tls_context_->IsKernelTlsTx()) {
 		ssize_t sent = tls_context_->Send(data, length);
 		if (sent < 0) {
 			last_error_ = "TLS send failed: " + tls_context_->GetLastError();
@@ -613,7 +637,7 @@ bool TdsSocket::Send(const uint8_t *data, size_t length) {
 		return true;
 	}
 
-	// Plain TCP send
+	// Plain TCP send (kernel TLS frames and encrypts it)
 	size_t total_sent = 0;
 	while (total_sent < length) {
 		ssize_t sent = send(fd_, SOCK_BUF_CONST_CAST(data + total_sent), length - total_sent, MSG_NOSIGNAL);
@@ -650,8 +674,8 @@ ssize_t TdsSocket::Receive(uint8_t *buffer, size_t max_length, int timeout_ms) {
 		return -1;
 	}
 
-	// Route through TLS if enabled
-	if (tls_context_) {
+	// Route through TLS if enabled, unless the kernel decrypts for us
+	if (tls_context_ && !tls_context_->IsKernelTlsRx()) {
 		ssize_t received = tls_context_->Receive(buffer, max_length, timeout_ms);
 		if (received < 0) {
 			last_error_ = "TLS receive failed: " + tls_context_->GetLastError();
@@ -663,7 +687,28 @@ ssize_t TdsSocket::Receive(uint8_t *buffer, size_t max_length, int timeout_ms) {
 		return received;
 	}
 
-	// Plain TCP receive
+	// Plain TCP receive. Under kernel TLS recv() returns decrypted record
+	// payload; a non-data record (an alert) fails it with EIO.
+#ifndef _WIN32
+	// Read first, wait only if there was nothing: while a result streams in,
+	// the next frame is usually already queued, and a poll() in front of every
+	// recv() doubled the syscalls per packet for nothing
+	ssize_t ready = recv(fd_, SOCK_BUF_CAST(buffer), max_length, MSG_DONTWAIT);
+	if (ready > 0) {
+		return ready;
+	}
+	if (ready == 0) {
+		last_error_ = "Connection closed by server";
+		connected_ = false;
+		return -1;
+	}
+	if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+		last_error_ = "Receive failed: " + std::string(strerror(errno));
+		connected_ = false;
+		return -1;
+	}
+#endif
+
 	// Wait for data with timeout
 	if (!WaitForReady(false, timeout_ms)) {
 		// If connected_ was set to false, it's an error not timeout
@@ -702,12 +747,10 @@ void TdsSocket::SetReceiveFraming(uint32_t packet_size, uint32_t frames) {
 	// Nothing is staged in a scratch buffer any more — recv() reads into the tail
 	// of the assembly buffer — so this is only the read granularity.
 	recv_read_size_ = scratch;
-	receive_len_ = 0;
-	receive_pos_ = 0;
+	receive_buffer_.Clear();
 	// Sized ONCE, here: one full read plus a whole frame, so a frame split across
-	// two reads never forces a growth. resize() rather than reserve() because
-	// this vector's size is its capacity — the content length is receive_len_.
-	receive_buffer_.resize(scratch + packet_size);
+	// two reads never forces a growth.
+	receive_buffer_.Reserve(scratch + packet_size);
 	MSSQL_SOCKET_DEBUG_LOG(1, "SetReceiveFraming: packet_size=%u frames=%u read=%zuB", packet_size, frames, scratch);
 }
 
@@ -716,18 +759,13 @@ const uint8_t *TdsSocket::NextPacket(size_t &packet_length, int timeout_ms) {
 	// they do with the bytes, so the framing lives here once.
 	//
 	// The returned view points into the assembly buffer and stays valid until the
-	// next receive call on this socket: receive_pos_ advances now, but the buffer
-	// is only cleared or compacted at the top of the NEXT call.
+	// next receive call on this socket: the frame is consumed now, but consuming
+	// only moves the ring's head — its bytes are overwritten no earlier than the
+	// next read.
 	while (true) {
-		if (receive_pos_ > 0 && receive_pos_ == receive_len_) {
-			// Fully drained — rewind instead of walking an ever-growing offset.
-			receive_len_ = 0;
-			receive_pos_ = 0;
-		}
-
-		const size_t buffered = receive_len_ - receive_pos_;
+		const size_t buffered = receive_buffer_.Size();
 		if (buffered >= TDS_HEADER_SIZE) {
-			const uint8_t *head = receive_buffer_.data() + receive_pos_;
+			const uint8_t *head = receive_buffer_.Data();
 			const uint16_t expected_length = TdsPacket::GetPacketLength(head);
 			if (expected_length < TDS_HEADER_SIZE) {
 				// A frame cannot be shorter than its own header. Rejected HERE
@@ -737,27 +775,18 @@ const uint8_t *TdsSocket::NextPacket(size_t &packet_length, int timeout_ms) {
 				// forever, reporting a timeout instead of a malformed stream.
 				last_error_ = "Invalid TDS packet length: " + std::to_string(expected_length) +
 							  " is shorter than the 8-byte header";
+				framing_error_ = true;
 				return nullptr;
 			}
 			if (buffered >= expected_length) {
 				packet_length = expected_length;
-				receive_pos_ += expected_length;
+				receive_buffer_.Consume(expected_length);
 				return head;
 			}
 		}
 
-		// Compact before reading more: move the straddling tail to the front so
-		// the read always has a full read_size of room. One memmove per read, not
-		// one per packet, and it moves at most one frame.
-		if (receive_pos_ > 0) {
-			const size_t tail = receive_len_ - receive_pos_;
-			if (tail > 0) {
-				std::memmove(receive_buffer_.data(), receive_buffer_.data() + receive_pos_, tail);
-			}
-			receive_len_ = tail;
-			receive_pos_ = 0;
-		}
-
+		// No compaction before reading more: the straddling tail stays where it
+		// is and the read lands after it, across the wrap if need be.
 		if (!FillReceiveBuffer(timeout_ms)) {
 			return nullptr;
 		}
@@ -775,7 +804,8 @@ bool TdsSocket::ReceivePacket(TdsPacket &packet, int timeout_ms) {
 	return TdsPacket::Parse(head, packet_length, packet) > 0;
 }
 
-bool TdsSocket::ReceivePayloadView(const uint8_t *&payload, size_t &payload_length, int timeout_ms) {
+bool TdsSocket::ReceivePayloadView(const uint8_t *&payload, size_t &payload_length, int timeout_ms,
+								   bool *end_of_message) {
 	// The streaming read path needs the payload bytes in the token parser and
 	// nothing else from the packet. ReceivePacket copied them into
 	// TdsPacket::payload_ so the caller could copy them again — two passes over
@@ -789,32 +819,32 @@ bool TdsSocket::ReceivePayloadView(const uint8_t *&payload, size_t &payload_leng
 	}
 	if (packet_length < TDS_HEADER_SIZE || packet_length > TDS_MAX_PACKET_SIZE) {
 		last_error_ = "Invalid TDS packet length";
+		framing_error_ = true;
 		return false;
 	}
 	payload = head + TDS_HEADER_SIZE;
 	payload_length = packet_length - TDS_HEADER_SIZE;
+	if (end_of_message) {
+		*end_of_message = (head[1] & static_cast<uint8_t>(PacketStatus::END_OF_MESSAGE)) != 0;
+	}
 	return true;
 }
 
 bool TdsSocket::FillReceiveBuffer(int timeout_ms) {
-	// recv() straight into the tail of the assembly buffer, with no resize.
+	// recv() straight into the tail of the assembly buffer.
 	//
 	// Two passes over the read buffer used to happen here for no reason: a
 	// scratch buffer that was immediately insert()ed into this one, and then —
 	// once that was removed — a resize() that value-initialised the very bytes
-	// recv() was about to write. The vector is sized once in SetReceiveFraming
-	// and `receive_len_` carries the content length instead.
-	const size_t room = receive_buffer_.size() - receive_len_;
-	if (room < recv_read_size_) {
-		// Only reachable before SetReceiveFraming has run (PRELOGIN/LOGIN7 on the
-		// default frame size) or if a peer sent a frame larger than negotiated.
-		receive_buffer_.resize(receive_len_ + recv_read_size_);
-	}
-	const ssize_t received = Receive(receive_buffer_.data() + receive_len_, recv_read_size_, timeout_ms);
+	// recv() was about to write. PrepareWrite hands back uninitialised room; it
+	// only grows the ring before SetReceiveFraming has run (PRELOGIN/LOGIN7 on
+	// the default frame size) or if a peer sent a frame larger than negotiated.
+	uint8_t *room = receive_buffer_.PrepareWrite(recv_read_size_);
+	const ssize_t received = Receive(room, recv_read_size_, timeout_ms);
 	if (received <= 0) {
 		return false;
 	}
-	receive_len_ += static_cast<size_t>(received);
+	receive_buffer_.CommitWrite(static_cast<size_t>(received));
 	return true;
 }
 
@@ -31,13 +31,12 @@ namespace tds {
 // TokenParser Implementation
 //===----------------------------------------------------------------------===//
 
-TokenParser::TokenParser() : state_(ParserState::WaitingForToken), buffer_pos_(0) {}
+TokenParser::TokenParser(RingBuffer::Layout layout) : state_(ParserState::WaitingForToken), buffer_(layout) {}
 
 void TokenParser::Reset() {
 	state_ = ParserState::WaitingForToken;
 	parse_error_.clear();
-	buffer_.clear();
-	buffer_pos_ = 0;
+	buffer_.Clear();
 	columns_.clear();
 	skip_descs_.clear();
 	current_row_.Clear();
@@ -47,29 +46,23 @@ void TokenParser::Reset() {
 	// The buffer is gone, so a deferred consume would advance past live data of
 	// the next result set.
 	pending_consume_ = 0;
-	raw_row_offset_ = 0;
 	raw_row_length_ = 0;
 }
 
 void TokenParser::Feed(const uint8_t *data, size_t length) {
-	buffer_.insert(buffer_.end(), data, data + length);
+	buffer_.Append(data, length);
 }
 
 void TokenParser::Feed(const std::vector<uint8_t> &data) {
-	buffer_.insert(buffer_.end(), data.begin(), data.end());
+	buffer_.Append(data.data(), data.size());
 }
 
 void TokenParser::ConsumeBytes(size_t count) {
-	buffer_pos_ += count;
-	CompactBuffer();
-}
-
-void TokenParser::CompactBuffer() {
-	// Compact buffer if we've consumed more than half
-	if (buffer_pos_ > buffer_.size() / 2 && buffer_pos_ > 4096) {
-		buffer_.erase(buffer_.begin(), buffer_.begin() + buffer_pos_);
-		buffer_pos_ = 0;
-	}
+	// O(1) on the ring: the head moves, nothing is erased or compacted. This
+	// used to erase() the consumed half of a vector once it passed 4 KB — a
+	// memmove of everything still buffered, so that a row straddling two
+	// packets stayed contiguous. The mirrored ring keeps it contiguous instead.
+	buffer_.Consume(count);
 }
 
 ParsedTokenType TokenParser::TryParseNext() {
@@ -84,8 +77,8 @@ ParsedTokenType TokenParser::TryParseNext() {
 	// looped forever. The length checks below now add in size_t so they cannot
 	// wrap, and ConsumeBytes always advances by at least the token header.
 	// Raw-row mode defers the consume of the previous row to here, so the bytes
-	// stayed addressable while the caller walked them. Doing it inside ParseRow
-	// would compact the buffer out from under the pointer we handed out.
+	// stayed addressable while the caller walked them: GetRawRow() is relative
+	// to the front of the buffer, which a consume inside ParseRow would move.
 	if (pending_consume_ > 0) {
 		const size_t count = pending_consume_;
 		pending_consume_ = 0;
@@ -152,9 +145,22 @@ ParsedTokenType TokenParser::TryParseNext() {
 			}
 			return ParsedTokenType::NeedMoreData;
 
-		case TokenType::ORDER:
 		case TokenType::RETURNSTATUS:
+			// RETURNSTATUS (0x79): fixed LONG value, no length prefix. Sent after
+			// every RPC (sp_executesql) response, before DONEPROC.
+			if (Available() < 5) {
+				return ParsedTokenType::NeedMoreData;
+			}
+			ConsumeBytes(5);
+			continue;
+
 		case TokenType::RETURNVALUE:
+			if (ParseReturnValue()) {
+				return ParsedTokenType::ReturnValue;
+			}
+			return ParsedTokenType::NeedMoreData;
+
+		case TokenType::ORDER:
 		case TokenType::LOGINACK:
 		case TokenType::TABNAME:
 		case TokenType::COLINFO:
@@ -230,8 +236,8 @@ ParsedTokenType TokenParser::TryParseNext() {
 				for (size_t i = 0; i < dump_len; i++) {
 					hex_dump << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(Current()[i]) << " ";
 				}
-				TDS_PARSER_DEBUG(1, "Unknown token 0x%02x at pos=%zu, buffer_size=%zu, available=%zu, hex: %s",
-								 token_type, buffer_pos_, buffer_.size(), Available(), hex_dump.str().c_str());
+				TDS_PARSER_DEBUG(1, "Unknown token 0x%02x, available=%zu, hex: %s", token_type, Available(),
+								 hex_dump.str().c_str());
 			}
 			parse_error_ = "Unknown token type: 0x" + std::to_string(token_type);
 			state_ = ParserState::Error;
@@ -312,7 +318,6 @@ bool TokenParser::ParseRow() {
 		if (!reader.SkipRow(data, length, bytes_consumed)) {
 			return false;  // Need more data
 		}
-		raw_row_offset_ = buffer_pos_ + 1;
 		raw_row_length_ = bytes_consumed;
 		raw_row_nbc_ = false;
 		pending_consume_ = 1 + bytes_consumed;
@@ -368,7 +373,6 @@ bool TokenParser::ParseNBCRow() {
 		if (!reader.SkipNBCRow(data, length, bytes_consumed)) {
 			return false;  // Need more data
 		}
-		raw_row_offset_ = buffer_pos_ + 1;
 		raw_row_length_ = bytes_consumed;
 		raw_row_nbc_ = true;
 		pending_consume_ = 1 + bytes_consumed;
@@ -443,6 +447,101 @@ static bool ParseBVarchar(const uint8_t *data, size_t length, size_t &offset, st
 	return true;
 }
 
+bool TokenParser::ParseReturnValue() {
+	// RETURNVALUE: type, USHORT ParamOrdinal, B_VARCHAR ParamName, BYTE Status,
+	// ULONG UserType, USHORT Flags, TYPE_INFO, TYPE_VARBYTE value. No length
+	// prefix, so the whole value must be buffered before anything is consumed.
+	const uint8_t *data = Current();
+	const size_t length = Available();
+	size_t offset = 1;
+
+	if (offset + 2 > length) {
+		return false;
+	}
+	uint16_t ordinal = static_cast<uint16_t>(data[offset]) | (static_cast<uint16_t>(data[offset + 1]) << 8);
+	offset += 2;
+
+	std::string name;
+	if (!ParseBVarchar(data, length, offset, name)) {
+		return false;
+	}
+
+	// Status (1) + UserType (4) + Flags (2)
+	if (offset + 7 > length) {
+		return false;
+	}
+	offset += 7;
+	ColumnMetadata type_info;
+	if (!ColumnMetadataParser::ParseTypeInfo(data, length, offset, type_info)) {
+		return false;
+	}
+
+	current_return_value_.ordinal = ordinal;
+	current_return_value_.type_id = type_info.type_id;
+	if (type_info.type_id != TDS_TYPE_INTN) {
+		// Not one this client decodes. Skip the value with the row reader's own
+		// framing so the tokens after it stay in sync; only a reader that asked
+		// for this parameter treats it as an error.
+		const std::vector<ColumnMetadata> columns {type_info};
+		RowReader reader(columns);
+		const size_t value_size = reader.SkipValue(data + offset, length - offset, 0);
+		if (value_size == 0) {
+			return false;
+		}
+		offset += value_size;
+		current_return_value_.name = std::move(name);
+		current_return_value_.decoded = false;
+		current_return_value_.is_null = true;
+		current_return_value_.int_value = 0;
+		TDS_PARSER_DEBUG(1, "ParseReturnValue: ordinal=%u, type 0x%02X skipped (%zu bytes)", ordinal,
+						 type_info.type_id, value_size);
+		ConsumeBytes(offset);
+		return true;
+	}
+
+	// INTN: a 1-byte value length, then the integer
+	if (offset + 1 > length) {
+		return false;
+	}
+	const uint8_t value_length = data[offset++];
+	if (value_length != 0 && value_length != 1 && value_length != 2 && value_length != 4 && value_length != 8) {
+		parse_error_ = "RETURNVALUE: invalid integer length";
+		state_ = ParserState::Error;
+		return false;
+	}
+	if (offset + value_length > length) {
+		return false;
+	}
+
+	current_return_value_.name = std::move(name);
+	current_return_value_.decoded = true;
+	current_return_value_.is_null = value_length == 0;
+	uint64_t raw = 0;
+	for (uint8_t i = 0; i < value_length; i++) {
+		raw |= static_cast<uint64_t>(data[offset + i]) << (8 * i);
+	}
+	switch (value_length) {
+	case 1:
+		current_return_value_.int_value = static_cast<uint8_t>(raw);  // tinyint is unsigned
+		break;
+	case 2:
+		current_return_value_.int_value = static_cast<int16_t>(raw);
+		break;
+	case 4:
+		current_return_value_.int_value = static_cast<int32_t>(raw);
+		break;
+	default:
+		current_return_value_.int_value = static_cast<int64_t>(raw);
+		break;
+	}
+	offset += value_length;
+
+	TDS_PARSER_DEBUG(2, "ParseReturnValue: ordinal=%u, null=%d, value=%lld", ordinal, current_return_value_.is_null,
+					 (long long)current_return_value_.int_value);
+	ConsumeBytes(offset);
+	return true;
+}
+
 bool TokenParser::ParseError() {
 	// ERROR token: 1 type + 2 length + error data
 	if (Available() < 3) {
@@ -144,6 +144,12 @@ void TlsTdsContext::ClearBioCallbacks() {
 	}
 }
 
+void TlsTdsContext::SetSessionCacheKey(const std::string &key) {
+	if (impl_->tls) {
+		impl_->tls->SetSessionCacheKey(key);
+	}
+}
+
 bool TlsTdsContext::Handshake(int timeout_ms) {
 	MSSQL_TLS_DEBUG_LOG(1, "Handshake: starting (timeout=%dms)", timeout_ms);
 	if (!impl_->tls) {
@@ -215,5 +221,28 @@ std::string TlsTdsContext::GetTlsVersion() const {
 	return impl_->tls ? impl_->tls->GetTlsVersion() : "";
 }
 
+bool TlsTdsContext::IsSessionReused() const {
+	return impl_->tls && impl_->tls->IsSessionReused();
+}
+
+bool TlsTdsContext::EnableKernelTls() {
+	if (!impl_->tls) {
+		return false;
+	}
+	if (impl_->tls->EnableKernelTls()) {
+		return true;
+	}
+	impl_->last_error = impl_->tls->GetLastError();
+	return false;
+}
+
+bool TlsTdsContext::IsKernelTlsRx() const {
+	return impl_->tls && impl_->tls->IsKernelTlsRx();
+}
+
+bool TlsTdsContext::IsKernelTlsTx() const {
+	return impl_->tls && impl_->tls->IsKernelTlsTx();
+}
+
 }  // namespace tds
 }  // namespace duckdb
@@ -12,6 +12,7 @@
 
 #include <openssl/bio.h>
 #include <openssl/err.h>
+#include <openssl/kdf.h>
 #include <openssl/ssl.h>
 
 #include <cerrno>
@@ -19,7 +20,10 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -35,6 +39,21 @@
 #endif
 #endif
 
+// Kernel TLS (Linux only, and only where the uapi header exists)
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/tls.h>)
+#include <linux/tls.h>
+#include <netinet/tcp.h>
+#define MSSQL_HAVE_KTLS 1
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif
+#endif
+
 namespace duckdb {
 namespace tds {
 
@@ -73,6 +92,20 @@ struct TlsImplContext {
 	TlsRecvCallback recv_callback;
 	int current_timeout_ms;	 // Timeout for current operation
 
+	// Session resumption: cache slot this connection offers from and stores
+	// into (empty = no resumption), and whether the server accepted the offer
+	std::string session_key;
+	bool session_reused;
+
+	// Kernel TLS: record decryption (rx) / encryption (tx) moved into the
+	// socket after the handshake; OpenSSL no longer touches that direction
+	bool kernel_tls_rx;
+	bool kernel_tls_tx;
+
+	// SO_RCVTIMEO currently on the socket (0 = never set). Receive() is called
+	// per TLS read, and re-setting an unchanged value cost a syscall each time.
+	int applied_rcv_timeout_ms;
+
 	TlsImplContext()
 		: ssl_ctx(nullptr),
 		  ssl(nullptr),
@@ -81,7 +114,11 @@ struct TlsImplContext {
 		  handshake_complete(false),
 		  socket_fd(-1),
 		  last_error_code(0),
-		  current_timeout_ms(30000) {}
+		  current_timeout_ms(30000),
+		  session_reused(false),
+		  kernel_tls_rx(false),
+		  kernel_tls_tx(false),
+		  applied_rcv_timeout_ms(0) {}
 
 	~TlsImplContext() {
 		if (ssl) {
@@ -245,6 +282,82 @@ static BIO_METHOD *GetCustomBioMethod() {
 	return method;
 }
 
+// =============================================================================
+// Client session cache
+// =============================================================================
+// Every connection gets its own SSL_CTX, so OpenSSL's per-context client cache
+// would never see a second handshake. Sessions are kept here instead, one per
+// (host, port, SNI) key, for the life of the process: the last session or
+// TLS 1.3 ticket the server issued is offered on the next handshake to the
+// same key, which then skips the certificate exchange and the key agreement.
+// A session carries no login, so every attachment to a server shares its slot.
+//
+// Deliberately leaked like the BIO method above: a static destructor could run
+// after OpenSSL's own atexit cleanup.
+
+static constexpr size_t SESSION_CACHE_MAX_ENTRIES = 256;
+
+struct TlsSessionCache {
+	std::mutex lock;
+	std::unordered_map<std::string, SSL_SESSION *> sessions;
+};
+
+static TlsSessionCache &GetSessionCache() {
+	static auto *cache = new TlsSessionCache();
+	return *cache;
+}
+
+// Takes ownership of `session`
+static void StoreSession(const std::string &key, SSL_SESSION *session) {
+	auto &cache = GetSessionCache();
+	std::lock_guard<std::mutex> guard(cache.lock);
+	auto it = cache.sessions.find(key);
+	if (it != cache.sessions.end()) {
+		SSL_SESSION_free(it->second);
+		it->second = session;
+		return;
+	}
+	if (cache.sessions.size() >= SESSION_CACHE_MAX_ENTRIES) {
+		// Arbitrary victim: past this size the process talks to so many servers
+		// that no single slot matters
+		SSL_SESSION_free(cache.sessions.begin()->second);
+		cache.sessions.erase(cache.sessions.begin());
+	}
+	cache.sessions.emplace(key, session);
+}
+
+// Returns a new reference, or nullptr when there is nothing usable to offer
+static SSL_SESSION *LookupSession(const std::string &key) {
+	auto &cache = GetSessionCache();
+	std::lock_guard<std::mutex> guard(cache.lock);
+	auto it = cache.sessions.find(key);
+	if (it == cache.sessions.end()) {
+		return nullptr;
+	}
+	SSL_SESSION *session = it->second;
+	auto age = static_cast<long>(time(nullptr)) - static_cast<long>(SSL_SESSION_get_time(session));
+	if (!SSL_SESSION_is_resumable(session) || age >= static_cast<long>(SSL_SESSION_get_timeout(session))) {
+		SSL_SESSION_free(session);
+		cache.sessions.erase(it);
+		return nullptr;
+	}
+	SSL_SESSION_up_ref(session);
+	return session;
+}
+
+// SSL_CTX new-session callback. TLS 1.2 sessions arrive during the handshake,
+// TLS 1.3 tickets after it, on whichever SSL_read() meets them. Returning 1
+// keeps the reference OpenSSL handed over.
+static int OnNewSession(SSL *ssl, SSL_SESSION *session) {
+	auto *impl = static_cast<TlsImplContext *>(SSL_get_app_data(ssl));
+	if (!impl || impl->session_key.empty()) {
+		return 0;
+	}
+	MSSQL_TLS_DEBUG_LOG(2, "OnNewSession: caching session for %s", impl->session_key.c_str());
+	StoreSession(impl->session_key, session);
+	return 1;
+}
+
 // =============================================================================
 // Helper functions
 // =============================================================================
@@ -307,6 +420,11 @@ bool TlsImpl::Initialize() {
 	// This is appropriate for development/testing - production should verify
 	SSL_CTX_set_verify(ctx_->ssl_ctx, SSL_VERIFY_NONE, nullptr);
 
+	// Hand new sessions to the process-wide cache instead of this context's
+	// own store, which dies with the connection
+	SSL_CTX_set_session_cache_mode(ctx_->ssl_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+	SSL_CTX_sess_set_new_cb(ctx_->ssl_ctx, OnNewSession);
+
 	// Create SSL object
 	ctx_->ssl = SSL_new(ctx_->ssl_ctx);
 	if (!ctx_->ssl) {
@@ -325,8 +443,9 @@ bool TlsImpl::Initialize() {
 		return false;
 	}
 
-	// Store context pointer in BIO for callbacks
+	// Store context pointer in BIO for callbacks, and in SSL for OnNewSession
 	BIO_set_data(ctx_->bio, ctx_.get());
+	SSL_set_app_data(ctx_->ssl, ctx_.get());
 
 	// Attach BIO to SSL (SSL takes ownership)
 	SSL_set_bio(ctx_->ssl, ctx_->bio, ctx_->bio);
@@ -385,6 +504,17 @@ bool TlsImpl::Handshake(int timeout_ms) {
 	// Set SSL to client mode
 	SSL_set_connect_state(ctx_->ssl);
 
+	// Offer the last session for this server; a server that no longer knows
+	// it just runs the full handshake
+	ctx_->session_reused = false;
+	if (!ctx_->session_key.empty()) {
+		SSL_SESSION *session = LookupSession(ctx_->session_key);
+		if (session) {
+			SSL_set_session(ctx_->ssl, session);
+			SSL_SESSION_free(session);	// SSL_set_session took its own reference
+		}
+	}
+
 	int ret;
 	while ((ret = SSL_do_handshake(ctx_->ssl)) != 1) {
 		int ssl_error = SSL_get_error(ctx_->ssl, ret);
@@ -434,10 +564,12 @@ bool TlsImpl::Handshake(int timeout_ms) {
 	}
 
 	ctx_->handshake_complete = true;
+	ctx_->session_reused = SSL_session_reused(ctx_->ssl) == 1;
 
 	const char *cipher = SSL_get_cipher(ctx_->ssl);
 	const char *version = SSL_get_version(ctx_->ssl);
-	MSSQL_TLS_DEBUG_LOG(1, "Handshake: SUCCESS - %s, %s", version ? version : "unknown", cipher ? cipher : "unknown");
+	MSSQL_TLS_DEBUG_LOG(1, "Handshake: SUCCESS - %s, %s%s", version ? version : "unknown", cipher ? cipher : "unknown",
+						ctx_->session_reused ? ", resumed" : "");
 
 	return true;
 }
@@ -489,7 +621,8 @@ ssize_t TlsImpl::Receive(uint8_t *buffer, size_t max_length, int timeout_ms) {
 	// because poll() may return "ready" for TLS protocol data while the actual
 	// application-level response has not yet arrived, causing SSL_read() to
 	// block indefinitely.
-	if (timeout_ms > 0) {
+	if (timeout_ms > 0 && timeout_ms != ctx_->applied_rcv_timeout_ms) {
+		ctx_->applied_rcv_timeout_ms = timeout_ms;
 #ifdef _WIN32
 		DWORD tv = static_cast<DWORD>(timeout_ms);
 		setsockopt(ctx_->socket_fd, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char *>(&tv), sizeof(tv));
@@ -559,7 +692,9 @@ ssize_t TlsImpl::Receive(uint8_t *buffer, size_t max_length, int timeout_ms) {
 void TlsImpl::Close() {
 	MSSQL_TLS_DEBUG_LOG(1, "Close: closing TLS connection");
 
-	if (ctx_->handshake_complete && ctx_->ssl) {
+	// No close_notify under kernel TLS: OpenSSL's record state is stale once
+	// the keys live in the socket, so what it wrote would not decrypt
+	if (ctx_->handshake_complete && ctx_->ssl && !ctx_->kernel_tls_rx && !ctx_->kernel_tls_tx) {
 		SSL_shutdown(ctx_->ssl);
 	}
 
@@ -580,6 +715,157 @@ void TlsImpl::Close() {
 	ctx_->socket_fd = -1;
 	ctx_->last_error.clear();
 	ctx_->last_error_code = 0;
+	ctx_->session_reused = false;
+	ctx_->kernel_tls_rx = false;
+	ctx_->kernel_tls_tx = false;
+	ctx_->applied_rcv_timeout_ms = 0;
+}
+
+void TlsImpl::SetSessionCacheKey(const std::string &key) {
+	ctx_->session_key = key;
+}
+
+bool TlsImpl::IsSessionReused() const {
+	return ctx_->session_reused;
+}
+
+#ifdef MSSQL_HAVE_KTLS
+// One direction's crypto_info for a TLS 1.2 AES-GCM record layer. The explicit
+// nonce only has to be unique per key; starting it at the record sequence
+// number is what OpenSSL's own kTLS code does.
+template <class CRYPTO_INFO>
+static void FillGcmCryptoInfo(CRYPTO_INFO &info, uint16_t cipher_type, const unsigned char *key,
+							  const unsigned char *salt, uint64_t seq) {
+	std::memset(&info, 0, sizeof(info));
+	info.info.version = TLS_1_2_VERSION;
+	info.info.cipher_type = cipher_type;
+	std::memcpy(info.key, key, sizeof(info.key));
+	std::memcpy(info.salt, salt, sizeof(info.salt));
+	for (int i = 7; i >= 0; i--) {
+		info.rec_seq[i] = static_cast<unsigned char>(seq & 0xFF);
+		seq >>= 8;
+	}
+	std::memcpy(info.iv, info.rec_seq, sizeof(info.iv));
+}
+#endif
+
+bool TlsImpl::EnableKernelTls() {
+#ifndef MSSQL_HAVE_KTLS
+	ctx_->last_error = "Kernel TLS is only available on Linux";
+	return false;
+#else
+	if (!ctx_->handshake_complete || !ctx_->ssl) {
+		ctx_->last_error = "Handshake not complete";
+		return false;
+	}
+	if (ctx_->kernel_tls_rx) {
+		return true;
+	}
+
+	// Scope: TLS 1.2 with AES-GCM, which is what SQL Server negotiates for a
+	// TDS 7.x login. TLS 1.3 would need the traffic secrets and post-handshake
+	// messages (tickets, KeyUpdate) handled as kernel control records.
+	if (SSL_version(ctx_->ssl) != TLS1_2_VERSION) {
+		ctx_->last_error = std::string("Kernel TLS needs TLS 1.2, negotiated ") + SSL_get_version(ctx_->ssl);
+		return false;
+	}
+	const SSL_CIPHER *cipher = SSL_get_current_cipher(ctx_->ssl);
+	const int cipher_nid = cipher ? SSL_CIPHER_get_cipher_nid(cipher) : NID_undef;
+	size_t key_len;
+	if (cipher_nid == NID_aes_128_gcm) {
+		key_len = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+	} else if (cipher_nid == NID_aes_256_gcm) {
+		key_len = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+	} else {
+		ctx_->last_error = std::string("Kernel TLS needs an AES-GCM cipher, negotiated ") +
+						   (cipher ? SSL_CIPHER_get_name(cipher) : "none");
+		return false;
+	}
+	// Anything OpenSSL already read past the handshake would be lost
+	if (SSL_has_pending(ctx_->ssl)) {
+		ctx_->last_error = "Records already buffered by OpenSSL";
+		return false;
+	}
+
+	// Key block (RFC 5246 6.3): PRF(master_secret, "key expansion",
+	// server_random + client_random), cut into client key, server key, client
+	// salt, server salt. GCM suites have no MAC keys.
+	const size_t salt_len = TLS_CIPHER_AES_GCM_128_SALT_SIZE;
+	unsigned char master[SSL_MAX_MASTER_KEY_LENGTH];
+	unsigned char randoms[2 * SSL3_RANDOM_SIZE];
+	unsigned char key_block[2 * TLS_CIPHER_AES_GCM_256_KEY_SIZE + 2 * TLS_CIPHER_AES_GCM_128_SALT_SIZE];
+	size_t block_len = 2 * key_len + 2 * salt_len;
+	const size_t master_len = SSL_SESSION_get_master_key(SSL_get_session(ctx_->ssl), master, sizeof(master));
+	SSL_get_server_random(ctx_->ssl, randoms, SSL3_RANDOM_SIZE);
+	SSL_get_client_random(ctx_->ssl, randoms + SSL3_RANDOM_SIZE, SSL3_RANDOM_SIZE);
+
+	static const char LABEL[] = "key expansion";
+	EVP_PKEY_CTX *prf = EVP_PKEY_CTX_new_id(EVP_PKEY_TLS1_PRF, nullptr);
+	bool derived = prf && EVP_PKEY_derive_init(prf) > 0 &&
+				   EVP_PKEY_CTX_set_tls1_prf_md(prf, SSL_CIPHER_get_handshake_digest(cipher)) > 0 &&
+				   EVP_PKEY_CTX_set1_tls1_prf_secret(prf, master, static_cast<int>(master_len)) > 0 &&
+				   EVP_PKEY_CTX_add1_tls1_prf_seed(prf, reinterpret_cast<const unsigned char *>(LABEL),
+												   sizeof(LABEL) - 1) > 0 &&
+				   EVP_PKEY_CTX_add1_tls1_prf_seed(prf, randoms, sizeof(randoms)) > 0 &&
+				   EVP_PKEY_derive(prf, key_block, &block_len) > 0;
+	EVP_PKEY_CTX_free(prf);
+	OPENSSL_cleanse(master, sizeof(master));
+	if (!derived) {
+		OPENSSL_cleanse(key_block, sizeof(key_block));
+		ctx_->last_error = "Key expansion failed: " + FormatOpenSSLError();
+		return false;
+	}
+	const unsigned char *client_key = key_block;
+	const unsigned char *server_key = key_block + key_len;
+	const unsigned char *client_salt = key_block + 2 * key_len;
+	const unsigned char *server_salt = client_salt + salt_len;
+
+	// Each side has sent exactly one record under these keys, its Finished
+	// (full and abbreviated handshake alike), so both directions continue at 1
+	const uint64_t seq = 1;
+	bool rx_ok, tx_ok;
+	if (key_len == TLS_CIPHER_AES_GCM_128_KEY_SIZE) {
+		tls12_crypto_info_aes_gcm_128 rx, tx;
+		FillGcmCryptoInfo(rx, TLS_CIPHER_AES_GCM_128, server_key, server_salt, seq);
+		FillGcmCryptoInfo(tx, TLS_CIPHER_AES_GCM_128, client_key, client_salt, seq);
+		rx_ok = setsockopt(ctx_->socket_fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0 &&
+				setsockopt(ctx_->socket_fd, SOL_TLS, TLS_RX, &rx, sizeof(rx)) == 0;
+		tx_ok = rx_ok && setsockopt(ctx_->socket_fd, SOL_TLS, TLS_TX, &tx, sizeof(tx)) == 0;
+		OPENSSL_cleanse(&rx, sizeof(rx));
+		OPENSSL_cleanse(&tx, sizeof(tx));
+	} else {
+		tls12_crypto_info_aes_gcm_256 rx, tx;
+		FillGcmCryptoInfo(rx, TLS_CIPHER_AES_GCM_256, server_key, server_salt, seq);
+		FillGcmCryptoInfo(tx, TLS_CIPHER_AES_GCM_256, client_key, client_salt, seq);
+		rx_ok = setsockopt(ctx_->socket_fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0 &&
+				setsockopt(ctx_->socket_fd, SOL_TLS, TLS_RX, &rx, sizeof(rx)) == 0;
+		tx_ok = rx_ok && setsockopt(ctx_->socket_fd, SOL_TLS, TLS_TX, &tx, sizeof(tx)) == 0;
+		OPENSSL_cleanse(&rx, sizeof(rx));
+		OPENSSL_cleanse(&tx, sizeof(tx));
+	}
+	const int sys_err = errno;
+	OPENSSL_cleanse(key_block, sizeof(key_block));
+
+	// Receive first: until TLS_RX succeeds nothing has changed (an attached
+	// "tls" ULP without keys passes records through untouched). If only the
+	// send side fails, OpenSSL keeps encrypting, and the kernel still decrypts.
+	ctx_->kernel_tls_rx = rx_ok;
+	ctx_->kernel_tls_tx = tx_ok;
+	if (!rx_ok) {
+		ctx_->last_error = std::string("setsockopt(SOL_TLS) failed: ") + strerror(sys_err);
+		return false;
+	}
+	MSSQL_TLS_DEBUG_LOG(1, "EnableKernelTls: receive offloaded, send %s", tx_ok ? "offloaded" : "in OpenSSL");
+	return true;
+#endif
+}
+
+bool TlsImpl::IsKernelTlsRx() const {
+	return ctx_->kernel_tls_rx;
+}
+
+bool TlsImpl::IsKernelTlsTx() const {
+	return ctx_->kernel_tls_tx;
 }
 
 void TlsImpl::SetBioCallbacks(TlsSendCallback send_cb, TlsRecvCallback recv_cb) {
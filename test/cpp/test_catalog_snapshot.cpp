@@ -0,0 +1,164 @@
+// test/cpp/test_catalog_snapshot.cpp
+//
+// Unit tests for the catalog snapshot file (catalog/mssql_catalog_snapshot.hpp).
+//
+// No SQL Server, no linking, no DuckDB submodule: the header is deliberately
+// self-contained, so -I src/include is the whole build recipe.
+//
+// What matters is that a damaged or foreign file is REJECTED rather than half
+// read. A snapshot that decodes wrongly hands the catalog wrong column types
+// for tables whose object_id and modify_date still match, and nothing on the
+// server would ever contradict it.
+//
+// Run:
+//   ./build/test/test_catalog_snapshot
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "catalog/mssql_catalog_snapshot.hpp"
+
+using namespace duckdb;
+
+static int g_failures = 0;
+
+static void Expect(bool cond, const std::string &what) {
+	if (!cond) {
+		std::cerr << "FAIL: " << what << "\n";
+		++g_failures;
+	} else {
+		std::cout << "ok: " << what << "\n";
+	}
+}
+
+static MSSQLCatalogSnapshot SampleSnapshot() {
+	MSSQLCatalogSnapshot snapshot;
+	snapshot.key = MSSQLCatalogSnapshotKey("sql01", 1433, "ERP", "etl");
+
+	MSSQLSnapshotTable orders;
+	orders.schema_name = "dbo";
+	orders.name = "Orders";
+	orders.object_id = 1977058079;
+	orders.modify_date = "2026-03-01 10:15:42.123";
+
+	MSSQLSnapshotColumn id;
+	id.name = "id";
+	id.column_id = 1;
+	id.type_name = "int";
+	id.max_length = 4;
+	id.precision = 10;
+	id.is_nullable = false;
+	orders.columns.push_back(id);
+
+	MSSQLSnapshotColumn note;
+	note.name = "note \t\n\xc3\xbc";  // names may hold anything
+	note.column_id = 2;
+	note.type_name = "nvarchar";
+	note.max_length = -1;
+	note.collation_name = "Latin1_General_CI_AS";
+	orders.columns.push_back(note);
+
+	MSSQLSnapshotTable empty_view;
+	empty_view.schema_name = "sales";
+	empty_view.name = "v";
+	empty_view.object_id = -5;
+	empty_view.modify_date = "2026-01-01 00:00:00.000";
+
+	snapshot.tables.push_back(orders);
+	snapshot.tables.push_back(empty_view);
+	return snapshot;
+}
+
+static void TestRoundTrip() {
+	std::cout << "\n-- round trip --\n";
+
+	const auto snapshot = SampleSnapshot();
+	MSSQLCatalogSnapshot decoded;
+	Expect(MSSQLDecodeCatalogSnapshot(MSSQLEncodeCatalogSnapshot(snapshot), decoded), "encoded snapshot decodes");
+	Expect(decoded.key == snapshot.key, "key survives");
+	Expect(decoded.tables.size() == 2, "both tables survive");
+	if (decoded.tables.size() != 2) {
+		return;
+	}
+	const auto &orders = decoded.tables[0];
+	Expect(orders.schema_name == "dbo" && orders.name == "Orders", "names survive");
+	Expect(orders.object_id == 1977058079 && orders.modify_date == "2026-03-01 10:15:42.123", "version survives");
+	Expect(orders.columns.size() == 2, "columns survive");
+	if (orders.columns.size() == 2) {
+		Expect(!orders.columns[0].is_nullable && orders.columns[0].precision == 10, "int column survives");
+		Expect(orders.columns[1].max_length == -1, "MAX length (-1) survives");
+		Expect(orders.columns[1].name == "note \t\n\xc3\xbc", "arbitrary bytes in names survive");
+		Expect(orders.columns[1].collation_name == "Latin1_General_CI_AS", "collation survives");
+	}
+	Expect(decoded.tables[1].object_id == -5 && decoded.tables[1].columns.empty(), "negative object_id survives");
+}
+
+static void TestRejects() {
+	std::cout << "\n-- rejects --\n";
+
+	const std::string data = MSSQLEncodeCatalogSnapshot(SampleSnapshot());
+	MSSQLCatalogSnapshot out;
+
+	Expect(!MSSQLDecodeCatalogSnapshot("", out), "empty file is rejected");
+	Expect(!MSSQLDecodeCatalogSnapshot(data.substr(0, data.size() - 1), out), "truncated file is rejected");
+
+	std::string flipped = data;
+	flipped[data.size() / 2] ^= 0x01;
+	Expect(!MSSQLDecodeCatalogSnapshot(flipped, out), "flipped payload byte is rejected");
+
+	std::string other_version = data;
+	other_version[8] = static_cast<char>(MSSQL_CATALOG_SNAPSHOT_VERSION + 1);
+	Expect(!MSSQLDecodeCatalogSnapshot(other_version, out), "another format version is rejected");
+
+	std::string bad_magic = data;
+	bad_magic[0] = 'X';
+	Expect(!MSSQLDecodeCatalogSnapshot(bad_magic, out), "wrong magic is rejected");
+}
+
+static void TestKeyAndPath() {
+	std::cout << "\n-- key and path --\n";
+
+	Expect(MSSQLCatalogSnapshotKey("SQL01", 1433, "Erp", "ETL") == MSSQLCatalogSnapshotKey("sql01", 1433, "erp", "etl"),
+		   "key ignores case");
+	Expect(MSSQLCatalogSnapshotKey("sql01", 1433, "erp", "etl") != MSSQLCatalogSnapshotKey("sql01", 1434, "erp", "etl"),
+		   "key includes the port");
+	Expect(MSSQLCatalogSnapshotKey("sql01", 1433, "erp", "etl") != MSSQLCatalogSnapshotKey("sql01", 1433, "erp", "bi"),
+		   "key includes the login");
+
+	const auto key = MSSQLCatalogSnapshotKey("sql01", 1433, "erp", "etl");
+	const auto path = MSSQLCatalogSnapshotPath("/var/cache", key);
+	Expect(path == MSSQLCatalogSnapshotPath("/var/cache/", key), "trailing separator does not matter: " + path);
+	Expect(path.size() == std::string("/var/cache/mssql_catalog_0123456789abcdef.snapshot").size(),
+		   "file name holds a 16-digit hash");
+	Expect(path != MSSQLCatalogSnapshotPath("/var/cache", MSSQLCatalogSnapshotKey("sql01", 1433, "crm", "etl")),
+		   "another database gets another file");
+}
+
+static void TestFile() {
+	std::cout << "\n-- file --\n";
+
+	const std::string path = "test_catalog_snapshot.tmp.snapshot";
+	const auto snapshot = SampleSnapshot();
+	Expect(MSSQLWriteCatalogSnapshot(path, snapshot), "snapshot is written");
+	Expect(MSSQLWriteCatalogSnapshot(path, snapshot), "snapshot is overwritten");
+
+	MSSQLCatalogSnapshot read;
+	Expect(MSSQLReadCatalogSnapshot(path, read) && read.tables.size() == 2, "snapshot reads back");
+	std::remove(path.c_str());
+
+	Expect(!MSSQLReadCatalogSnapshot(path, read), "missing file is not a snapshot");
+}
+
+int main() {
+	TestRoundTrip();
+	TestRejects();
+	TestKeyAndPath();
+	TestFile();
+	if (g_failures > 0) {
+		std::cerr << "\n" << g_failures << " failure(s)\n";
+		return 1;
+	}
+	std::cout << "\nall catalog snapshot tests passed\n";
+	return 0;
+}
@@ -265,6 +265,112 @@ void test_sequential_reuse(const TestConfig &config) {
 	std::cout << "PASSED!" << std::endl;
 }
 
+void test_lifo_reuse(const TestConfig &config) {
+	std::cout << "\n=== Test: LIFO Reuse ===" << std::endl;
+
+	PoolConfiguration pool_config;
+	pool_config.connection_limit = 3;
+
+	ConnectionPool pool("test_lifo", pool_config, createFactory(config));
+
+	auto first = pool.Acquire();
+	auto second = pool.Acquire();
+	assert(first != nullptr && second != nullptr);
+	TdsConnection *first_raw = first.get();
+	TdsConnection *second_raw = second.get();
+
+	// Released first, then second: the next checkout is the warmest, `second`
+	pool.Release(first);
+	pool.Release(second);
+	first.reset();
+	second.reset();
+
+	auto conn = pool.Acquire();
+	assert(conn.get() == second_raw);
+	std::cout << "Most recently released connection handed out first" << std::endl;
+
+	auto next = pool.Acquire();
+	assert(next.get() == first_raw);
+	pool.Release(conn);
+	pool.Release(next);
+
+	auto stats = pool.GetStats();
+	assert(stats.connections_created == 2);
+	assert(stats.active_connections == 0);
+	assert(stats.idle_connections == 2);
+
+	std::cout << "PASSED!" << std::endl;
+}
+
+void test_prewarm(const TestConfig &config) {
+	std::cout << "\n=== Test: Pre-warm min_connections ===" << std::endl;
+
+	PoolConfiguration pool_config;
+	pool_config.connection_limit = 4;
+	pool_config.min_connections = 3;
+
+	ConnectionPool pool("test_prewarm", pool_config, createFactory(config));
+
+	// Logins run in the background; nothing has been acquired yet
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while (pool.GetStats().idle_connections < 3 && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+
+	auto stats = pool.GetStats();
+	std::cout << "Idle after pre-warm: " << stats.idle_connections << std::endl;
+	assert(stats.idle_connections == 3);
+	assert(stats.connections_created == 3);
+	assert(stats.acquire_count == 0);
+
+	// Checkouts are served from the warm connections, not new logins
+	std::vector<std::shared_ptr<TdsConnection>> held;
+	for (int i = 0; i < 3; i++) {
+		held.push_back(pool.Acquire());
+		assert(held.back() != nullptr);
+	}
+	assert(pool.GetStats().connections_created == 3);
+	for (auto &conn : held) {
+		pool.Release(conn);
+	}
+
+	std::cout << "PASSED!" << std::endl;
+}
+
+void test_shutdown_during_prewarm() {
+	std::cout << "\n=== Test: Shutdown does not wait for pre-warm logins ===" << std::endl;
+
+	// A login that takes far longer than teardown may
+	auto finished = std::make_shared<std::atomic<int>>(0);
+	ConnectionFactory slow_factory = [finished]() -> std::shared_ptr<TdsConnection> {
+		std::this_thread::sleep_for(std::chrono::seconds(2));
+		(*finished)++;
+		return nullptr;
+	};
+
+	PoolConfiguration pool_config;
+	pool_config.connection_limit = 4;
+	pool_config.min_connections = 2;
+
+	auto start = std::chrono::steady_clock::now();
+	{
+		ConnectionPool pool("test_shutdown_prewarm", pool_config, slow_factory);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));  // logins are in flight
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	std::cout << "Teardown took " << elapsed.count() << "ms" << std::endl;
+	assert(elapsed.count() < 1000);
+
+	// The abandoned logins finish on their own and find the pool gone
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (finished->load() < 2 && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	assert(finished->load() == 2);
+
+	std::cout << "PASSED!" << std::endl;
+}
+
 void test_connection_validation(const TestConfig &config) {
 	std::cout << "\n=== Test: Connection Validation ===" << std::endl;
 
@@ -374,6 +480,9 @@ int main() {
 		test_pool_limit(config);
 		test_parallel_acquire(config);
 		test_sequential_reuse(config);
+		test_lifo_reuse(config);
+		test_prewarm(config);
+		test_shutdown_during_prewarm();
 		test_connection_validation(config);
 	} catch (const std::exception &e) {
 		std::cerr << "\nTEST FAILED with exception: " << e.what() << std::endl;
@@ -21,6 +21,7 @@
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "table_scan/filter_encoder.hpp"
+#include "table_scan/filter_parameters.hpp"
 
 using namespace duckdb;
 using namespace duckdb::mssql;
@@ -263,6 +264,46 @@ static void TestModuloOperandTypes() {
 	ASSERT_REFUSED(FilterEncoder::EncodeSearchCondition(*dbl_cmp, ctx));
 }
 
+//==============================================================================
+// Test: with a FilterParameters collector, comparison constants become typed
+// sp_executesql parameters (mssql_scan_parameterize_filters). Only comparison
+// operands are lifted — a constant inside an arithmetic operand stays inline.
+//==============================================================================
+static void TestComparisonConstantsParameterized() {
+	std::cout << "  TestComparisonConstantsParameterized..." << std::endl;
+	Fixture fx;
+	FilterParameters params;
+	auto ctx = fx.Context();
+	ctx.parameters = &params;
+
+	auto id_cmp =
+		BoundComparisonExpression::Create(ExpressionType::COMPARE_EQUAL, ColRef(fx, COL_ID), Const(Value::INTEGER(7)));
+	ASSERT_SQL(FilterEncoder::EncodeSearchCondition(*id_cmp, ctx), "([id] = @p0)");
+
+	auto name_cmp = BoundComparisonExpression::Create(ExpressionType::COMPARE_GREATERTHAN, ColRef(fx, COL_NAME),
+													  Const(Value("O'Brien")));
+	ASSERT_SQL(FilterEncoder::EncodeSearchCondition(*name_cmp, ctx), "([name] > @p1)");
+
+	auto mod = Call2("%", LogicalType::INTEGER, LogicalType::INTEGER, LogicalType::INTEGER, ColRef(fx, COL_ID),
+					 Const(Value::INTEGER(2)));
+	auto mod_cmp =
+		BoundComparisonExpression::Create(ExpressionType::COMPARE_EQUAL, std::move(mod), Const(Value::INTEGER(0)));
+	ASSERT_SQL(FilterEncoder::EncodeSearchCondition(*mod_cmp, ctx), "(([id] % 2) = @p2)");
+
+	const auto &bound = params.Get();
+	ASSERT_TRUE(bound.declarations == "@p0 int, @p1 nvarchar(4000), @p2 int");
+	ASSERT_TRUE(bound.values.size() == 3);
+	// INTN(4), then the value as a length-prefixed little-endian int
+	ASSERT_TRUE((bound.values[0].type_info == std::vector<uint8_t> {0x26, 4}));
+	ASSERT_TRUE((bound.values[0].value == std::vector<uint8_t> {4, 7, 0, 0, 0}));
+	// UTF-16LE, no doubled quote: the value never passes through SQL text
+	ASSERT_TRUE(bound.values[1].value.size() == 2 + 2 * 7);
+
+	// Without a collector the same comparison inlines its literal.
+	auto literal_ctx = fx.Context();
+	ASSERT_SQL(FilterEncoder::EncodeSearchCondition(*id_cmp, literal_ctx), "([id] = 7)");
+}
+
 //==============================================================================
 // Main
 //==============================================================================
@@ -275,6 +316,7 @@ int main() {
 	TestCaseWhenIsPredicatePosition();
 	TestDivergingFunctionsNotMapped();
 	TestModuloOperandTypes();
+	TestComparisonConstantsParameterized();
 
 	std::cout << "All FilterEncoder tests PASSED!" << std::endl;
 	return 0;
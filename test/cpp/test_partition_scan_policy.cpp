@@ -0,0 +1,212 @@
+// test/cpp/test_partition_scan_policy.cpp
+//
+// Unit tests for the partition-aligned scan policy
+// (table_scan/partition_scan_policy.hpp).
+//
+// No SQL Server, no linking, no DuckDB submodule: the header is deliberately
+// self-contained, so -I src/include is the whole build recipe.
+//
+// Pruning is checked against a brute-force model of the partition function:
+// for every value in a window around the boundaries, if the value matches the
+// interval then its partition must be among the survivors. A partition pruned
+// in error is a silent loss of rows, so the model test is the one that matters.
+//
+// Run:
+//   ./build/test/test_partition_scan_policy
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "table_scan/partition_scan_policy.hpp"
+
+using namespace duckdb;
+
+static int g_failures = 0;
+
+static void Expect(bool cond, const std::string &what) {
+	if (!cond) {
+		std::cerr << "FAIL: " << what << "\n";
+		++g_failures;
+	} else {
+		std::cout << "ok: " << what << "\n";
+	}
+}
+
+// What SQL Server's $PARTITION returns for `x`, straight from the definition.
+static uint64_t PartitionOf(const std::vector<int64_t> &boundaries, bool range_right, int64_t x) {
+	uint64_t k = 1;
+	for (const auto b : boundaries) {
+		if (range_right ? x >= b : x > b) {
+			k++;
+		}
+	}
+	return k;
+}
+
+static bool Matches(const MSSQLPartitionKeyInterval<int64_t> &iv, int64_t x) {
+	if (iv.has_lower && (iv.lower_inclusive ? x < iv.lower : x <= iv.lower)) {
+		return false;
+	}
+	if (iv.has_upper && (iv.upper_inclusive ? x > iv.upper : x >= iv.upper)) {
+		return false;
+	}
+	return true;
+}
+
+// Every matching value's partition survives. The reverse is not asserted: the
+// interval is continuous, so 10 < x < 11 still reaches the partition above 10
+// even though no integer lives there. A partition kept in excess costs one
+// query; a partition pruned in error costs rows.
+static bool PruneAgreesWithModel(const std::vector<int64_t> &boundaries, bool range_right,
+								 const MSSQLPartitionKeyInterval<int64_t> &iv) {
+	const uint64_t count = boundaries.size() + 1;
+	const auto kept = MSSQLPrunePartitions<int64_t>(count, boundaries, range_right, iv);
+	std::vector<bool> needed(count + 1, false);
+	for (int64_t x = boundaries.front() - 10; x <= boundaries.back() + 10; x++) {
+		if (Matches(iv, x)) {
+			needed[PartitionOf(boundaries, range_right, x)] = true;
+		}
+	}
+	std::vector<bool> have(count + 1, false);
+	for (const auto k : kept) {
+		have[k] = true;
+	}
+	for (uint64_t k = 1; k <= count; k++) {
+		if (needed[k] && !have[k]) {
+			std::cerr << "  partition " << k << " pruned but holds matching values\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+static void TestPruneAgainstModel() {
+	std::cout << "\n-- pruning vs. $PARTITION model --\n";
+	const std::vector<int64_t> b = {10, 20, 30};
+	for (const bool range_right : {false, true}) {
+		const std::string fn = range_right ? "RANGE RIGHT" : "RANGE LEFT";
+		bool all_ok = true;
+		// Every lower/upper bound in the window, both inclusivities, including
+		// bounds that sit exactly on a boundary value.
+		for (int64_t lo = 7; lo <= 33 && all_ok; lo++) {
+			for (int64_t hi = lo; hi <= 33 && all_ok; hi++) {
+				for (int flags = 0; flags < 4 && all_ok; flags++) {
+					MSSQLPartitionKeyInterval<int64_t> iv;
+					iv.NarrowLower(lo, (flags & 1) != 0);
+					iv.NarrowUpper(hi, (flags & 2) != 0);
+					all_ok = PruneAgreesWithModel(b, range_right, iv);
+					if (!all_ok) {
+						std::cerr << "  " << fn << " lo=" << lo << " hi=" << hi << " flags=" << flags << "\n";
+					}
+				}
+			}
+		}
+		Expect(all_ok, fn + ": two-sided intervals never prune a partition holding matches");
+
+		all_ok = true;
+		for (int64_t v = 7; v <= 33 && all_ok; v++) {
+			for (const bool inclusive : {false, true}) {
+				MSSQLPartitionKeyInterval<int64_t> lower_only;
+				lower_only.NarrowLower(v, inclusive);
+				MSSQLPartitionKeyInterval<int64_t> upper_only;
+				upper_only.NarrowUpper(v, inclusive);
+				all_ok = all_ok && PruneAgreesWithModel(b, range_right, lower_only) &&
+						 PruneAgreesWithModel(b, range_right, upper_only);
+			}
+		}
+		Expect(all_ok, fn + ": one-sided intervals never prune a partition holding matches");
+	}
+}
+
+static void TestPruneEdges() {
+	std::cout << "\n-- pruning edges --\n";
+	const std::vector<int64_t> b = {10, 20, 30};
+
+	MSSQLPartitionKeyInterval<int64_t> none;
+	Expect(MSSQLPrunePartitions<int64_t>(4, b, false, none).size() == 4, "no filter keeps every partition");
+
+	MSSQLPartitionKeyInterval<int64_t> eq;
+	eq.NarrowLower(20, true);
+	eq.NarrowUpper(20, true);
+	auto kept = MSSQLPrunePartitions<int64_t>(4, b, false, eq);
+	Expect(kept.size() == 1 && kept[0] == 2, "RANGE LEFT: x = 20 lives in partition 2");
+	kept = MSSQLPrunePartitions<int64_t>(4, b, true, eq);
+	Expect(kept.size() == 1 && kept[0] == 3, "RANGE RIGHT: x = 20 lives in partition 3");
+
+	MSSQLPartitionKeyInterval<int64_t> above;
+	above.NarrowLower(20, false);
+	kept = MSSQLPrunePartitions<int64_t>(4, b, false, above);
+	Expect(kept.size() == 2 && kept[0] == 3, "RANGE LEFT: x > 20 skips partitions 1 and 2");
+	MSSQLPartitionKeyInterval<int64_t> below;
+	below.NarrowUpper(20, false);
+	kept = MSSQLPrunePartitions<int64_t>(4, b, true, below);
+	Expect(kept.size() == 2 && kept[1] == 2, "RANGE RIGHT: x < 20 stops at partition 2");
+
+	MSSQLPartitionKeyInterval<int64_t> contradiction;
+	contradiction.NarrowLower(25, false);
+	contradiction.NarrowUpper(12, true);
+	Expect(contradiction.empty, "x > 25 AND x <= 12 is empty");
+	Expect(MSSQLPrunePartitions<int64_t>(4, b, false, contradiction).empty(), "an empty interval keeps nothing");
+
+	MSSQLPartitionKeyInterval<int64_t> point_open;
+	point_open.NarrowLower(15, true);
+	point_open.NarrowUpper(15, false);
+	Expect(point_open.empty, "x >= 15 AND x < 15 is empty");
+
+	MSSQLPartitionKeyInterval<int64_t> tighter;
+	tighter.NarrowLower(5, true);
+	tighter.NarrowLower(15, false);
+	tighter.NarrowLower(12, true);
+	Expect(tighter.lower == 15 && !tighter.lower_inclusive, "the tightest lower bound wins");
+	tighter.NarrowLower(15, true);
+	Expect(!tighter.lower_inclusive, "x > 15 is tighter than x >= 15");
+
+	MSSQLPartitionKeyInterval<int64_t> gt;
+	gt.NarrowLower(0, true);
+	Expect(MSSQLPrunePartitions<int64_t>(5, b, false, gt).size() == 5,
+		   "boundaries that do not describe partition_count disable pruning");
+}
+
+static void TestGrouping() {
+	std::cout << "\n-- grouping --\n";
+	const std::vector<uint64_t> parts = {3, 4, 5, 6, 7, 8, 9};
+
+	auto g = MSSQLGroupPartitions(parts, 3);
+	Expect(g.size() == 3, "7 partitions on 3 streams -> 3 groups");
+	Expect(g[0].size() == 3 && g[1].size() == 2 && g[2].size() == 2, "group sizes differ by at most one");
+	size_t total = 0;
+	for (const auto &group : g) {
+		total += group.size();
+	}
+	Expect(total == parts.size() && g[0].front() == 3 && g[2].back() == 9, "every partition lands in one group");
+
+	Expect(MSSQLGroupPartitions(parts, 64).size() == parts.size(), "no more groups than partitions");
+	Expect(MSSQLGroupPartitions(parts, 0).size() == 1, "zero streams still yields one group");
+	Expect(MSSQLGroupPartitions({}, 4).empty(), "no partitions -> no groups");
+}
+
+static void TestPredicates() {
+	std::cout << "\n-- predicates --\n";
+	const std::string expr = "$PARTITION.[pf_year]([order_date])";
+	auto p = MSSQLBuildPartitionPredicate(expr, {4});
+	Expect(p == expr + " = 4", "single partition: " + p);
+	p = MSSQLBuildPartitionPredicate(expr, {4, 5, 6});
+	Expect(p == expr + " BETWEEN 4 AND 6", "adjacent run: " + p);
+	p = MSSQLBuildPartitionPredicate(expr, {2, 5});
+	Expect(p == expr + " IN (2, 5)", "scattered partitions: " + p);
+}
+
+int main() {
+	TestPruneAgainstModel();
+	TestPruneEdges();
+	TestGrouping();
+	TestPredicates();
+	if (g_failures > 0) {
+		std::cerr << "\n" << g_failures << " failure(s)\n";
+		return 1;
+	}
+	std::cout << "\nall partition scan policy tests passed\n";
+	return 0;
+}
@@ -0,0 +1,126 @@
+// test/cpp/test_prepared_cache.cpp
+//
+// Unit tests for the per-connection prepared statement handle cache
+// (tds/tds_prepared_cache.hpp).
+//
+// No SQL Server, no linking, no DuckDB submodule: the header is deliberately
+// self-contained, so -I src/include is the whole build recipe.
+//
+// Every evicted handle must come back to the caller exactly once: a handle
+// dropped silently stays allocated on the server for the life of the session,
+// and one returned twice is sp_unprepare'd twice, which fails the request that
+// carries the second one.
+//
+// Run:
+//   ./build/test/test_prepared_cache
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "tds/tds_prepared_cache.hpp"
+
+using namespace duckdb::tds;
+
+static int g_failures = 0;
+
+static void Expect(bool cond, const std::string &what) {
+	if (!cond) {
+		std::cerr << "FAIL: " << what << "\n";
+		++g_failures;
+	} else {
+		std::cout << "ok: " << what << "\n";
+	}
+}
+
+static void TestKeyIncludesDeclarations() {
+	auto a = PreparedStatementCache::MakeKey("@p0 int", "SELECT @p0");
+	auto b = PreparedStatementCache::MakeKey("@p0 bigint", "SELECT @p0");
+	auto c = PreparedStatementCache::MakeKey("@p0 int", "SELECT @p0 ");
+	Expect(a != b, "same text with different parameter types is a different statement");
+	Expect(a != c, "different text is a different statement");
+	// The separator keeps a declaration suffix from reading as a text prefix
+	Expect(PreparedStatementCache::MakeKey("x", "yz") != PreparedStatementCache::MakeKey("xy", "z"),
+		   "key is not ambiguous across the declarations/text boundary");
+}
+
+static void TestLookupAndLruOrder() {
+	PreparedStatementCache cache;
+	std::vector<int32_t> evicted;
+	cache.SetCapacity(2, evicted);
+	Expect(evicted.empty(), "shrinking an empty cache evicts nothing");
+
+	int32_t handle = 0;
+	Expect(!cache.Lookup("a", handle), "miss on an empty cache");
+
+	cache.Insert("a", 1, evicted);
+	cache.Insert("b", 2, evicted);
+	Expect(evicted.empty(), "no eviction within capacity");
+	Expect(cache.Lookup("a", handle) && handle == 1, "hit returns the prepared handle");
+
+	// "a" was just used, so "b" is least recent
+	cache.Insert("c", 3, evicted);
+	Expect(evicted.size() == 1 && evicted[0] == 2, "least recently used handle is evicted");
+	Expect(!cache.Lookup("b", handle), "evicted key misses");
+	Expect(cache.Lookup("a", handle) && handle == 1, "recently used key survives");
+	Expect(cache.Size() == 2, "size stays at capacity");
+}
+
+static void TestReinsertReleasesOldHandle() {
+	PreparedStatementCache cache;
+	std::vector<int32_t> evicted;
+	cache.Insert("a", 1, evicted);
+	cache.Insert("a", 5, evicted);
+	int32_t handle = 0;
+	Expect(evicted.size() == 1 && evicted[0] == 1, "replaced handle is returned for release");
+	Expect(cache.Lookup("a", handle) && handle == 5, "replacement handle is cached");
+	Expect(cache.Size() == 1, "replacement does not grow the cache");
+}
+
+static void TestShrinkAndZeroCapacity() {
+	PreparedStatementCache cache;
+	std::vector<int32_t> evicted;
+	cache.Insert("a", 1, evicted);
+	cache.Insert("b", 2, evicted);
+	cache.Insert("c", 3, evicted);
+	cache.SetCapacity(1, evicted);
+	Expect(evicted.size() == 2 && evicted[0] == 1 && evicted[1] == 2, "shrinking evicts oldest first");
+
+	evicted.clear();
+	cache.SetCapacity(0, evicted);
+	Expect(evicted.size() == 1 && evicted[0] == 3, "capacity 0 evicts everything");
+	evicted.clear();
+	cache.Insert("d", 4, evicted);
+	Expect(evicted.size() == 1 && evicted[0] == 4, "capacity 0 hands a new handle straight back");
+	Expect(cache.Size() == 0, "capacity 0 caches nothing");
+}
+
+static void TestClearAndForgetDoNotRelease() {
+	PreparedStatementCache cache;
+	std::vector<int32_t> evicted;
+	cache.Insert("a", 1, evicted);
+	cache.Insert("b", 2, evicted);
+	cache.Forget("a");
+	cache.Forget("missing");
+	int32_t handle = 0;
+	Expect(!cache.Lookup("a", handle), "forgotten key misses");
+	cache.Clear();
+	Expect(cache.Size() == 0 && !cache.Lookup("b", handle), "clear empties the cache");
+	Expect(evicted.empty(), "neither forget nor clear asks for a release");
+}
+
+int main() {
+	std::cout << "Running prepared statement cache tests..." << std::endl;
+	TestKeyIncludesDeclarations();
+	TestLookupAndLruOrder();
+	TestReinsertReleasesOldHandle();
+	TestShrinkAndZeroCapacity();
+	TestClearAndForgetDoNotRelease();
+	if (g_failures > 0) {
+		std::cerr << g_failures << " failure(s)\n";
+		return 1;
+	}
+	std::cout << "All prepared statement cache tests PASSED" << std::endl;
+	return 0;
+}
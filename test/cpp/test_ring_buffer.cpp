@@ -0,0 +1,189 @@
+// test/cpp/test_ring_buffer.cpp
+//
+// Unit tests for the receive-side ring buffer (tds/tds_ring_buffer.hpp).
+//
+// No SQL Server, no linking, no DuckDB submodule: the header is deliberately
+// self-contained, so -I src/include is the whole build recipe.
+//
+// What matters is that bytes come out in the order they went in and that the
+// live span is contiguous across the wrap. A ring that loses or reorders bytes
+// at the seam corrupts exactly the rows that straddle two packets — a few per
+// million, with no error anywhere. Every test runs against both layouts.
+//
+// TestSetupCost is a benchmark, not a test: it prints what one short-lived
+// ring costs to create, fill with a small result and destroy in each layout —
+// the price a per-statement parser pays, and why those parsers stay flat.
+//
+// Run:
+//   ./build/test/test_ring_buffer
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "tds/tds_ring_buffer.hpp"
+
+using namespace duckdb::tds;
+
+static int g_failures = 0;
+
+static void Expect(bool cond, const std::string &what) {
+	if (!cond) {
+		std::cerr << "FAIL: " << what << "\n";
+		++g_failures;
+	} else {
+		std::cout << "ok: " << what << "\n";
+	}
+}
+
+//! Byte `i` of the test stream
+static uint8_t StreamByte(uint64_t i) {
+	return static_cast<uint8_t>((i * 31) ^ (i >> 8));
+}
+
+static bool Matches(const RingBuffer &ring, uint64_t stream_pos) {
+	for (size_t i = 0; i < ring.Size(); i++) {
+		if (ring.Data()[i] != StreamByte(stream_pos + i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static const char *LayoutName(RingBuffer::Layout layout) {
+	return layout == RingBuffer::Layout::Mirrored ? "mirrored" : "flat";
+}
+
+static void TestBasics(RingBuffer::Layout layout) {
+	std::cout << "\n-- basics (" << LayoutName(layout) << ") --\n";
+
+	RingBuffer ring(layout);
+	Expect(ring.Empty() && ring.Capacity() == 0, "a new ring allocates nothing");
+
+	const uint8_t bytes[] = {1, 2, 3, 4, 5};
+	ring.Append(bytes, sizeof(bytes));
+	Expect(ring.Size() == 5 && ring.Capacity() >= RingBuffer::MIN_CAPACITY, "append allocates the minimum ring");
+	ring.Consume(2);
+	Expect(ring.Size() == 3 && ring.Data()[0] == 3, "consume drops from the front");
+
+	const uint8_t *view = ring.Data();
+	ring.Consume(3);
+	Expect(ring.Empty() && view[2] == 5, "consumed bytes stay readable until the next write");
+
+	ring.Append(bytes, sizeof(bytes));
+	ring.Clear();
+	Expect(ring.Empty() && ring.Capacity() >= RingBuffer::MIN_CAPACITY, "clear keeps the allocation");
+	if (layout == RingBuffer::Layout::Flat) {
+		Expect(!ring.IsMirrored(), "a flat ring never maps");
+	} else {
+		std::cout << "mirrored: " << (ring.IsMirrored() ? "yes" : "no (flat fallback)") << "\n";
+	}
+}
+
+static void TestWrap(RingBuffer::Layout layout) {
+	std::cout << "\n-- wrap (" << LayoutName(layout) << ") --\n";
+
+	// Packet-sized writes against frame-sized consumes that do not divide the
+	// capacity, so the head and the tail cross the seam at every offset.
+	RingBuffer ring(layout);
+	ring.Reserve(RingBuffer::MIN_CAPACITY);
+	const size_t capacity = ring.Capacity();
+	uint64_t written = 0;
+	uint64_t consumed = 0;
+	bool in_order = true;
+	bool contiguous = true;
+	for (int round = 0; round < 2000; round++) {
+		const size_t write = 4093 + (round % 7) * 1021;
+		if (ring.Size() + write <= capacity) {
+			uint8_t *room = ring.PrepareWrite(write);
+			for (size_t i = 0; i < write; i++) {
+				room[i] = StreamByte(written + i);
+			}
+			ring.CommitWrite(write);
+			written += write;
+		}
+		// A "row" that straddles whatever seam there is must read as one span
+		const size_t row = std::min<size_t>(ring.Size(), 3001 + (round % 5) * 2003);
+		for (size_t i = 0; i < row; i++) {
+			if (ring.Data()[i] != StreamByte(consumed + i)) {
+				contiguous = false;
+				break;
+			}
+		}
+		ring.Consume(row);
+		consumed += row;
+		in_order = in_order && Matches(ring, consumed);
+	}
+	Expect(contiguous, "rows read contiguously across the wrap");
+	Expect(in_order, "bytes come out in the order they went in");
+	Expect(ring.Capacity() == capacity, "a ring that never overfills never grows");
+	Expect(written > capacity * 10, "the stream wrapped many times");
+}
+
+static void TestGrowth(RingBuffer::Layout layout) {
+	std::cout << "\n-- growth (" << LayoutName(layout) << ") --\n";
+
+	RingBuffer ring(layout);
+	std::vector<uint8_t> chunk(RingBuffer::MIN_CAPACITY / 3);
+	uint64_t written = 0;
+	// Leave a straddling tail at the seam, then append more than fits
+	for (int i = 0; i < 2; i++) {
+		for (size_t j = 0; j < chunk.size(); j++) {
+			chunk[j] = StreamByte(written + j);
+		}
+		ring.Append(chunk.data(), chunk.size());
+		written += chunk.size();
+	}
+	ring.Consume(chunk.size() + 17);
+	const size_t before = ring.Capacity();
+	std::vector<uint8_t> big(before * 2 + 5);
+	for (size_t j = 0; j < big.size(); j++) {
+		big[j] = StreamByte(written + j);
+	}
+	ring.Append(big.data(), big.size());
+	Expect(ring.Capacity() > before, "a span larger than the ring grows it");
+	Expect(ring.Size() == chunk.size() - 17 + big.size(), "growth keeps every live byte");
+	Expect(Matches(ring, chunk.size() + 17), "growth keeps the order");
+
+	RingBuffer moved(std::move(ring));
+	Expect(ring.Capacity() == 0 && ring.Empty(), "a moved-from ring is empty");
+	Expect(Matches(moved, chunk.size() + 17), "a moved ring keeps its bytes");
+	Expect(moved.GetLayout() == layout, "a moved ring keeps its layout");
+}
+
+static void TestSetupCost() {
+	std::cout << "\n-- setup cost (benchmark) --\n";
+
+	// One small statement's worth of response: DONE plus a few short rows
+	const std::vector<uint8_t> response(512, 0xFD);
+	const int iterations = 2000;
+	for (auto layout : {RingBuffer::Layout::Flat, RingBuffer::Layout::Mirrored}) {
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			RingBuffer ring(layout);
+			ring.Append(response.data(), response.size());
+			ring.Consume(response.size());
+		}
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		const double us = std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+		std::cout << LayoutName(layout) << ": " << us << " us per create/fill/destroy\n";
+	}
+}
+
+int main() {
+	for (auto layout : {RingBuffer::Layout::Flat, RingBuffer::Layout::Mirrored}) {
+		TestBasics(layout);
+		TestWrap(layout);
+		TestGrowth(layout);
+	}
+	TestSetupCost();
+	if (g_failures > 0) {
+		std::cerr << "\n" << g_failures << " failure(s)\n";
+		return 1;
+	}
+	std::cout << "\nall ring buffer tests passed\n";
+	return 0;
+}
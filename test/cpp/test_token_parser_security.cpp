@@ -100,6 +100,41 @@ int main() {
 		DrainNoCrash("error_wellformed", err);
 	}
 
+	// --- RETURNVALUE of a type the parser does not decode ---
+	// It used to put the parser in the error state, so one unexpected OUTPUT
+	// parameter failed the whole response. It must now be skipped by its
+	// TYPE_INFO, reported undecoded, and leave the following tokens in sync.
+	{
+		const std::vector<uint8_t> header = {0xAC, /*ordinal*/ 0x01, 0x00, /*name*/ 0x00, /*status*/ 0x01,
+											 /*usertype*/ 0x00, 0x00, 0x00, 0x00, /*flags*/ 0x00, 0x00};
+		// nvarchar(5) OUTPUT = N'ab'
+		std::vector<uint8_t> stream = header;
+		stream.insert(stream.end(), {0xE7, 0x0A, 0x00, 0x09, 0x04, 0xD0, 0x00, 0x34, 0x04, 0x00, 'a', 0x00, 'b', 0x00});
+		// int OUTPUT = 42
+		stream.insert(stream.end(), header.begin(), header.end());
+		stream.insert(stream.end(), {0x26, 0x04, 0x04, 42, 0x00, 0x00, 0x00});
+		// DONE, final
+		stream.insert(stream.end(), {0xFD, 0x00, 0x00, 0xC1, 0x00, 0, 0, 0, 0, 0, 0, 0, 0});
+
+		TokenParser parser;
+		parser.Feed(stream.data(), stream.size());
+		bool good = parser.TryParseNext() == ParsedTokenType::ReturnValue && !parser.GetReturnValue().decoded &&
+					parser.GetReturnValue().type_id == 0xE7;
+		good = good && parser.TryParseNext() == ParsedTokenType::ReturnValue && parser.GetReturnValue().decoded &&
+			   parser.GetReturnValue().int_value == 42;
+		good = good && parser.TryParseNext() == ParsedTokenType::Done;
+		if (!good) {
+			std::cerr << "FAIL: an undecoded RETURNVALUE desynchronised the token stream" << std::endl;
+			++g_failures;
+		} else {
+			std::cout << "ok: returnvalue_skip_undecoded" << std::endl;
+		}
+		// Every truncation of it must ask for more data, never fail or overrun
+		for (size_t cut = 1; cut < header.size() + 14; ++cut) {
+			DrainNoCrash("returnvalue_truncated", std::vector<uint8_t>(stream.begin(), stream.begin() + cut));
+		}
+	}
+
 	// --- FindBeginTxnDescriptor: ENVCHANGE transaction-descriptor scan ---
 	// (replaced the connection provider's hand-rolled `offset += token_len - 1` loop)
 	{
@@ -28,6 +28,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
 #include "insert/mssql_value_serializer.hpp"
 
 using namespace duckdb;
@@ -598,6 +599,40 @@ void test_serialize_small_integers() {
 	std::cout << "PASSED!" << std::endl;
 }
 
+//==============================================================================
+// Test: SerializeFromVector - vector kernels match Serialize
+//==============================================================================
+void test_serialize_from_vector() {
+	std::cout << "\n=== Test: SerializeFromVector matches Serialize ===" << std::endl;
+
+	// The typed kernels (bool, integers, VARCHAR) and the Value fallback
+	// (DOUBLE, UBIGINT above INT64_MAX) must render byte-identical literals
+	std::vector<Value> values = {Value::BOOLEAN(true),
+								 Value::BOOLEAN(false),
+								 Value::TINYINT(-128),
+								 Value::SMALLINT(-32768),
+								 Value::INTEGER(-42),
+								 Value::BIGINT(std::numeric_limits<int64_t>::min()),
+								 Value::UTINYINT(255),
+								 Value::USMALLINT(65535),
+								 Value::UINTEGER(4294967295U),
+								 Value::UBIGINT(9223372036854775807ULL),
+								 Value::UBIGINT(18446744073709551615ULL),
+								 Value("O'Brien ''x''"),
+								 Value(""),
+								 Value("日本語"),
+								 Value::DOUBLE(1.5),
+								 Value(LogicalType::INTEGER),
+								 Value(LogicalType::VARCHAR)};
+	for (auto &value : values) {
+		Vector vec(value);
+		ASSERT_EQ(MSSQLValueSerializer::SerializeFromVector(vec, 0, value.type()),
+				  MSSQLValueSerializer::Serialize(value, value.type()));
+	}
+
+	std::cout << "PASSED!" << std::endl;
+}
+
 //==============================================================================
 // Main
 //==============================================================================
@@ -639,6 +674,7 @@ int main() {
 		test_serialize_decimal();
 		test_serialize_uuid();
 		test_serialize_ubigint();
+		test_serialize_from_vector();
 
 		std::cout << "\n==========================================" << std::endl;
 		std::cout << "ALL TESTS PASSED!" << std::endl;